@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "gflags/gflags.h"
+#include "latency_histogram.hpp"
 
 /// @brief message for help argument
 static const char help_message[] = "Print a usage message";
@@ -90,6 +91,26 @@ static const char infer_latency_percentile_message[] =
     "Optional. Defines the percentile to be reported in latency metric. The valid range is [1, 100]. The default value "
     "is 50 (median).";
 
+/// @brief message for latency histogram option, lists the percentiles reported by LatencyHistogram
+static const std::string latency_histogram_message = [] {
+    std::string percentiles;
+    for (auto p : LatencyHistogram::tail_percentiles()) {
+        percentiles += (percentiles.empty() ? "" : ", ") + LatencyHistogram::percentile_name(p);
+    }
+    return "Optional. Collects the latency histogram and reports the tail percentiles (" + percentiles +
+           ") together with the latency breakdown into queueing, inputs filling, inference and callback time.";
+}();
+
+/// @brief message for latency samples dumping option
+static const char latency_samples_message[] =
+    "Optional. Path to a JSON file to store the raw latency samples with their breakdown and the latency histogram.";
+
+/// @brief message for fixed arrival rate option
+static const char arrival_rate_message[] =
+    "Optional. Fixed arrival rate of inference requests per second (open-loop load generation). Requests are "
+    "submitted on schedule regardless of completions, so the reported latencies include the queueing delay when the "
+    "device cannot sustain the rate. Applicable to the async API only.";
+
 /// @brief message for enforcing of BF16 execution where it is possible
 static const char enforce_bf16_message[] =
     "Optional. By default floating point operations execution in bfloat16 precision are enforced "
@@ -299,6 +320,15 @@ DEFINE_string(nstreams, "", infer_num_streams_message);
 /// @brief The percentile which will be reported in latency metric
 DEFINE_uint64(latency_percentile, 50, infer_latency_percentile_message);
 
+/// @brief Define flag for collecting the latency histogram
+DEFINE_bool(latency_histogram, false, latency_histogram_message.c_str());
+
+/// @brief Path to the JSON file with the raw latency samples
+DEFINE_string(latency_samples, "", latency_samples_message);
+
+/// @brief Fixed arrival rate of inference requests per second, 0 means closed-loop load
+DEFINE_double(arrival_rate, 0, arrival_rate_message);
+
 /// @brief Define parameter for batch size <br>
 /// Default is 0 (that means don't specify)
 DEFINE_uint64(b, 0, batch_size_message);
@@ -404,6 +434,7 @@ static void show_usage() {
     std::cout << "    -cache_dir \"<path>\"       " << cache_dir_message << std::endl;
     std::cout << "    -load_from_file           " << load_from_file_message << std::endl;
     std::cout << "    -latency_percentile       " << infer_latency_percentile_message << std::endl;
+    std::cout << "    -arrival_rate \"<float>\"   " << arrival_rate_message << std::endl;
     std::cout << std::endl << "  device-specific performance options:" << std::endl;
     std::cout << "    -nstreams \"<integer>\"     " << infer_num_streams_message << std::endl;
     std::cout << "    -nthreads \"<integer>\"     " << infer_num_threads_message << std::endl;
@@ -420,6 +451,8 @@ static void show_usage() {
     std::cout << "    -pc                       " << pc_message << std::endl;
     std::cout << "    -pcsort                   " << pc_sort_message << std::endl;
     std::cout << "    -pcseq                    " << pcseq_message << std::endl;
+    std::cout << "    -latency_histogram        " << latency_histogram_message << std::endl;
+    std::cout << "    -latency_samples \"<path>\" " << latency_samples_message << std::endl;
     std::cout << "    -dump_config              " << dump_config_message << std::endl;
     std::cout << "    -load_config              " << load_config_message << std::endl;
     std::cout << "    -infer_precision \"<element type>\"" << inference_precision_message << std::endl;
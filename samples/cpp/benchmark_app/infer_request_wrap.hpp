@@ -18,12 +18,14 @@
 
 // clang-format off
 
+#include "latency_histogram.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
 // clang-format on
 
-typedef std::function<void(size_t id, size_t group_id, const double latency, const std::exception_ptr& ptr)>
+typedef std::function<
+    void(size_t id, LatencySample sample, const Time::time_point& completion_time, const std::exception_ptr& ptr)>
     QueueCallbackFunction;
 
 /// @brief Wrapper class for InferenceEngine::InferRequest. Handles asynchronous callbacks and calculates execution
@@ -42,10 +44,22 @@ public:
           outputClBuffer() {
         _request.set_callback([&](const std::exception_ptr& ptr) {
             _endTime = Time::now();
-            _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), ptr);
+            _callbackQueue(_id, get_latency_sample(), _endTime, ptr);
         });
     }
 
+    /// @brief Marks the request as taken from the idle queue. The arrival time is the same unless overridden by
+    /// set_arrival_time()
+    void set_dequeue_time(const Time::time_point& time) {
+        _arrivalTime = time;
+        _dequeueTime = time;
+    }
+
+    /// @brief Sets the time the inference was requested at, e.g. its scheduled time in the fixed arrival rate mode
+    void set_arrival_time(const Time::time_point& time) {
+        _arrivalTime = time;
+    }
+
     void start_async() {
         _startTime = Time::now();
         _request.start_async();
@@ -59,7 +73,7 @@ public:
         _startTime = Time::now();
         _request.infer();
         _endTime = Time::now();
-        _callbackQueue(_id, _lat_group_id, get_execution_time_in_milliseconds(), nullptr);
+        _callbackQueue(_id, get_latency_sample(), _endTime, nullptr);
     }
 
     std::vector<ov::ProfilingInfo> get_performance_counts() {
@@ -80,8 +94,20 @@ public:
     }
 
     double get_execution_time_in_milliseconds() const {
-        auto execTime = std::chrono::duration_cast<ns>(_endTime - _startTime);
-        return static_cast<double>(execTime.count()) * 0.000001;
+        return to_milliseconds(_endTime - _startTime);
+    }
+
+    LatencySample get_latency_sample() const {
+        LatencySample sample;
+        sample.queue = std::max(to_milliseconds(_dequeueTime - _arrivalTime), 0.0);
+        sample.inputs = std::max(to_milliseconds(_startTime - _dequeueTime), 0.0);
+        sample.infer = get_execution_time_in_milliseconds();
+        sample.group_id = _lat_group_id;
+        return sample;
+    }
+
+    static double to_milliseconds(const Time::duration& duration) {
+        return static_cast<double>(std::chrono::duration_cast<ns>(duration).count()) * 0.000001;
     }
 
     void set_latency_group_id(size_t id) {
@@ -97,6 +123,8 @@ public:
 
 private:
     ov::InferRequest _request;
+    Time::time_point _arrivalTime;
+    Time::time_point _dequeueTime;
     Time::time_point _startTime;
     Time::time_point _endTime;
     size_t _id;
@@ -138,6 +166,7 @@ public:
         _startTime = Time::time_point::max();
         _endTime = Time::time_point::min();
         _latencies.clear();
+        _samples.clear();
         for (auto& group : _latency_groups) {
             group.clear();
         }
@@ -148,21 +177,27 @@ public:
     }
 
     void put_idle_request(size_t id,
-                          size_t lat_group_id,
-                          const double latency,
+                          LatencySample sample,
+                          const Time::time_point& completion_time,
                           const std::exception_ptr& ptr = nullptr) {
         std::unique_lock<std::mutex> lock(_mutex);
         if (ptr) {
             inferenceException = ptr;
         } else {
-            _latencies.push_back(latency);
+            _samples.push_back(sample);
+            _latencies.push_back(sample.infer);
             if (enable_lat_groups) {
-                _latency_groups[lat_group_id].push_back(latency);
+                _latency_groups[sample.group_id].push_back(sample.infer);
             }
             _idleIds.push(id);
             _endTime = std::max(Time::now(), _endTime);
         }
         _cv.notify_one();
+        if (!ptr) {
+            // the callback stage covers the whole callback body: the lock wait, the bookkeeping and the wake up of
+            // the waiting thread
+            _samples.back().callback = InferReqWrap::to_milliseconds(Time::now() - completion_time);
+        }
     }
 
     InferReqWrap::Ptr get_idle_request() {
@@ -175,7 +210,9 @@ public:
         });
         auto request = requests.at(_idleIds.front());
         _idleIds.pop();
-        _startTime = std::min(Time::now(), _startTime);
+        const auto now = Time::now();
+        request->set_dequeue_time(now);
+        _startTime = std::min(now, _startTime);
         return request;
     }
 
@@ -197,6 +234,10 @@ public:
         return _latency_groups;
     }
 
+    std::vector<LatencySample> get_latency_samples() {
+        return _samples;
+    }
+
     std::vector<InferReqWrap::Ptr> requests;
 
 private:
@@ -206,6 +247,7 @@ private:
     Time::time_point _startTime;
     Time::time_point _endTime;
     std::vector<double> _latencies;
+    std::vector<LatencySample> _samples;
     std::vector<std::vector<double>> _latency_groups;
     bool enable_lat_groups;
     std::exception_ptr inferenceException = nullptr;
@@ -0,0 +1,139 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+// clang-format off
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "samples/common.hpp"
+#include "samples/slog.hpp"
+
+#include "latency_histogram.hpp"
+// clang-format on
+
+LatencyHistogram::LatencyHistogram(double precision, double lowest_ms, double highest_ms)
+    : _lowest(lowest_ms),
+      _log_base(std::log1p(precision)) {
+    if (precision <= 0 || lowest_ms <= 0 || highest_ms <= lowest_ms) {
+        throw std::invalid_argument("LatencyHistogram: invalid precision or range");
+    }
+    _buckets.resize(static_cast<size_t>(std::ceil(std::log(highest_ms / lowest_ms) / _log_base)) + 1, 0);
+}
+
+size_t LatencyHistogram::bucket_index(double latency_ms) const {
+    if (latency_ms <= _lowest) {
+        return 0;
+    }
+    const auto index = static_cast<size_t>(std::ceil(std::log(latency_ms / _lowest) / _log_base));
+    return std::min(index, _buckets.size() - 1);
+}
+
+double LatencyHistogram::bucket_upper_bound(size_t index) const {
+    return _lowest * std::exp(_log_base * index);
+}
+
+void LatencyHistogram::add(double latency_ms) {
+    _buckets[bucket_index(latency_ms)]++;
+    _min = _count ? std::min(_min, latency_ms) : latency_ms;
+    _max = _count ? std::max(_max, latency_ms) : latency_ms;
+    _sum += latency_ms;
+    _count++;
+}
+
+void LatencyHistogram::add(const std::vector<double>& latencies_ms) {
+    for (auto latency : latencies_ms) {
+        add(latency);
+    }
+}
+
+double LatencyHistogram::percentile(double p) const {
+    if (_count == 0) {
+        return 0;
+    }
+    const auto rank = static_cast<uint64_t>(std::ceil(p / 100.0 * _count));
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < _buckets.size(); i++) {
+        accumulated += _buckets[i];
+        if (accumulated >= std::max<uint64_t>(rank, 1)) {
+            // the bucket bound may exceed the real values range, so clamp it to the observed extremes
+            return std::min(std::max(bucket_upper_bound(i), _min), _max);
+        }
+    }
+    return _max;
+}
+
+const std::vector<double>& LatencyHistogram::tail_percentiles() {
+    static const std::vector<double> percentiles = {50, 90, 95, 99, 99.9, 99.99};
+    return percentiles;
+}
+
+std::string LatencyHistogram::percentile_name(double p) {
+    std::stringstream ss;
+    ss << "p" << p;
+    return ss.str();
+}
+
+void LatencyHistogram::write_to_slog(const std::string& title) const {
+    slog::info << title << " (" << _count << " samples):" << slog::endl;
+    if (_count == 0) {
+        return;
+    }
+    for (auto p : tail_percentiles()) {
+        std::string name = percentile_name(p) + ":";
+        name.resize(std::max<size_t>(name.size(), 18), ' ');
+        slog::info << "   " << name << double_to_string(percentile(p)) << " ms" << slog::endl;
+    }
+
+    // merge the fine buckets into power-of-2 ranges to keep the console output short
+    double range_begin = 0;
+    double range_end = std::pow(2.0, std::floor(std::log2(std::max(_min, _lowest))) + 1);
+    uint64_t range_count = 0;
+    const size_t bar_width = 50;
+    auto print_range = [&]() {
+        if (range_count == 0) {
+            return;
+        }
+        const auto bar = static_cast<size_t>(std::ceil(bar_width * static_cast<double>(range_count) / _count));
+        std::stringstream ss;
+        ss << "   [" << std::setw(10) << double_to_string(range_begin) << ", " << std::setw(10)
+           << double_to_string(range_end) << ") ms " << std::setw(10) << range_count << " " << std::string(bar, '#');
+        slog::info << ss.str() << slog::endl;
+    };
+    for (size_t i = 0; i < _buckets.size(); i++) {
+        if (_buckets[i] == 0) {
+            continue;
+        }
+        const auto bound = bucket_upper_bound(i);
+        while (bound > range_end) {
+            print_range();
+            range_begin = range_end;
+            range_end *= 2;
+            range_count = 0;
+        }
+        range_count += _buckets[i];
+    }
+    print_range();
+}
+
+nlohmann::json LatencyHistogram::to_json() const {
+    nlohmann::json js;
+    js["count"] = _count;
+    js["mean"] = mean();
+    js["min"] = _min;
+    js["max"] = _max;
+    for (auto p : tail_percentiles()) {
+        js["percentiles"][percentile_name(p)] = percentile(p);
+    }
+    js["buckets"] = nlohmann::json::array();
+    for (size_t i = 0; i < _buckets.size(); i++) {
+        if (_buckets[i]) {
+            js["buckets"].push_back({bucket_upper_bound(i), _buckets[i]});
+        }
+    }
+    return js;
+}
@@ -0,0 +1,89 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#ifdef JSON_HEADER
+#    include <json.hpp>
+#else
+#    include <nlohmann/json.hpp>
+#endif
+
+/// @brief Latency of a single inference split into stages, all values are in milliseconds
+struct LatencySample {
+    /// from the request arrival (scheduled submission time in fixed arrival rate mode) to taking an idle infer request
+    double queue = 0;
+    /// filling the inputs of the infer request
+    double inputs = 0;
+    /// from the inference start to its completion
+    double infer = 0;
+    /// the completion callback body: from the inference completion to returning the infer request to the idle queue
+    /// and waking up the waiting thread
+    double callback = 0;
+    size_t group_id = 0;
+
+    double total() const {
+        return queue + inputs + infer + callback;
+    }
+};
+
+/// @brief HDR-style latency histogram. The buckets grow geometrically, so every recorded value is represented with
+/// the same relative precision across the whole range, from microseconds to hours, in a fixed amount of memory.
+class LatencyHistogram {
+public:
+    /// @param precision relative width of a bucket, e.g. 0.01 keeps the reported percentiles within 1%
+    /// @param lowest_ms values below it are accounted in the first bucket
+    /// @param highest_ms values above it are accounted in the last bucket
+    explicit LatencyHistogram(double precision = 0.01, double lowest_ms = 0.001, double highest_ms = 3600000.0);
+
+    void add(double latency_ms);
+    void add(const std::vector<double>& latencies_ms);
+
+    uint64_t count() const {
+        return _count;
+    }
+
+    double min() const {
+        return _min;
+    }
+
+    double max() const {
+        return _max;
+    }
+
+    double mean() const {
+        return _count ? _sum / _count : 0;
+    }
+
+    /// @brief Returns the upper bound of the bucket holding the given percentile, e.g. 99.9
+    double percentile(double p) const;
+
+    /// @brief Prints the tail percentiles and a compact histogram with power-of-2 ranges
+    void write_to_slog(const std::string& title) const;
+
+    /// @brief Non-empty buckets as [upper bound ms, count] pairs and the tail percentiles
+    nlohmann::json to_json() const;
+
+    /// @brief Percentiles reported by write_to_slog() and to_json()
+    static const std::vector<double>& tail_percentiles();
+
+    /// @brief Returns the name of the percentile used in the reports, e.g. "p99.9"
+    static std::string percentile_name(double p);
+
+private:
+    size_t bucket_index(double latency_ms) const;
+    double bucket_upper_bound(size_t index) const;
+
+    double _lowest;
+    double _log_base;
+    std::vector<uint64_t> _buckets;
+    uint64_t _count = 0;
+    double _sum = 0;
+    double _min = 0;
+    double _max = 0;
+};
@@ -7,6 +7,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -24,6 +25,7 @@
 #include "benchmark_app.hpp"
 #include "infer_request_wrap.hpp"
 #include "inputs_filling.hpp"
+#include "latency_histogram.hpp"
 #include "remote_tensors_filling.hpp"
 #include "statistics_report.hpp"
 #include "utils.hpp"
@@ -53,6 +55,12 @@ bool parse_and_check_command_line(int argc, char* argv[]) {
     if (FLAGS_api != "async" && FLAGS_api != "sync") {
         throw std::logic_error("Incorrect API. Please set -api option to `sync` or `async` value.");
     }
+    if (FLAGS_arrival_rate < 0) {
+        throw std::logic_error("The arrival rate is incorrect. It should be a positive number of requests per second.");
+    }
+    if (FLAGS_arrival_rate > 0 && FLAGS_api != "async") {
+        throw std::logic_error("-arrival_rate option is applicable to the async API only.");
+    }
     if (!FLAGS_hint.empty() && FLAGS_hint != "throughput" && FLAGS_hint != "tput" && FLAGS_hint != "latency" &&
         FLAGS_hint != "cumulative_throughput" && FLAGS_hint != "ctput" && FLAGS_hint != "none") {
         throw std::logic_error("Incorrect performance hint. Please set -hint option to"
@@ -200,6 +208,31 @@ void warn_if_no_batch(const benchmark_app::InputsInfo& first_inputs) {
             << slog::endl;
     }
 }
+
+void dump_latency_samples(const std::string& path,
+                          const std::vector<LatencySample>& samples,
+                          const std::vector<std::pair<std::string, LatencyHistogram>>& histograms) {
+    nlohmann::json js;
+    for (const auto& histogram : histograms) {
+        js["histograms"][histogram.first] = histogram.second.to_json();
+    }
+    js["samples"] = nlohmann::json::array();
+    for (const auto& sample : samples) {
+        js["samples"].push_back({{"queue", sample.queue},
+                                 {"inputs", sample.inputs},
+                                 {"infer", sample.infer},
+                                 {"callback", sample.callback},
+                                 {"total", sample.total()},
+                                 {"group_id", sample.group_id}});
+    }
+
+    std::ofstream out_stream(path);
+    if (!out_stream) {
+        throw std::runtime_error("Can't open " + path + " to store the latency samples");
+    }
+    out_stream << std::setw(4) << js << std::endl;
+    slog::info << "Latency samples are stored to " << path << slog::endl;
+}
 }  // namespace
 
 /**
@@ -1125,16 +1158,33 @@ int main(int argc, char* argv[]) {
         auto startTime = Time::now();
         auto execTime = std::chrono::duration_cast<ns>(Time::now() - startTime).count();
 
+        const bool fixedArrivalRate = FLAGS_arrival_rate > 0;
+        if (fixedArrivalRate) {
+            slog::info << "Submitting inference requests at the fixed rate of " << FLAGS_arrival_rate
+                       << " requests per second (open loop)" << slog::endl;
+        }
+
         /** Start inference & calculate performance **/
         /** to align number if iterations to guarantee that last infer requests are
          * executed in the same conditions **/
         while ((niter != 0LL && iteration < niter) ||
                (duration_nanoseconds != 0LL && (uint64_t)execTime < duration_nanoseconds) ||
-               (FLAGS_api == "async" && iteration % nireq != 0)) {
+               (FLAGS_api == "async" && !fixedArrivalRate && iteration % nireq != 0)) {
+            Time::time_point arrivalTime;
+            if (fixedArrivalRate) {
+                // the schedule does not depend on completions, a late request is accounted as queued since its
+                // scheduled time
+                arrivalTime = startTime + std::chrono::duration_cast<Time::duration>(
+                                              std::chrono::duration<double>(iteration / FLAGS_arrival_rate));
+                std::this_thread::sleep_until(arrivalTime);
+            }
             inferRequest = inferRequestsQueue.get_idle_request();
             if (!inferRequest) {
                 throw ov::Exception("No idle Infer Requests!");
             }
+            if (fixedArrivalRate) {
+                inferRequest->set_arrival_time(arrivalTime);
+            }
 
             if (!inferenceOnly) {
                 auto inputs = app_inputs_info[iteration % app_inputs_info.size()];
@@ -1194,6 +1244,23 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        const bool collectHistograms = FLAGS_latency_histogram || !FLAGS_latency_samples.empty();
+        const auto latencySamples = collectHistograms ? inferRequestsQueue.get_latency_samples()
+                                                      : std::vector<LatencySample>{};
+        std::vector<std::pair<std::string, LatencyHistogram>> stageHistograms = {{"queue", LatencyHistogram()},
+                                                                                 {"inputs", LatencyHistogram()},
+                                                                                 {"infer", LatencyHistogram()},
+                                                                                 {"callback", LatencyHistogram()},
+                                                                                 {"total", LatencyHistogram()}};
+        for (const auto& sample : latencySamples) {
+            stageHistograms[0].second.add(sample.queue);
+            stageHistograms[1].second.add(sample.inputs);
+            stageHistograms[2].second.add(sample.infer);
+            stageHistograms[3].second.add(sample.callback);
+            stageHistograms[4].second.add(sample.total());
+        }
+        const auto& totalHistogram = stageHistograms.back().second;
+
         double totalDuration = inferRequestsQueue.get_duration_in_milliseconds();
         double fps = 1000.0 * processedFramesN / totalDuration;
 
@@ -1216,6 +1283,23 @@ int main(int argc, char* argv[]) {
                      StatisticsVariant("Min latency (ms)", "latency_min", generalLatency.min),
                      StatisticsVariant("Max latency (ms)", "latency_max", generalLatency.max)});
 
+                if (FLAGS_latency_histogram) {
+                    StatisticsReport::Parameters tailParameters;
+                    for (const auto& stage : stageHistograms) {
+                        tailParameters.emplace_back("Average " + stage.first + " latency (ms)",
+                                                    "latency_" + stage.first + "_avg",
+                                                    stage.second.mean());
+                    }
+                    for (auto p : LatencyHistogram::tail_percentiles()) {
+                        std::stringstream percentile;
+                        percentile << p;
+                        tailParameters.emplace_back("End-to-end latency (" + percentile.str() + " percentile) (ms)",
+                                                    "latency_total_p" + percentile.str(),
+                                                    totalHistogram.percentile(p));
+                    }
+                    statistics->add_parameters(StatisticsReport::Category::EXECUTION_RESULTS, tailParameters);
+                }
+
                 if (FLAGS_pcseq && app_inputs_info.size() > 1) {
                     for (size_t i = 0; i < groupLatencies.size(); ++i) {
                         statistics->add_parameters(
@@ -1270,6 +1354,10 @@ int main(int argc, char* argv[]) {
         if (statistics)
             statistics->dump();
 
+        if (!FLAGS_latency_samples.empty()) {
+            dump_latency_samples(FLAGS_latency_samples, latencySamples, stageHistograms);
+        }
+
         // Performance metrics report
         try {
             auto exeDevice = compiledModel.get_property(ov::execution_devices);
@@ -1300,6 +1388,18 @@ int main(int argc, char* argv[]) {
                     groupLatencies[i].write_to_slog();
                 }
             }
+
+            if (FLAGS_latency_histogram) {
+                totalHistogram.write_to_slog("End-to-end latency histogram");
+                slog::info << "Latency breakdown (average / p99 / p99.9):" << slog::endl;
+                for (const auto& stage : stageHistograms) {
+                    std::string name = stage.first + ":";
+                    name.resize(18, ' ');
+                    slog::info << "   " << name << double_to_string(stage.second.mean()) << " / "
+                               << double_to_string(stage.second.percentile(99)) << " / "
+                               << double_to_string(stage.second.percentile(99.9)) << " ms" << slog::endl;
+                }
+            }
         }
 
         slog::info << "Throughput:          " << double_to_string(fps) << " FPS" << slog::endl;
@@ -0,0 +1,73 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface Accumulate
+ * @brief Generated by ReduceDecomposition for the reductions over the innermost dimension. Accumulates the input vector
+ *        into the output register lane by lane during the Tile iterations, the register is initialized by TileScheduler
+ *        before the Tiles. Number of the accumulated lanes is determined by "count", it is "1" for the scalar Tile.
+ *        The output keeps only one element in the innermost dimension, so the op is equivalent to the reduction
+ *        followed by Horizon.
+ * @ingroup snippets
+ */
+class Accumulate : public ngraph::op::Op {
+public:
+    OPENVINO_OP("Accumulate", "SnippetsOpset");
+
+    Accumulate(const Output<Node>& x, const size_t count = 1lu);
+    Accumulate() = default;
+
+    size_t get_count() const { return m_count; }
+
+    void set_count(const size_t count) { m_count = count; }
+
+    bool visit_attributes(AttributeVisitor& visitor) override;
+
+    void validate_and_infer_types() override;
+
+protected:
+    size_t m_count = 0lu;
+};
+
+/**
+ * @interface AccumulateMax
+ * @brief Lane-wise maximum of the accumulated values, the register is initialized with -inf
+ * @ingroup snippets
+ */
+class AccumulateMax : public Accumulate {
+public:
+    OPENVINO_OP("AccumulateMax", "SnippetsOpset", Accumulate);
+
+    AccumulateMax(const Output<Node>& x, const size_t count = 1lu) : Accumulate(x, count) {}
+    AccumulateMax() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+};
+
+/**
+ * @interface AccumulateSum
+ * @brief Lane-wise sum of the accumulated values, the register is initialized with zeros
+ * @ingroup snippets
+ */
+class AccumulateSum : public Accumulate {
+public:
+    OPENVINO_OP("AccumulateSum", "SnippetsOpset", Accumulate);
+
+    AccumulateSum(const Output<Node>& x, const size_t count = 1lu) : Accumulate(x, count) {}
+    AccumulateSum() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
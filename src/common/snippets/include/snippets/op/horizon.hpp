@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/op/op.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace op {
+
+/**
+ * @interface Horizon
+ * @brief Generated by ReduceDecomposition after Accumulate. Reduces the lanes of the accumulated register and broadcasts
+ *        the result to all the lanes. Horizon is emitted by TileScheduler between the sweeps over the innermost
+ *        dimension, see SplitIntoSweeps for details.
+ * @ingroup snippets
+ */
+class Horizon : public ngraph::op::Op {
+public:
+    OPENVINO_OP("Horizon", "SnippetsOpset");
+
+    Horizon(const Output<Node>& x);
+    Horizon() = default;
+
+    bool visit_attributes(AttributeVisitor& visitor) override { return true; }
+
+    void validate_and_infer_types() override;
+};
+
+/**
+ * @interface HorizonMax
+ * @brief Maximum over the lanes of AccumulateMax register
+ * @ingroup snippets
+ */
+class HorizonMax : public Horizon {
+public:
+    OPENVINO_OP("HorizonMax", "SnippetsOpset", Horizon);
+
+    HorizonMax(const Output<Node>& x) : Horizon(x) {}
+    HorizonMax() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+};
+
+/**
+ * @interface HorizonSum
+ * @brief Sum over the lanes of AccumulateSum register
+ * @ingroup snippets
+ */
+class HorizonSum : public Horizon {
+public:
+    OPENVINO_OP("HorizonSum", "SnippetsOpset", Horizon);
+
+    HorizonSum(const Output<Node>& x) : Horizon(x) {}
+    HorizonSum() = default;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& new_args) const override;
+};
+
+} // namespace op
+} // namespace snippets
+} // namespace ngraph
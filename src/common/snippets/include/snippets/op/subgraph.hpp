@@ -122,6 +122,10 @@ public:
         return config.m_has_type_relaxed_ops;
     }
 
+    bool has_reductions() const {
+        return config.m_has_reductions;
+    }
+
     snippets::Schedule generate(const BlockedShapeVector& output_shapes, const BlockedShapeVector& input_shapes, ngraph::pass::Manager& opt,
                                 const void* compile_params = nullptr);
     snippets::Schedule generate(const BlockedShapeVector& output_shapes, const BlockedShapeVector& input_shapes, const void* compile_params = nullptr);
@@ -167,6 +171,9 @@ private:
         // True if Subgraph contains TypeRelaxed nodes -> for several streams in tp mode we should copy body using mutexes
         // because TypeRelaxed::copy_with_new_inputs() isn't save-thread method
         bool m_has_type_relaxed_ops = false;
+        // True if Subgraph contains reductions over the innermost dimension -> the body is executed in several sweeps,
+        // so the innermost dimension can't be collapsed or blocked
+        bool m_has_reductions = false;
     } config;
 };
 
@@ -14,9 +14,10 @@ namespace op {
 
 /**
  * @interface TileScheduler
- * @brief Contains a set of Tiles (currently one vector and one scalar) and performs necessary preparations
+ * @brief Contains a set of Tiles (one vector and one scalar per sweep) and performs necessary preparations
  * before the Tiles could be executed: calculates offsets, sets proper work amounts, decrement pointers if the same data
- * have to be read several times (broadcasting).
+ * have to be read several times (broadcasting). If the body contains reductions, the region is a sequence of sweeps:
+ * the vector and the scalar Tiles of the sweep followed by the Horizon emitters executed between the sweeps.
  * @ingroup snippets
  */
 class TileScheduler : public ngraph::op::Op {
@@ -24,12 +25,12 @@ public:
     OPENVINO_OP("TileScheduler", "SnippetsOpset");
 
     TileScheduler(const AllocatedEmitter& vector_region, const AllocatedEmitter& scalar_region);
+    TileScheduler(const std::vector<AllocatedEmitter>& region);
     TileScheduler() = default;
-    AllocatedEmitter vector_region;
-    AllocatedEmitter scalar_region;
+    std::vector<AllocatedEmitter> region;
     // todo: this clone_with_new_inputs is irrelevant
     std::shared_ptr<Node> clone_with_new_inputs(const OutputVector& inputs) const override {
-        return std::make_shared<TileScheduler>(vector_region, scalar_region);
+        return std::make_shared<TileScheduler>(region);
     }
     const void *compile_params;
 };
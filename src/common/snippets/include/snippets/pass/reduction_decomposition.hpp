@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+#include <ngraph/pattern/matcher.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface SoftmaxDecomposition
+ * @brief Decomposes Softmax over the innermost dimension into the reductions and eltwise ops:
+ *        e = Exp(x - ReduceMax(x)), Softmax(x) = e / ReduceSum(e)
+ * @ingroup snippets
+ */
+class SoftmaxDecomposition: public ngraph::pass::MatcherPass {
+public:
+    SoftmaxDecomposition();
+};
+
+/**
+ * @interface MVNDecomposition
+ * @brief Decomposes MVN over the innermost dimension into the reductions and eltwise ops:
+ *        d = x - ReduceSum(x) / N, MVN(x) = d / Sqrt(ReduceSum(d * d) / N + eps) (eps inside sqrt mode)
+ * @ingroup snippets
+ */
+class MVNDecomposition: public ngraph::pass::MatcherPass {
+public:
+    MVNDecomposition();
+};
+
+/**
+ * @interface ReduceDecomposition
+ * @brief Replaces ReduceMax/ReduceSum over the innermost dimension with AccumulateMax/AccumulateSum followed by
+ *        HorizonMax/HorizonSum. Accumulate reduces the Tile iterations into one vector register lane by lane,
+ *        Horizon reduces the lanes of the register.
+ * @ingroup snippets
+ */
+class ReduceDecomposition: public ngraph::pass::MatcherPass {
+public:
+    ReduceDecomposition(const size_t count = 1lu);
+};
+
+} // namespace pass
+} // namespace snippets
+} // namespace ngraph
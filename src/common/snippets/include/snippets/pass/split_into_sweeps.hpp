@@ -0,0 +1,32 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/pass.hpp>
+
+namespace ngraph {
+namespace snippets {
+namespace pass {
+
+/**
+ * @interface SplitIntoSweeps
+ * @brief Splits the body with reductions into sweeps. Sweep is a pass of the Tiles over the innermost dimension:
+ * Horizon needs the whole row to be accumulated, so its consumers can be executed only in the next sweep.
+ * The ops needed in several sweeps (typically Loads and the eltwise ops before Accumulate) are cloned to each sweep,
+ * so the row is re-read from memory (cache) instead of being kept. Control dependencies are added so that
+ * the topological order is: ops of the sweep 0, Horizons of the sweep 0, ops of the sweep 1 and so on.
+ * Should be called after Load and Store insertion.
+ * @ingroup snippets
+ */
+class SplitIntoSweeps : public ngraph::pass::FunctionPass {
+public:
+    OPENVINO_RTTI("SplitIntoSweeps", "0");
+    SplitIntoSweeps() = default;
+    bool run_on_model(const std::shared_ptr<ov::Model>& m) override;
+};
+
+}  // namespace pass
+}  // namespace snippets
+}  // namespace ngraph
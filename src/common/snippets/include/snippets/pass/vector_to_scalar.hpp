@@ -35,6 +35,18 @@ public:
     SetScalarCountForStore();
 };
 
+/**
+ * @interface SetScalarCountForAccumulate
+ * @brief Set count `1` for Accumulate to accumulate only the first lane of the input
+ * The pass is used to change element count to accumulating to "1" since the scalar Tile loads scalar values
+ * Used for tail generation
+ * @ingroup snippets
+ */
+class SetScalarCountForAccumulate: public ngraph::pass::MatcherPass {
+public:
+    SetScalarCountForAccumulate();
+};
+
 } // namespace pass
 } // namespace snippets
 } // namespace ngraph
@@ -7,10 +7,12 @@
 #include "ngraph/ops.hpp"
 #include <ngraph/opsets/opset1.hpp>
 
+#include "op/accumulate.hpp"
 #include "op/broadcastload.hpp"
 #include "op/broadcastmove.hpp"
 #include "op/convert_saturation.hpp"
 #include "op/convert_truncation.hpp"
+#include "op/horizon.hpp"
 #include "op/kernel.hpp"
 #include "op/load.hpp"
 #include "op/nop.hpp"
@@ -19,6 +19,11 @@ NGRAPH_OP(BroadcastMove, ngraph::snippets::op)
 NGRAPH_OP(Scalar, ngraph::snippets::op)
 NGRAPH_OP(Nop, ngraph::snippets::op)
 
+NGRAPH_OP(AccumulateMax, ngraph::snippets::op)
+NGRAPH_OP(AccumulateSum, ngraph::snippets::op)
+NGRAPH_OP(HorizonMax, ngraph::snippets::op)
+NGRAPH_OP(HorizonSum, ngraph::snippets::op)
+
 // Layout-oblivious from opset1
 
 // opset completeness
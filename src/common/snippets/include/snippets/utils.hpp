@@ -23,6 +23,13 @@ inline auto is_scalar_constant(const std::shared_ptr<ngraph::Node>& source_outpu
     return ngraph::is_type<ngraph::opset1::Constant>(source_output_node) && ngraph::shape_size(source_output_node->get_shape()) == 1;
 }
 
+// Returns true if the op reduces the innermost dimension: such ops are decomposed into Accumulate and Horizon ops
+// and executed in several sweeps over the innermost dimension, look into SplitIntoSweeps for details.
+inline auto is_reduction(const std::shared_ptr<const ngraph::Node>& op) -> bool {
+    return ov::is_type<ov::op::v1::Softmax>(op) || ov::is_type<ov::op::v8::Softmax>(op) || ov::is_type<ov::op::v6::MVN>(op) ||
+           ov::is_type<ov::op::v1::ReduceSum>(op) || ov::is_type<ov::op::v1::ReduceMax>(op);
+}
+
 } // namespace utils
 } // namespace snippets
 } // namespace ngraph
\ No newline at end of file
@@ -8,10 +8,35 @@
 #include "snippets/pass/insert_load_store.hpp"
 #include "snippets/op/tile.hpp"
 #include "snippets/op/kernel.hpp"
+#include "snippets/op/horizon.hpp"
 #include <snippets/itt.hpp>
 
 #include <ngraph/pass/manager.hpp>
 
+namespace {
+// Horizon ops split the body into sweeps, look into SplitIntoSweeps for details. Returns the bodies of the sweeps,
+// the Horizons that have to be executed after the i-th sweep are stored in horizons[i]
+std::vector<std::vector<ngraph::snippets::AllocatedEmitter>> split_into_sweeps(const ngraph::NodeVector& ops,
+                                                                                const std::vector<ngraph::snippets::AllocatedEmitter>& lowered,
+                                                                                std::vector<std::vector<ngraph::snippets::AllocatedEmitter>>& horizons) {
+    std::vector<std::vector<ngraph::snippets::AllocatedEmitter>> sweeps(1);
+    horizons.assign(1, {});
+    for (size_t i = 0; i < ops.size(); i++) {
+        if (ov::is_type<ngraph::snippets::op::Horizon>(ops[i])) {
+            horizons.back().push_back(lowered[i]);
+            continue;
+        }
+        const bool is_io = ov::is_type<ov::op::v0::Parameter>(ops[i]) || ov::is_type<ov::op::v0::Result>(ops[i]);
+        if (!horizons.back().empty() && !is_io) {
+            sweeps.emplace_back();
+            horizons.emplace_back();
+        }
+        sweeps.back().push_back(lowered[i]);
+    }
+    return sweeps;
+}
+} // namespace
+
 auto ngraph::snippets::getRegisters(std::shared_ptr<ngraph::Node>& n) -> ngraph::snippets::RegInfo {
     OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::getRegisters")
     auto rt = n->get_rt_info();
@@ -62,7 +87,8 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     OV_ITT_TASK_CHAIN(GENERATE, ngraph::pass::itt::domains::SnippetsTransform, "Snippets::Generator", "::VectorTile")
     // vector tile
     std::vector<AllocatedEmitter> lowered;
-    for (auto n : m->get_ordered_ops()) {
+    const auto ops = m->get_ordered_ops();
+    for (auto n : ops) {
         lowered.emplace_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
     }
     OV_ITT_TASK_NEXT(GENERATE, "::ScalarTile")
@@ -72,25 +98,35 @@ ngraph::snippets::code ngraph::snippets::Generator::generate(std::shared_ptr<ov:
     ngraph::pass::Manager mng;
     mng.register_pass<ngraph::snippets::pass::SetScalarCountForLoad>();
     mng.register_pass<ngraph::snippets::pass::SetScalarCountForStore>();
+    mng.register_pass<ngraph::snippets::pass::SetScalarCountForAccumulate>();
     mng.run_passes(m_scalar);
     OV_ITT_TASK_NEXT(GENERATE, "::ScalarTile_get")
     std::vector<AllocatedEmitter> scalar_lowered;
-    for (auto n : m_scalar->get_ordered_ops()) {
+    const auto scalar_ops = m_scalar->get_ordered_ops();
+    for (auto n : scalar_ops) {
         scalar_lowered.emplace_back(std::make_pair(target->get(n->get_type_info())(n), ngraph::snippets::getRegisters(n)));
     }
     OV_ITT_TASK_NEXT(GENERATE, "::Tiles1D");
+    std::vector<std::vector<AllocatedEmitter>> horizons, scalar_horizons;
+    const auto sweeps = split_into_sweeps(ops, lowered, horizons);
+    const auto scalar_sweeps = split_into_sweeps(scalar_ops, scalar_lowered, scalar_horizons);
+    NGRAPH_CHECK(sweeps.size() == scalar_sweeps.size(), "Vector and scalar bodies must have the same number of sweeps");
     // wrapping into tiles1D
     //todo: in, out, and io_last_dims should derive naturally from the graph representation
-    const auto& vector_tile = std::make_shared<ngraph::snippets::op::Tile>(lowered, target->get_lanes(), in, out, io_last_dims, io_data_sizes);
-    const auto& vector_region = std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(vector_tile),
-                                   std::make_pair(std::vector<size_t>{}, std::vector<size_t>{}));
-    const auto& scalar_tile = std::make_shared<ngraph::snippets::op::Tile>(scalar_lowered, 1, in, out, io_last_dims, io_data_sizes);
-    const auto& scalar_region = std::make_pair(target->get(ngraph::snippets::op::Tile::get_type_info_static())(scalar_tile),
-                    std::make_pair(std::vector<size_t>{}, std::vector<size_t>{}));
+    std::vector<AllocatedEmitter> region;
+    for (size_t i = 0; i < sweeps.size(); i++) {
+        const auto& vector_tile = std::make_shared<ngraph::snippets::op::Tile>(sweeps[i], target->get_lanes(), in, out, io_last_dims, io_data_sizes);
+        region.emplace_back(target->get(ngraph::snippets::op::Tile::get_type_info_static())(vector_tile),
+                            std::make_pair(std::vector<size_t>{}, std::vector<size_t>{}));
+        const auto& scalar_tile = std::make_shared<ngraph::snippets::op::Tile>(scalar_sweeps[i], 1, in, out, io_last_dims, io_data_sizes);
+        region.emplace_back(target->get(ngraph::snippets::op::Tile::get_type_info_static())(scalar_tile),
+                            std::make_pair(std::vector<size_t>{}, std::vector<size_t>{}));
+        region.insert(region.end(), horizons[i].begin(), horizons[i].end());
+    }
 
     OV_ITT_TASK_NEXT(GENERATE, "::Tiles2D")
     // wrapping into tiles2D
-    auto tile_scheduler = std::make_shared<ngraph::snippets::op::TileScheduler>(vector_region, scalar_region);
+    auto tile_scheduler = std::make_shared<ngraph::snippets::op::TileScheduler>(region);
     tile_scheduler->compile_params = compile_params;
     const auto& tile_scheduler_region = std::make_pair(target->get(ngraph::snippets::op::TileScheduler::get_type_info_static())(tile_scheduler),
                                                        std::make_pair(std::vector<size_t>({in, out, target->get_lanes()}), std::vector<size_t>{}));
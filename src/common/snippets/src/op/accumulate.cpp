@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+
+#include "snippets/op/accumulate.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+snippets::op::Accumulate::Accumulate(const Output<Node>& x, const size_t count) : Op({x}), m_count(count) {
+    constructor_validate_and_infer_types();
+}
+
+bool snippets::op::Accumulate::visit_attributes(AttributeVisitor& visitor) {
+    visitor.on_attribute("count", m_count);
+    return true;
+}
+
+void snippets::op::Accumulate::validate_and_infer_types() {
+    auto output_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this, output_shape.rank().is_static() && output_shape.rank().get_length() > 0,
+                          "Accumulate expects the input of static rank greater than 0");
+    output_shape[output_shape.size() - 1] = 1;
+    set_output_type(0, get_input_element_type(0), output_shape);
+}
+
+std::shared_ptr<Node> snippets::op::AccumulateMax::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(AccumulateMax);
+    check_new_args_count(this, new_args);
+    return std::make_shared<AccumulateMax>(new_args.at(0), m_count);
+}
+
+std::shared_ptr<Node> snippets::op::AccumulateSum::clone_with_new_inputs(const OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(AccumulateSum);
+    check_new_args_count(this, new_args);
+    return std::make_shared<AccumulateSum>(new_args.at(0), m_count);
+}
@@ -16,6 +16,8 @@
 #include "snippets/pass/vector_to_scalar.hpp"
 #include "snippets/pass/transform_convert.hpp"
 #include "snippets/pass/align_element_type.hpp"
+#include "snippets/pass/reduction_decomposition.hpp"
+#include "snippets/pass/split_into_sweeps.hpp"
 #include "snippets/utils.hpp"
 
 #include "transformations/common_optimizations/nop_elimination.hpp"
@@ -51,6 +53,7 @@ snippets::op::Subgraph::Subgraph(const OutputVector& args, std::shared_ptr<ov::M
     for (const auto& op : ops) {
         config.m_is_quantized = config.m_is_quantized || ov::is_type<ov::op::v0::FakeQuantize>(op);
         config.m_has_type_relaxed_ops = config.m_has_type_relaxed_ops || std::dynamic_pointer_cast<ngraph::op::TypeRelaxedBase>(op);
+        config.m_has_reductions = config.m_has_reductions || snippets::utils::is_reduction(op);
         config.m_is_needed_to_align_precision = config.m_is_needed_to_align_precision || is_quantized() || has_type_relaxed_ops() ||
             snippets::pass::AlignElementType::opNeedsAlignElementType(op, execution_element_type);
     }
@@ -231,9 +234,10 @@ Shape snippets::op::Subgraph::canonicalize(const BlockedShapeVector& outputShape
         NODE_VALIDATION_CHECK(this,
                               PartialShape::broadcast_merge_into(tmpPShape, inShape, ::ngraph::op::AutoBroadcastType::NUMPY),
                               "Failed to create broadcastable shapes in snippets canonicalization");
-        const auto paramShape = body_ptr()->get_parameters()[i]->get_shape();
+        // the body of dynamic subgraph is reshaped to the actual static shapes
+        const auto paramShape = body_ptr()->get_parameters()[i]->get_partial_shape();
         const auto paramType =  body_ptr()->get_parameters()[i]->get_element_type();
-        if (paramShape.size() != inShape.size() || !equal(paramShape.begin(), paramShape.end(), inShape.begin()))
+        if (paramShape.is_dynamic() || paramShape.to_shape() != inShape)
                 body_ptr()->replace_parameter(i, std::make_shared<opset1::Parameter>(paramType, inShape));
     }
 
@@ -270,6 +274,16 @@ Shape snippets::op::Subgraph::canonicalize(const BlockedShapeVector& outputShape
                                                                ::ngraph::op::AutoBroadcastType::NUMPY);
         NODE_VALIDATION_CHECK(this, compatibleWithOtherOutputs, "Snippets output shapes must be numpy broadcastable");
     }
+    // The reduced dimension is iterated by the Tiles as well, so the reductions inputs define the execution domain too
+    if (has_reductions()) {
+        for (const auto& op : body_ptr()->get_ordered_ops()) {
+            if (!snippets::utils::is_reduction(op))
+                continue;
+            NODE_VALIDATION_CHECK(this, PartialShape::broadcast_merge_into(outPShape, op->get_input_shape(0),
+                                                                           ::ngraph::op::AutoBroadcastType::NUMPY),
+                                  "Snippets reduction input shapes must be numpy broadcastable to the output shapes");
+        }
+    }
 
     // We should insert Converts after Parameters and Constant and before Results
     // to align precision inside Subgraph body that is supported by Plugin
@@ -319,7 +333,8 @@ void snippets::op::Subgraph::convert_to_snippet_dialect() {
     INTERNAL_OP_SCOPE(Subgraph);
     OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::convert_to_snippet_dialect")
     auto skip_matching_domain = [](const std::shared_ptr<const ov::Node>& n) -> bool {
-        return n->get_input_shape(0).back() != 1;
+        const auto& pshape = n->get_input_partial_shape(0);
+        return pshape.rank().is_dynamic() || pshape.size() == 0 || *pshape.rbegin() != 1;
     };
 
     // At the moment we support only full vector Load/Store and scalar Load/Store so that count is equal to lanes.
@@ -327,12 +342,20 @@ void snippets::op::Subgraph::convert_to_snippet_dialect() {
     const size_t count = m_generator->get_target_machine()->get_lanes();
 
     ngraph::pass::Manager manager;
+    if (has_reductions()) {
+        manager.register_pass<snippets::pass::SoftmaxDecomposition>();
+        manager.register_pass<snippets::pass::MVNDecomposition>();
+        manager.register_pass<snippets::pass::ReduceDecomposition>(count);
+    }
     manager.register_pass<snippets::pass::ConvertConstantsToScalars>();
     manager.register_pass<snippets::pass::ConvertPowerToPowerStatic>();
     manager.register_pass<snippets::pass::InsertLoad>(count);
     manager.register_pass<snippets::pass::InsertStore>(count);
     manager.register_pass<snippets::pass::InsertMoveBroadcast>();
     manager.register_pass<snippets::pass::LoadMoveBroadcastToBroadcastLoad>();
+    if (has_reductions()) {
+        manager.register_pass<snippets::pass::SplitIntoSweeps>();
+    }
     // Note that, BrodacastMove is typically inserted right after the Load. Such cases are typical for
     // simple subgraphs where one of the ngraph::op's inputs is broadcasted to match the larger one. However, BroadcastMove
     // could also be inserted after the ngraph::op, if the op input don't need broadcasting, but the the output does
@@ -348,7 +371,9 @@ void snippets::op::Subgraph::convert_to_snippet_dialect() {
     //                         Store
     //                        Result
     // Note: Load* should be replaced with ScalarLoad in this example to avoid invalid read in vector Tile.
-    if (!exec_domain.empty() && exec_domain.back() != 1) {
+    // The same applies to the reductions results: they hold a single value per row, so they are always stored by the
+    // ScalarStores, otherwise the vector Tile writes out of the [..., 1] output.
+    if ((!exec_domain.empty() && exec_domain.back() != 1) || has_reductions()) {
         manager.register_pass<snippets::pass::SetScalarCountForLoad>();
         manager.register_pass<snippets::pass::SetScalarCountForStore>();
         manager.get_pass_config()->
@@ -6,5 +6,9 @@
 #include "snippets/generator.hpp"
 
 ngraph::snippets::op::TileScheduler::TileScheduler(const AllocatedEmitter& vector_region, const AllocatedEmitter& scalar_region)
-    : Op(), vector_region{vector_region}, scalar_region{scalar_region} {
+    : TileScheduler(std::vector<AllocatedEmitter>{vector_region, scalar_region}) {
+}
+
+ngraph::snippets::op::TileScheduler::TileScheduler(const std::vector<AllocatedEmitter>& region)
+    : Op(), region{region} {
 }
@@ -51,7 +51,9 @@ bool ngraph::snippets::pass::AlignElementType::run_on_model(const std::shared_pt
         }
 
         if (op_supports_only_exec_type(op)) {
-            for (auto i = 0; i < op->inputs().size(); i++) {
+            // reduction axes aren't data, they keep their integer type
+            const auto inputs_count = snippets::utils::is_reduction(op) ? 1 : op->inputs().size();
+            for (auto i = 0; i < inputs_count; i++) {
                 auto shared_input = op->get_input_node_shared_ptr(i);
                 auto existing_convert = ov::as_type_ptr<ov::op::v0::Convert>(shared_input);
                 // We should insert Convert before Ops, which supports only exec element type, only when:
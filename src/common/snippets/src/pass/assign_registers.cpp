@@ -12,6 +12,7 @@
 #include <ngraph/opsets/opset1.hpp>
 
 #include <iterator>
+#include <numeric>
 
 bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr<ov::Model>& f) {
     RUN_ON_MODEL_SCOPE(AssignRegisters);
@@ -77,20 +78,6 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
         }
     }
 
-    struct by_starting {
-        auto operator()(const std::pair<int, int>& lhs, const std::pair<int, int>& rhs) const -> bool {
-            return lhs.first < rhs.first|| (lhs.first == rhs.first && lhs.second < rhs.second);
-        }
-    };
-
-    struct by_ending {
-        auto operator()(const std::pair<int, int>& lhs, const std::pair<int, int>& rhs) const -> bool {
-            return lhs.second < rhs.second || (lhs.second == rhs.second && lhs.first < rhs.first);
-        }
-    };
-
-    std::set<std::pair<int, int>, by_starting> live_intervals;
-
     std::reverse(lifeIn.begin(), lifeIn.end());
     auto find_last_use = [lifeIn](int i) -> int {
         int ln = static_cast<int>(lifeIn.size()) - 1;
@@ -103,31 +90,71 @@ bool ngraph::snippets::pass::AssignRegisters::run_on_model(const std::shared_ptr
         return i;
     };
 
+    // live interval of the register is stored at its index
+    std::vector<std::pair<int, int>> live_intervals;
+    for (size_t i = 0; i < stmts.size(); i++) {
+        live_intervals.emplace_back(static_cast<int>(i), find_last_use(static_cast<int>(i)));
+    }
+
+    // Reductions split the body into sweeps: runs of statements emitted in the same Tiles and separated by Horizon ops,
+    // look into SplitIntoSweeps for details. Accumulate carries its register between the Tile iterations, so the register
+    // is occupied from the beginning of the sweep. Values defined before the sweep are used on every iteration,
+    // so their registers can't be reused till the end of the sweep.
+    std::vector<std::pair<int, int>> sweeps;
     for (size_t i = 0; i < stmts.size(); i++) {
-        live_intervals.insert(std::make_pair(static_cast<int>(i), find_last_use(static_cast<int>(i))));
+        if (ov::is_type<snippets::op::Horizon>(stmts[i]))
+            continue;
+        if (sweeps.empty() || sweeps.back().second + 1 != static_cast<int>(i))
+            sweeps.emplace_back(static_cast<int>(i), static_cast<int>(i));
+        else
+            sweeps.back().second = static_cast<int>(i);
+    }
+    for (const auto& sweep : sweeps) {
+        for (int i = sweep.first; i <= sweep.second; i++) {
+            if (ov::is_type<snippets::op::Accumulate>(stmts[i]))
+                live_intervals[i].first = sweep.first;
+            for (const auto& input : stmts[i]->inputs()) {
+                const auto reg = regs.find(input.get_tensor_ptr());
+                if (reg != regs.end() && static_cast<int>(reg->second) < sweep.first)
+                    live_intervals[reg->second].second = std::max(live_intervals[reg->second].second, sweep.second);
+            }
+        }
     }
 
+    auto by_starting = [&live_intervals](Reg lhs, Reg rhs) -> bool {
+        return live_intervals[lhs] < live_intervals[rhs] || (live_intervals[lhs] == live_intervals[rhs] && lhs < rhs);
+    };
+    auto by_ending = [&live_intervals](Reg lhs, Reg rhs) -> bool {
+        const auto& l = live_intervals[lhs];
+        const auto& r = live_intervals[rhs];
+        return l.second < r.second || (l.second == r.second && (l.first < r.first || (l.first == r.first && lhs < rhs)));
+    };
+
+    std::vector<Reg> by_start(live_intervals.size());
+    std::iota(by_start.begin(), by_start.end(), 0);
+    std::sort(by_start.begin(), by_start.end(), by_starting);
+
     // http://web.cs.ucla.edu/~palsberg/course/cs132/linearscan.pdf
-    std::multiset<std::pair<int, int>, by_ending> active;
+    std::set<Reg, decltype(by_ending)> active(by_ending);
     std::map<Reg, Reg> register_map;
     std::stack<Reg> bank;
     for (int i = 0; i < 16; i++) bank.push(16-1-i);
 
-    for (auto interval : live_intervals) {
+    for (auto interval : by_start) {
         // check expired
         while (!active.empty()) {
             auto x = *active.begin();
-            if (x.second >= interval.first) {
+            if (live_intervals[x].second >= live_intervals[interval].first) {
                 break;
             }
             active.erase(x);
-            bank.push(register_map[x.first]);
+            bank.push(register_map[x]);
         }
         // allocate
         if (active.size() == 16) {
             throw ngraph_error("caanot allocate registers for a snippet ");
         } else {
-            register_map[interval.first] = bank.top();
+            register_map[interval] = bank.top();
             bank.pop();
             active.insert(interval);
         }
@@ -33,6 +33,14 @@ namespace {
 
 auto outputs_are_not_broadcastable(const std::shared_ptr<const Node>& node) -> bool {
     auto outputs = node->outputs();
+    // Dynamic outputs must have the same shapes, since it's unknown which one is broadcasted
+    const bool has_dynamic_outputs = std::any_of(outputs.begin(), outputs.end(),
+                                                 [](const Output<const Node>& out) { return out.get_partial_shape().is_dynamic(); });
+    if (has_dynamic_outputs) {
+        const auto& ref_shape = outputs.begin()->get_partial_shape();
+        return std::any_of(outputs.begin(), outputs.end(),
+                           [&ref_shape](const Output<const Node>& out) { return out.get_partial_shape() != ref_shape; });
+    }
     auto find_smallest_output_shape = [](const std::vector<Output<const Node>>& outputs) -> Shape {
         return std::accumulate(std::begin(outputs), std::end(outputs), ngraph::Shape(outputs.begin()->get_shape()),
             [](Shape& other_shape, const Output<const Node>& output){
@@ -114,14 +122,40 @@ auto is_supported_op(const std::shared_ptr<const Node> &n) -> bool {
             || ov::is_type<ngraph::op::v4::Swish>(n)
             || ov::is_type<ngraph::op::v4::HSwish>(n);
     };
-    return is_supported_fq_op(n) || is_supported_unary_eltwise_op(n) || is_supported_binary_eltwise_op(n);
+
+    // Reductions are supported only over the innermost dimension, since they are executed as the sweeps over the rows
+    auto is_supported_reduction_op = [](const std::shared_ptr<const Node> &n) -> bool {
+        if (!utils::is_reduction(n) || n->get_input_element_type(0) != element::f32)
+            return false;
+        const auto& pshape = n->get_input_partial_shape(0);
+        if (pshape.is_dynamic() || pshape.size() == 0 || pshape.rbegin()->get_length() <= 1)
+            return false;
+        const auto rank = static_cast<int64_t>(pshape.size());
+        auto is_innermost = [rank](int64_t axis) { return axis == -1 || axis == rank - 1; };
+        if (const auto softmax = ov::as_type_ptr<const ngraph::op::v8::Softmax>(n))
+            return is_innermost(softmax->get_axis());
+        if (const auto softmax = ov::as_type_ptr<const opset1::Softmax>(n))
+            return is_innermost(static_cast<int64_t>(softmax->get_axis()));
+        const auto axes = ov::as_type_ptr<const opset1::Constant>(n->get_input_node_shared_ptr(1));
+        if (!axes)
+            return false;
+        const auto axes_values = axes->cast_vector<int64_t>();
+        if (axes_values.size() != 1 || !is_innermost(axes_values[0]))
+            return false;
+        if (const auto reduce = ov::as_type_ptr<const ngraph::op::util::ArithmeticReductionKeepDims>(n))
+            return reduce->get_keep_dims();
+        return true;
+    };
+    return is_supported_fq_op(n) || is_supported_unary_eltwise_op(n) || is_supported_binary_eltwise_op(n) ||
+           is_supported_reduction_op(n);
 }
 
 auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
     auto supported = [](descriptor::Tensor& t) -> bool {
         static const std::set<ngraph::element::Type> supported_data_types =
                 { ngraph::element::f32, ngraph::element::bf16, ngraph::element::i8, ngraph::element::u8 };
-        return t.get_partial_shape().is_static() && supported_data_types.count(t.get_element_type()) != 0;
+        // Dynamic dimensions are supported via shape-agnostic kernels, but the rank is needed for scheduling
+        return t.get_partial_shape().rank().is_static() && supported_data_types.count(t.get_element_type()) != 0;
     };
     const auto & inputs = n->inputs();
     const auto & outputs = n->outputs();
@@ -133,7 +167,11 @@ auto has_supported_in_out(const std::shared_ptr<const Node> &n) -> bool {
             }
         }
     }
-    return std::all_of(inputs.begin(), inputs.end(), [&](const Input<const Node>& in) {return  supported(in.get_tensor());}) &&
+    // reduction axes are folded by the decomposition, so they aren't read by the generated code
+    auto is_reduction_axes = [&n](const Input<const Node>& in) {
+        return in.get_index() == 1 && utils::is_reduction(n) && ov::is_type<opset1::Constant>(in.get_source_output().get_node());
+    };
+    return std::all_of(inputs.begin(), inputs.end(), [&](const Input<const Node>& in) {return is_reduction_axes(in) || supported(in.get_tensor());}) &&
            std::all_of(outputs.begin(), outputs.end(), [&](const Output<const Node>& out) {return  supported(out.get_tensor());});
 }
 
@@ -538,7 +576,11 @@ TokenizeSnippets::TokenizeSnippets() {
         }
 
         // todo: move this plugin-specific constraint to the plugin callback
-        if (body_parameters.size() + body_results.size() + hidden_non_scalar_constant_count > 12) {
+        // Shape-agnostic kernel keeps the pointer to the runtime arguments in one of the gprs available for data pointers
+        const bool is_dynamic = std::any_of(body_parameters.begin(), body_parameters.end(),
+                                            [](const std::shared_ptr<opset1::Parameter>& p) { return p->get_partial_shape().is_dynamic(); });
+        const size_t max_io_count = is_dynamic ? 11 : 12;
+        if (body_parameters.size() + body_results.size() + hidden_non_scalar_constant_count > max_io_count) {
             const std::string message_reset = "new subgraph is created. Impossible to schedule subgraph with " +
             std::to_string(body_parameters.size()) + " inputs, " + std::to_string(body_results.size()) + " outputs and " +
             std::to_string(hidden_non_scalar_constant_count) + " non-scalar constants.";
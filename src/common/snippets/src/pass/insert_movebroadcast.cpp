@@ -24,6 +24,10 @@ std::shared_ptr<ngraph::Node> broadcast_node_last_dim(const ngraph::Output<ngrap
     if (target_shape == value.get_shape()) {
         return broadcasted_node;
     }
+    // Horizon broadcasts the reduced value to all the lanes itself
+    if (ov::is_type<ngraph::snippets::op::Horizon>(broadcasted_node)) {
+        return broadcasted_node;
+    }
     // Insert BroadcastMove only if the last dimension needs to be broadcasted. Higher-level dims broadcasting
     // will be handled by pointer arithmetics in TileScheduler
     if (*target_shape.rbegin() != *normalized_shape.rbegin()) {
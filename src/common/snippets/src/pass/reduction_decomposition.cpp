@@ -0,0 +1,156 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+
+#include "snippets/pass/reduction_decomposition.hpp"
+#include "snippets/snippets_isa.hpp"
+
+#include <ngraph/opsets/opset1.hpp>
+#include <ngraph/rt_info.hpp>
+#include <ngraph/pattern/op/wrap_type.hpp>
+
+namespace {
+
+bool is_innermost_axis(int64_t axis, const ov::Rank& rank) {
+    if (rank.is_dynamic())
+        return false;
+    const auto r = rank.get_length();
+    return axis == r - 1 || axis == -1;
+}
+
+// Reduction axes must be a Constant with the only innermost axis
+bool has_innermost_axis(const std::shared_ptr<ov::Node>& node, const ov::Rank& rank) {
+    const auto axes = ov::as_type_ptr<ov::op::v0::Constant>(node->get_input_node_shared_ptr(1));
+    if (!axes)
+        return false;
+    const auto values = axes->cast_vector<int64_t>();
+    return values.size() == 1 && is_innermost_axis(values[0], rank);
+}
+
+std::shared_ptr<ov::op::v0::Constant> make_innermost_axis(const ov::Rank& rank) {
+    return ov::op::v0::Constant::create(ov::element::i64, ov::Shape{1}, {rank.get_length() - 1});
+}
+
+std::shared_ptr<ov::op::v0::Constant> make_scalar(const ov::element::Type& type, float value) {
+    return ov::op::v0::Constant::create(type, ov::Shape{}, {value});
+}
+
+} // namespace
+
+ngraph::snippets::pass::SoftmaxDecomposition::SoftmaxDecomposition() {
+    MATCHER_SCOPE(SoftmaxDecomposition);
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(
+        ngraph::pattern::wrap_type<ov::op::v1::Softmax, ov::op::v8::Softmax>(), matcher_name),
+            [this](ngraph::pattern::Matcher &m) {
+            OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::SoftmaxDecomposition")
+            auto root = m.get_match_root();
+            if (transformation_callback(root))
+                return false;
+
+            const auto rank = root->get_input_partial_shape(0).rank();
+            int64_t axis = 0;
+            if (const auto softmax_v8 = ov::as_type_ptr<ov::op::v8::Softmax>(root)) {
+                axis = softmax_v8->get_axis();
+            } else if (const auto softmax_v1 = ov::as_type_ptr<ov::op::v1::Softmax>(root)) {
+                axis = static_cast<int64_t>(softmax_v1->get_axis());
+            }
+            if (!is_innermost_axis(axis, rank))
+                return false;
+
+            const auto data = root->input_value(0);
+            const auto reduce_max = std::make_shared<ov::op::v1::ReduceMax>(data, make_innermost_axis(rank), true);
+            const auto subtract = std::make_shared<ov::op::v1::Subtract>(data, reduce_max);
+            const auto exp = std::make_shared<ov::op::v0::Exp>(subtract);
+            const auto reduce_sum = std::make_shared<ov::op::v1::ReduceSum>(exp, make_innermost_axis(rank), true);
+            const auto divide = std::make_shared<ov::op::v1::Divide>(exp, reduce_sum);
+
+            divide->set_friendly_name(root->get_friendly_name());
+            ngraph::copy_runtime_info(root, {reduce_max, subtract, exp, reduce_sum, divide});
+            ngraph::replace_node(root, divide);
+            return true;
+        });
+}
+
+ngraph::snippets::pass::MVNDecomposition::MVNDecomposition() {
+    MATCHER_SCOPE(MVNDecomposition);
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(
+        ngraph::pattern::wrap_type<ov::op::v6::MVN>(), matcher_name),
+            [this](ngraph::pattern::Matcher &m) {
+            OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::MVNDecomposition")
+            auto root = m.get_match_root();
+            if (transformation_callback(root))
+                return false;
+
+            const auto mvn = ov::as_type_ptr<ov::op::v6::MVN>(root);
+            const auto& pshape = mvn->get_input_partial_shape(0);
+            if (!has_innermost_axis(mvn, pshape.rank()) || pshape.rbegin()->is_dynamic())
+                return false;
+
+            const auto data = mvn->input_value(0);
+            const auto type = data.get_element_type();
+            const auto rank = pshape.rank();
+            const auto inv_n = make_scalar(type, 1.f / static_cast<float>(pshape.rbegin()->get_length()));
+
+            const auto sum = std::make_shared<ov::op::v1::ReduceSum>(data, make_innermost_axis(rank), true);
+            const auto mean = std::make_shared<ov::op::v1::Multiply>(sum, inv_n);
+            std::shared_ptr<ov::Node> result = std::make_shared<ov::op::v1::Subtract>(data, mean);
+            ngraph::NodeVector new_ops{sum, mean, result};
+            if (mvn->get_normalize_variance()) {
+                const auto squared = std::make_shared<ov::op::v1::Multiply>(result, result);
+                const auto squared_sum = std::make_shared<ov::op::v1::ReduceSum>(squared, make_innermost_axis(rank), true);
+                const auto variance = std::make_shared<ov::op::v1::Multiply>(squared_sum, inv_n);
+                const auto eps = make_scalar(type, mvn->get_eps());
+                std::shared_ptr<ov::Node> denominator;
+                if (mvn->get_eps_mode() == ov::op::MVNEpsMode::INSIDE_SQRT) {
+                    const auto add = std::make_shared<ov::op::v1::Add>(variance, eps);
+                    denominator = std::make_shared<ov::op::v0::Sqrt>(add);
+                    new_ops.insert(new_ops.end(), {add, denominator});
+                } else {
+                    const auto sqrt = std::make_shared<ov::op::v0::Sqrt>(variance);
+                    denominator = std::make_shared<ov::op::v1::Add>(sqrt, eps);
+                    new_ops.insert(new_ops.end(), {sqrt, denominator});
+                }
+                const auto divide = std::make_shared<ov::op::v1::Divide>(result, denominator);
+                new_ops.insert(new_ops.end(), {squared, squared_sum, variance, divide});
+                result = divide;
+            }
+
+            result->set_friendly_name(mvn->get_friendly_name());
+            ngraph::copy_runtime_info(mvn, new_ops);
+            ngraph::replace_node(mvn, result);
+            return true;
+        });
+}
+
+ngraph::snippets::pass::ReduceDecomposition::ReduceDecomposition(const size_t count) {
+    MATCHER_SCOPE(ReduceDecomposition);
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(
+        ngraph::pattern::wrap_type<ov::op::v1::ReduceMax, ov::op::v1::ReduceSum>(), matcher_name),
+            [this, count](ngraph::pattern::Matcher &m) {
+            OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::ReduceDecomposition")
+            auto root = m.get_match_root();
+            if (transformation_callback(root))
+                return false;
+
+            const auto reduce = ov::as_type_ptr<ov::op::util::ArithmeticReductionKeepDims>(root);
+            if (!reduce || !reduce->get_keep_dims() || !has_innermost_axis(reduce, reduce->get_input_partial_shape(0).rank()))
+                return false;
+
+            const auto data = reduce->input_value(0);
+            std::shared_ptr<ov::Node> accumulate, horizon;
+            if (ov::is_type<ov::op::v1::ReduceMax>(reduce)) {
+                accumulate = std::make_shared<ngraph::snippets::op::AccumulateMax>(data, count);
+                horizon = std::make_shared<ngraph::snippets::op::HorizonMax>(accumulate);
+            } else {
+                accumulate = std::make_shared<ngraph::snippets::op::AccumulateSum>(data, count);
+                horizon = std::make_shared<ngraph::snippets::op::HorizonSum>(accumulate);
+            }
+
+            horizon->set_friendly_name(reduce->get_friendly_name());
+            ngraph::copy_runtime_info(reduce, {accumulate, horizon});
+            ngraph::replace_node(reduce, horizon);
+            return true;
+        });
+}
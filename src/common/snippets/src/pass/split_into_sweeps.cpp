@@ -0,0 +1,101 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <snippets/itt.hpp>
+
+#include "snippets/pass/split_into_sweeps.hpp"
+#include "snippets/snippets_isa.hpp"
+
+#include <ngraph/rt_info.hpp>
+
+bool ngraph::snippets::pass::SplitIntoSweeps::run_on_model(const std::shared_ptr<ov::Model>& m) {
+    RUN_ON_MODEL_SCOPE(SplitIntoSweeps);
+    OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::SplitIntoSweeps")
+    const auto ops = m->get_ordered_ops();
+    if (std::none_of(ops.begin(), ops.end(), [](const std::shared_ptr<Node>& op) { return ov::is_type<snippets::op::Horizon>(op); }))
+        return false;
+
+    auto is_shared = [](const Node* op) {
+        return ov::is_type<ov::op::v0::Parameter>(op) || ov::is_type<ov::op::v0::Result>(op) || ov::is_type<snippets::op::Horizon>(op);
+    };
+
+    // the sweep where the op is computed for the first time: the next sweep after the deepest Horizon on its inputs
+    std::map<const Node*, size_t> depth;
+    for (const auto& op : ops) {
+        size_t d = 0;
+        for (const auto& input : op->input_values()) {
+            const auto parent = input.get_node();
+            d = std::max(d, depth[parent] + (ov::is_type<snippets::op::Horizon>(parent) ? 1 : 0));
+        }
+        depth[op.get()] = d;
+    }
+
+    // the sweeps where the op is needed: Store and Accumulate are the sinks of the sweep
+    std::map<const Node*, std::set<size_t>> sweeps;
+    for (auto it = ops.rbegin(); it != ops.rend(); it++) {
+        const auto op = it->get();
+        if (is_shared(op))
+            continue;
+        auto& op_sweeps = sweeps[op];
+        if (ov::is_type<snippets::op::Store>(op) || ov::is_type<snippets::op::Accumulate>(op)) {
+            op_sweeps.insert(depth[op]);
+            continue;
+        }
+        for (const auto& output : op->outputs()) {
+            for (const auto& consumer : output.get_target_inputs()) {
+                const auto child = consumer.get_node();
+                if (!is_shared(child))
+                    op_sweeps.insert(sweeps[child].begin(), sweeps[child].end());
+            }
+        }
+        if (op_sweeps.empty())
+            op_sweeps.insert(depth[op]);
+    }
+
+    // clone the ops to the sweeps, the original op is left in the first one
+    std::map<std::pair<const Node*, size_t>, std::shared_ptr<Node>> sweep_ops;
+    std::map<size_t, NodeVector> sweep_bodies;
+    std::map<size_t, NodeVector> sweep_horizons;
+    for (const auto& op : ops) {
+        if (ov::is_type<snippets::op::Horizon>(op.get()))
+            sweep_horizons[depth[op.get()]].push_back(op);
+        if (is_shared(op.get()))
+            continue;
+        const auto& op_sweeps = sweeps[op.get()];
+        for (const auto sweep : op_sweeps) {
+            OutputVector inputs;
+            for (const auto& input : op->input_values()) {
+                const auto parent = input.get_node();
+                if (is_shared(parent)) {
+                    inputs.push_back(input);
+                } else {
+                    const auto& parent_op = sweep_ops.at({parent, sweep});
+                    inputs.push_back(parent_op->output(input.get_index()));
+                }
+            }
+            std::shared_ptr<Node> sweep_op;
+            if (sweep == *op_sweeps.begin()) {
+                sweep_op = op;
+                for (size_t i = 0; i < inputs.size(); i++)
+                    op->input(i).replace_source_output(inputs[i]);
+            } else {
+                sweep_op = op->clone_with_new_inputs(inputs);
+                sweep_op->set_friendly_name(op->get_friendly_name() + "_sweep" + std::to_string(sweep));
+                ngraph::copy_runtime_info(op, sweep_op);
+            }
+            sweep_ops[{op.get(), sweep}] = sweep_op;
+            sweep_bodies[sweep].push_back(sweep_op);
+        }
+    }
+
+    for (const auto& horizons : sweep_horizons) {
+        for (const auto& horizon : horizons.second) {
+            for (const auto& op : sweep_bodies[horizons.first])
+                horizon->add_control_dependency(op);
+            for (const auto& op : sweep_bodies[horizons.first + 1])
+                op->add_control_dependency(horizon);
+        }
+    }
+    return true;
+}
@@ -47,3 +47,22 @@ ngraph::snippets::pass::SetScalarCountForStore::SetScalarCountForStore() {
             return true;
         });
 }
+
+ngraph::snippets::pass::SetScalarCountForAccumulate::SetScalarCountForAccumulate() {
+    MATCHER_SCOPE(SetScalarCountForAccumulate);
+    register_matcher(std::make_shared<ngraph::pattern::Matcher>(
+        ngraph::pattern::wrap_type<ngraph::snippets::op::Accumulate>(), matcher_name),
+            [this](ngraph::pattern::Matcher &m) {
+            OV_ITT_SCOPED_TASK(ngraph::pass::itt::domains::SnippetsTransform, "Snippets::op::SetScalarCountForAccumulate_callback")
+            auto root = m.get_match_root();
+            if (transformation_callback(root))
+                return false;
+
+            const auto accumulate = ov::as_type_ptr<ngraph::snippets::op::Accumulate>(root);
+            if (!accumulate)
+                return false;
+
+            accumulate->set_count(1lu);
+            return true;
+        });
+}
@@ -0,0 +1,83 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <ngraph/function.hpp>
+#include <ngraph/pass/manager.hpp>
+
+#include <snippets/snippets_isa.hpp>
+#include <snippets/pass/split_into_sweeps.hpp>
+#include <snippets/pass/assign_registers.hpp>
+
+using namespace testing;
+using namespace ngraph;
+
+namespace {
+size_t get_reg(const std::shared_ptr<Node>& n) {
+    return n->get_rt_info().at("reginfo").as<std::vector<size_t>>()[0];
+}
+} // namespace
+
+/* Lowered max normalization: the row is read twice, the first sweep computes the maximum and the second one subtracts it
+ *      Parameter
+ *        Load
+ *     AccumulateMax
+ *      HorizonMax
+ *  Subtract(Load, HorizonMax)
+ *        Store
+ */
+TEST(TransformationTests, SplitIntoSweeps) {
+    auto p0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 17});
+    auto load = std::make_shared<snippets::isa::Load>(p0, 8);
+    auto accumulate = std::make_shared<snippets::isa::AccumulateMax>(load, 8);
+    auto horizon = std::make_shared<snippets::isa::HorizonMax>(accumulate);
+    auto subtract = std::make_shared<opset1::Subtract>(load, horizon);
+    auto store = std::make_shared<snippets::isa::Store>(subtract, 8);
+    auto f = std::make_shared<Function>(NodeVector{store}, ParameterVector{p0});
+
+    pass::Manager m;
+    m.register_pass<snippets::pass::SplitIntoSweeps>();
+    m.register_pass<snippets::pass::AssignRegisters>();
+    m.run_passes(f);
+
+    const auto ops = f->get_ordered_ops();
+    const auto horizon_pos = std::find(ops.begin(), ops.end(), horizon);
+    ASSERT_NE(horizon_pos, ops.end());
+
+    // Load is needed in both sweeps, so it's cloned to the second one
+    std::vector<std::shared_ptr<Node>> loads;
+    std::copy_if(ops.begin(), ops.end(), std::back_inserter(loads),
+                 [](const std::shared_ptr<Node>& n) { return ov::is_type<snippets::op::Load>(n); });
+    ASSERT_EQ(loads.size(), 2);
+    EXPECT_EQ(loads[0], load);
+    EXPECT_EQ(accumulate->get_input_node_shared_ptr(0), load);
+    EXPECT_EQ(subtract->get_input_node_shared_ptr(0), loads[1]);
+
+    // The first sweep is followed by the Horizon and then by the second sweep
+    EXPECT_LT(std::find(ops.begin(), ops.end(), accumulate), horizon_pos);
+    EXPECT_GT(std::find(ops.begin(), ops.end(), loads[1]), horizon_pos);
+    EXPECT_GT(std::find(ops.begin(), ops.end(), subtract), horizon_pos);
+
+    // Accumulator lives during the whole first sweep, Horizon result lives during the whole second sweep
+    EXPECT_NE(get_reg(accumulate), get_reg(load));
+    EXPECT_NE(get_reg(horizon), get_reg(accumulate));
+    EXPECT_NE(get_reg(horizon), get_reg(loads[1]));
+    EXPECT_NE(get_reg(horizon), get_reg(subtract));
+}
+
+TEST(TransformationTests, SplitIntoSweepsWithoutReductions) {
+    auto p0 = std::make_shared<opset1::Parameter>(element::f32, Shape{2, 17});
+    auto load = std::make_shared<snippets::isa::Load>(p0, 8);
+    auto relu = std::make_shared<opset1::Relu>(load);
+    auto store = std::make_shared<snippets::isa::Store>(relu, 8);
+    auto f = std::make_shared<Function>(NodeVector{store}, ParameterVector{p0});
+    const auto ops_count = f->get_ops().size();
+
+    pass::Manager m;
+    m.register_pass<snippets::pass::SplitIntoSweeps>();
+    m.run_passes(f);
+
+    EXPECT_EQ(f->get_ops().size(), ops_count);
+}
@@ -27,11 +27,14 @@ public:
      *
      * @param output_hash_value Reference to output value. By applying hash pass on function, resulting hash value
      * will be set to this variable
+     * @param hash_constants If false, the data of Constants is not hashed, only their types, shapes and positions
+     * in the model are. It's up to the caller to hash the data then
      */
-    Hash(uint64_t& output_hash_value);
+    Hash(uint64_t& output_hash_value, bool hash_constants = true);
 
 private:
     uint64_t& m_hash;
+    bool m_hash_constants;
 };
 
 }  // namespace pass
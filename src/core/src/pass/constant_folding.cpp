@@ -54,7 +54,8 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
     RUN_ON_MODEL_SCOPE(ConstantFolding);
     bool rewritten = pre_calculated_values_folding(model);
 
-    for (const auto& node : model->get_ordered_ops()) {
+    auto ordered_ops = model->get_ordered_ops();
+    for (auto& node : ordered_ops) {
         if (rewritten) {
             node->validate_and_infer_types();
         }
@@ -91,6 +92,9 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
                 }
             }
         }
+        // The folded node is owned only by this list now. Releasing it frees the node together with the
+        // intermediate constants consumed only by it, so the peak memory does not accumulate all the folded values.
+        node.reset();
     }
 
     return rewritten;
@@ -85,12 +85,19 @@ public:
     using HashValue = size_t;
     using ConstWritePositions = std::unordered_map<HashValue, std::pair<FilePosition, void const*>>;
 
-    ConstantWriter(std::ostream& bin_data, bool enable_compression = true)
+    ConstantWriter(std::ostream& bin_data, bool enable_compression = true, bool write_data = true)
         : m_binary_output(bin_data),
           m_enable_compression(enable_compression),
+          m_write_data(write_data),
           m_blob_offset(bin_data.tellp()) {}
 
     FilePosition write(const char* ptr, size_t size) {
+        if (!m_write_data) {
+            // Only the layout of the blob is produced, the data itself is handled by the caller
+            const FilePosition offset = m_skipped_size;
+            m_skipped_size += static_cast<FilePosition>(size);
+            return offset;
+        }
         const FilePosition write_pos = m_binary_output.tellp();
         const auto offset = write_pos - m_blob_offset;
         if (!m_enable_compression) {
@@ -118,7 +125,9 @@ private:
     ConstWritePositions m_hash_to_file_positions;
     std::ostream& m_binary_output;
     bool m_enable_compression;
+    bool m_write_data;
     FilePosition m_blob_offset;  // blob offset inside output stream
+    FilePosition m_skipped_size = 0;
 };
 
 void ngfunction_2_ir(pugi::xml_node& node,
@@ -1013,7 +1022,8 @@ void serializeFunc(std::ostream& xml_file,
                    std::shared_ptr<ov::Model> f,
                    ov::pass::Serialize::Version ver,
                    const std::map<std::string, ngraph::OpSet>& custom_opsets,
-                   bool deterministic = false) {
+                   bool deterministic = false,
+                   bool write_constants = true) {
     auto version = static_cast<int64_t>(ver);
 
     auto& rt_info = f->get_rt_info();
@@ -1034,7 +1044,7 @@ void serializeFunc(std::ostream& xml_file,
     std::string name = "net";
     pugi::xml_document xml_doc;
     pugi::xml_node net_node = xml_doc.append_child(name.c_str());
-    ConstantWriter constant_write_handler(bin_file);
+    ConstantWriter constant_write_handler(bin_file, true, write_constants);
     XmlSerializer visitor(net_node, name, custom_opsets, constant_write_handler, version, deterministic);
     visitor.on_attribute(name, f);
 
@@ -1242,7 +1252,7 @@ bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& f) {
     std::ostream bin(&binHash);
 
     // Determinism is important for hash calculation
-    serializeFunc(xml, bin, f, Serialize::Version::UNSPECIFIED, {}, true);
+    serializeFunc(xml, bin, f, Serialize::Version::UNSPECIFIED, {}, true, m_hash_constants);
 
     uint64_t seed = 0;
     seed = hash_combine(seed, xmlHash.getResult());
@@ -1253,6 +1263,8 @@ bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& f) {
     return false;
 }
 
-pass::Hash::Hash(uint64_t& output_hash_value) : m_hash(output_hash_value) {}
+pass::Hash::Hash(uint64_t& output_hash_value, bool hash_constants)
+    : m_hash(output_hash_value),
+      m_hash_constants(hash_constants) {}
 
 }  // namespace ov
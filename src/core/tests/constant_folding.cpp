@@ -38,6 +38,31 @@ typename std::enable_if<std::is_integral<T>::value>::type range_test_check(const
     ASSERT_EQ(values_out, values_expected);
 }
 
+TEST(constant_folding, folded_intermediates_are_released) {
+    std::weak_ptr<Node> weak_const, weak_first_neg;
+    std::shared_ptr<Function> f;
+    {
+        auto constant = op::Constant::create(element::f32, Shape{1024}, std::vector<float>(1024, 1.f));
+        auto neg1 = std::make_shared<op::Negative>(constant);
+        auto neg2 = std::make_shared<op::Negative>(neg1);
+        auto neg3 = std::make_shared<op::Negative>(neg2);
+        f = std::make_shared<Function>(neg3, ParameterVector{});
+        weak_const = constant;
+        weak_first_neg = neg1;
+    }
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Negative>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+    // neither the original constant nor the replaced nodes are kept alive by the model
+    EXPECT_TRUE(weak_const.expired());
+    EXPECT_TRUE(weak_first_neg.expired());
+    EXPECT_EQ(get_result_constant<float>(f, 0), std::vector<float>(1024, -1.f));
+}
+
 TEST(constant_folding, acosh) {
     Shape shape_in{2, 4, 1};
 
@@ -40,7 +40,9 @@ protected:
     bool supported_impl(const std::vector<ov::Any>& variants) const override;
 
     /// \brief Reads model from file or std::istream
-    /// \param params Can be path to the model file or std::istream
+    /// \param params Can be path to the model file or std::istream, optionally followed by the weights path or
+    /// buffer and an ov::AnyMap with the weights loading options: "ENABLE_MMAP" (true by default) maps the weights file
+    /// into memory instead of reading it, "MMAP_PREFETCH" and "MMAP_SEQUENTIAL" pass the corresponding hints to the OS
     /// \return InputModel::Ptr
     InputModel::Ptr load_impl(const std::vector<ov::Any>& params) const override;
 
@@ -23,6 +23,11 @@ namespace frontend {
 namespace ir {
 namespace {
 
+// weights loading options, passed to load() in an ov::AnyMap
+const std::string enable_mmap_key = "ENABLE_MMAP";
+const std::string mmap_prefetch_key = "MMAP_PREFETCH";
+const std::string mmap_sequential_key = "MMAP_SEQUENTIAL";
+
 inline size_t GetIRVersion(pugi::xml_node& root) {
     return XMLParseUtils::GetUIntAttr(root, "version", 0);
 }
@@ -142,6 +147,9 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
     std::string weights_path, model_path;
 #endif
 
+    bool enable_mmap = true;
+    MmapHints mmap_hints;
+
     const auto& model_variant = variants.at(0);
 
     if (model_variant.is<std::string>()) {
@@ -179,6 +187,16 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
 #endif
         } else if (variant.is<std::shared_ptr<ngraph::runtime::AlignedBuffer>>()) {
             weights = variant.as<std::shared_ptr<ngraph::runtime::AlignedBuffer>>();
+        } else if (variant.is<ov::AnyMap>()) {
+            const auto& options = variant.as<ov::AnyMap>();
+            auto get_option = [&](const std::string& name, bool& value) {
+                auto it = options.find(name);
+                if (it != options.end())
+                    value = it->second.as<bool>();
+            };
+            get_option(enable_mmap_key, enable_mmap);
+            get_option(mmap_prefetch_key, mmap_hints.prefetch);
+            get_option(mmap_sequential_key, mmap_hints.sequential);
         }
     }
 
@@ -197,7 +215,18 @@ InputModel::Ptr FrontEnd::load_impl(const std::vector<ov::Any>& variants) const
             weights_path.clear();
         }
     }
-    if (!weights_path.empty()) {
+    bool mapped = false;
+    if (!weights_path.empty() && enable_mmap) {
+        // Constants are created as views of the mapped file, so the weights pages are read from disk on the first
+        // access and no heap copy is made until a transformation replaces the constant.
+        try {
+            weights = load_mmap_object(weights_path, mmap_hints);
+            mapped = true;
+        } catch (const std::exception&) {
+            // e.g. the file system doesn't support the mapping, so the file is read into memory below
+        }
+    }
+    if (!weights_path.empty() && !mapped) {
         std::ifstream bin_stream;
         bin_stream.open(weights_path, std::ios::binary);
         if (!bin_stream.is_open())
@@ -15,11 +15,21 @@
 
 namespace ov {
 
-std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::string& path);
+/**
+ * @brief Hints about the expected access to the mapped file passed to the OS
+ */
+struct MmapHints {
+    bool sequential = false;  //!< the file is read from the beginning to the end, so the readahead window is enlarged
+    bool prefetch = false;    //!< the whole file is going to be accessed, so the OS starts reading it in advance
+};
+
+std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::string& path,
+                                                                 const MmapHints& hints = MmapHints());
 
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
-std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::wstring& path);
+std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::wstring& path,
+                                                                 const MmapHints& hints = MmapHints());
 
 #endif  // OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
@@ -8,6 +8,7 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <cstring>
 #include <iostream>
 #include <sstream>
 
@@ -63,7 +64,7 @@ class MapHolder {
 public:
     MapHolder() = default;
 
-    void set(const std::string& path) {
+    void set(const std::string& path, const MmapHints& hints) {
         int prot = PROT_READ;
         int mode = O_RDONLY;
         struct stat sb = {};
@@ -77,6 +78,13 @@ public:
         if (m_size > 0) {
             m_data = mmap(nullptr, m_size, prot, MAP_PRIVATE, m_handle.get(), 0);
             OPENVINO_ASSERT(m_data != MAP_FAILED, "Can not create file mapping for ", path, ", err=", strerror(errno));
+            // the advices are not mandatory, so errors are ignored
+            if (hints.sequential) {
+                madvise(m_data, m_size, MADV_SEQUENTIAL);
+            }
+            if (hints.prefetch) {
+                madvise(m_data, m_size, MADV_WILLNEED);
+            }
         } else {
             m_data = MAP_FAILED;
         }
@@ -97,9 +105,9 @@ public:
     }
 };
 
-std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::string& path) {
+std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::string& path, const MmapHints& hints) {
     auto holder = std::make_shared<MapHolder>();
-    holder->set(path);
+    holder->set(path, hints);
     return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<MapHolder>>>(holder->data(),
                                                                                        holder->size(),
                                                                                        holder);
@@ -57,15 +57,15 @@ public:
         }
     }
 
-    void set(const std::string& path) {
-        auto h = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
-        map(path, h);
+    void set(const std::string& path, const MmapHints& hints) {
+        auto h = ::CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, file_flags(hints), 0);
+        map(path, h, hints);
     }
 
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
-    void set(const std::wstring& path) {
-        auto h = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, 0);
-        map(ov::util::wstring_to_string(path), h);
+    void set(const std::wstring& path, const MmapHints& hints) {
+        auto h = ::CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, 0, OPEN_EXISTING, file_flags(hints), 0);
+        map(ov::util::wstring_to_string(path), h, hints);
     }
 #endif
 
@@ -77,7 +77,11 @@ public:
     }
 
 private:
-    void map(const std::string& path, HANDLE h) {
+    static DWORD file_flags(const MmapHints& hints) {
+        return hints.sequential ? FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN : FILE_ATTRIBUTE_NORMAL;
+    }
+
+    void map(const std::string& path, HANDLE h, const MmapHints& hints) {
         OPENVINO_ASSERT(h != INVALID_HANDLE_VALUE,
                         "Can not open file ",
                         path,
@@ -106,6 +110,15 @@ private:
                                      0,  // offset_align & 0xffffffff,
                                      m_size);
             OPENVINO_ASSERT(m_data, "Can not create map view for ", path);
+#if (_WIN32_WINNT >= _WIN32_WINNT_WIN8)
+            // the prefetch is not mandatory, so errors are ignored
+            if (hints.prefetch) {
+                WIN32_MEMORY_RANGE_ENTRY range;
+                range.VirtualAddress = m_data;
+                range.NumberOfBytes = m_size;
+                ::PrefetchVirtualMemory(::GetCurrentProcess(), 1, &range, 0);
+            }
+#endif
         } else {
             m_data = NULL;
         }
@@ -118,9 +131,9 @@ private:
     HandleHolder m_mapping;
 };
 
-std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::string& path) {
+std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::string& path, const MmapHints& hints) {
     auto holder = std::make_shared<MapHolder>();
-    holder->set(path);
+    holder->set(path, hints);
     return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<MapHolder>>>(holder->data(),
                                                                                        holder->size(),
                                                                                        holder);
@@ -128,9 +141,9 @@ std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::stri
 
 #ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
 
-std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::wstring& path) {
+std::shared_ptr<ngraph::runtime::AlignedBuffer> load_mmap_object(const std::wstring& path, const MmapHints& hints) {
     auto holder = std::make_shared<MapHolder>();
-    holder->set(path);
+    holder->set(path, hints);
     return std::make_shared<ngraph::runtime::SharedBuffer<std::shared_ptr<MapHolder>>>(holder->data(),
                                                                                        holder->size(),
                                                                                        holder);
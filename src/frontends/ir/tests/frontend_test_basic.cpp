@@ -6,6 +6,7 @@
 #include "openvino/opsets/opset1.hpp"
 #include "openvino/opsets/opset3.hpp"
 #include "openvino/opsets/opset6.hpp"
+#include "openvino/runtime/core.hpp"
 
 class IRFrontendTests : public ::testing::Test, public IRFrontendTestsImpl {
 protected:
@@ -343,6 +344,122 @@ TEST_F(IRFrontendTests, model_with_weights_reading_from_disk) {
     EXPECT_TRUE(res.valid) << res.message;
 }
 
+TEST_F(IRFrontendTests, model_with_weights_reading_with_mmap_options) {
+    std::string xmlModel = R"V0G0N(
+<?xml version="1.0" ?>
+<net name="Network" version="11">
+    <layers>
+        <layer name="input" type="Parameter" id="0" version="opset1">
+            <data element_type="f32" shape="1,3,22,22"/>
+            <output>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="1" name="value1" type="Const" version="opset1">
+            <data element_type="i64" shape="4" offset="0" size="32" />
+            <output>
+                <port id="0" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </output>
+        </layer>
+        <layer id="2" name="Transpose0321" type="Transpose" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>3</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                </port>
+                <port id="1" precision="I64">
+                    <dim>4</dim>
+                </port>
+            </input>
+            <output>
+                <port id="2" precision="FP32">
+                    <dim>1</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                    <dim>3</dim>
+                </port>
+            </output>
+        </layer>
+        <layer name="output" type="Result" id="3" version="opset1">
+            <input>
+                <port id="0" precision="FP32">
+                    <dim>1</dim>
+                    <dim>22</dim>
+                    <dim>22</dim>
+                    <dim>3</dim>
+                </port>
+            </input>
+        </layer>
+    </layers>
+    <edges>
+        <edge from-layer="0" from-port="0" to-layer="2" to-port="0"/>
+        <edge from-layer="1" from-port="0" to-layer="2" to-port="1"/>
+        <edge from-layer="2" from-port="2" to-layer="3" to-port="0"/>
+    </edges>
+</net>
+)V0G0N";
+
+    std::vector<unsigned char> buffer(32, 0);
+    uint64_t* uint64Buffer = reinterpret_cast<uint64_t*>(buffer.data());
+    uint64Buffer[0] = 0;
+    uint64Buffer[1] = 3;
+    uint64Buffer[2] = 2;
+    uint64Buffer[3] = 1;
+
+    createTemporalModelFile(xmlModel, buffer);
+
+    auto read_with_options = [&](const ov::AnyMap& options) -> std::shared_ptr<ov::Model> {
+        ov::AnyVector params{xmlFileName, binFileName, options};
+        auto FE = manager.load_by_model(params);
+        if (!FE)
+            return nullptr;
+        auto inputModel = FE->load(params);
+        return inputModel ? FE->convert(inputModel) : nullptr;
+    };
+
+    std::shared_ptr<ov::Model> modelRef;
+    ASSERT_NO_THROW(modelRef = read_with_options({{"ENABLE_MMAP", false}}));
+    ASSERT_TRUE(!!modelRef);
+
+    const auto fc = FunctionsComparator::with_default()
+                        .enable(FunctionsComparator::ATTRIBUTES)
+                        .enable(FunctionsComparator::PRECISIONS)
+                        .enable(FunctionsComparator::RUNTIME_KEYS)
+                        .enable(FunctionsComparator::NAMES)
+                        .enable(FunctionsComparator::CONST_VALUES);
+
+    for (const auto& options : std::vector<ov::AnyMap>{{{"ENABLE_MMAP", true}},
+                                                       {{"MMAP_PREFETCH", true}, {"MMAP_SEQUENTIAL", true}}}) {
+        std::shared_ptr<ov::Model> model;
+        ASSERT_NO_THROW(model = read_with_options(options));
+        ASSERT_TRUE(!!model);
+        const auto res = fc.compare(model, modelRef);
+        EXPECT_TRUE(res.valid) << res.message;
+    }
+
+    // the option is passed by the Core to the frontend
+    ov::Core core;
+    EXPECT_TRUE(core.get_property(ov::enable_mmap));
+    std::shared_ptr<ov::Model> mappedModel, readModel;
+    ASSERT_NO_THROW(mappedModel = core.read_model(xmlFileName));
+    core.set_property(ov::enable_mmap(false));
+    EXPECT_FALSE(core.get_property(ov::enable_mmap));
+    ASSERT_NO_THROW(readModel = core.read_model(xmlFileName));
+    ASSERT_TRUE(!!mappedModel);
+    ASSERT_TRUE(!!readModel);
+    const auto res = fc.compare(mappedModel, readModel);
+    EXPECT_TRUE(res.valid) << res.message;
+}
+
 TEST_F(IRFrontendTests, model_without_weights_reading_from_disk) {
     std::string xmlModel = R"V0G0N(
 <?xml version="1.0" ?>
@@ -196,6 +196,19 @@ public:
      */
     virtual void SetCallback(Callback callback);
 
+    /**
+     * @brief Sets configuration for the current inference request, e.g. its scheduling parameters
+     * @param config Map of pairs: (config parameter name, config parameter value)
+     */
+    virtual void SetConfig(const std::map<std::string, Parameter>& config);
+
+    /**
+     * @brief Gets configuration dedicated to the inference request behaviour
+     * @param name A config key
+     * @return A value of config corresponding to config key
+     */
+    virtual Parameter GetConfig(const std::string& name) const;
+
     /**
      * @brief      Check that @p blob is valid. Throws an exception if it's not.
      *
@@ -9,8 +9,11 @@
 
 #pragma once
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 #include "threading/ie_istreams_executor.hpp"
 
@@ -20,7 +23,9 @@ namespace InferenceEngine {
  * @ingroup ie_dev_api_threading
  * @brief CPU Streams executor implementation. The executor splits the CPU into groups of threads,
  *        that can be pinned to cores or NUMA nodes.
- *        It uses custom threads to pull tasks from single queue.
+ *        Every stream thread pulls tasks from its own lock-free queue and steals them from the other streams
+ *        queues when it has nothing to do. The tasks with a priority or a deadline are shared by all the streams
+ *        and run earliest deadline first, the ones still queued when the executor is stopped are cancelled.
  */
 class INFERENCE_ENGINE_API_CLASS(CPUStreamsExecutor) : public IStreamsExecutor {
 public:
@@ -40,14 +45,33 @@ public:
      */
     ~CPUStreamsExecutor() override;
 
+    /**
+     * @brief Time the tasks executed by a stream spent in the queues
+     */
+    struct QueueWaitStatistics {
+        int streamId;
+        uint64_t executedTasks;
+        std::chrono::nanoseconds waitTime;
+    };
+
     void run(Task task) override;
 
+    void runOnStream(Task task, int streamId) override;
+
+    void runScheduled(Task task, const TaskSchedule& schedule) override;
+
     void Execute(Task task) override;
 
     int GetStreamId() override;
 
     int GetNumaNodeId() override;
 
+    /**
+     * @brief Return the queue wait time of the tasks per stream, the streams which have not executed tasks are omitted
+     * @return The statistics of every stream
+     */
+    std::vector<QueueWaitStatistics> GetQueueWaitStatistics() const;
+
 private:
     struct Impl;
     std::unique_ptr<Impl> _impl;
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <memory>
 #include <string>
 #include <vector>
@@ -104,6 +105,8 @@ public:
         int _threads_per_stream_small = 0;  //!< Threads per stream in small cores
         int _small_core_offset = 0;         //!< Calculate small core start offset when binding cpu cores
         bool _enable_hyper_thread = true;   //!< enable hyper thread
+        int _spinWaitTime = 0;              //!< Time in microseconds an idle stream thread polls the task queues
+                                            //!< before sleeping. No polling by default
         enum StreamMode { DEFAULT, AGGRESSIVE, LESSAGGRESSIVE };
         enum PreferredCoreType {
             ANY,
@@ -166,6 +169,34 @@ public:
      * @param task A task to start
      */
     virtual void Execute(Task task) = 0;
+
+    /**
+     * @brief Run the task preferably in the given stream, e.g. the one which has run the previous task of the same
+     *        request, so the stream caches are still warm. The hint may be ignored, by default the task is just run
+     * @param task A task to start
+     * @param streamId An index of the preferred stream, negative value means no preference
+     */
+    virtual void runOnStream(Task task, int streamId);
+
+    /**
+     * @brief Scheduling constraints of a task
+     */
+    struct TaskSchedule {
+        int priority = 0;  //!< The queued tasks with higher priority are run first, the negative priority tasks
+                           //!< are run when there is no other work or when their bounded share comes
+        std::chrono::steady_clock::time_point deadline =
+            std::chrono::steady_clock::time_point::max();  //!< The queued tasks of the same priority are run
+                                                           //!< earliest deadline first
+        int streamId = -1;  //!< An index of the preferred stream, see runOnStream()
+        Task cancel;        //!< Is run instead of the task if the executor is stopped before the task has started
+    };
+
+    /**
+     * @brief Run the task according to its schedule. By default only the preferred stream is taken into account
+     * @param task A task to start
+     * @param schedule The task scheduling constraints
+     */
+    virtual void runScheduled(Task task, const TaskSchedule& schedule);
 };
 
 }  // namespace InferenceEngine
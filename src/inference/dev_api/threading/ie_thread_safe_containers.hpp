@@ -7,6 +7,8 @@
 
 #include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
 #include <mutex>
 #include <queue>
 #include <type_traits>
@@ -45,6 +47,91 @@ protected:
     std::queue<T> _queue;
     std::mutex _mutex;
 };
+/**
+ * @brief Bounded multi-producer multi-consumer queue without locks (D. Vyukov's algorithm).
+ *        Every cell carries a sequence number, which tells producers and consumers whether the cell is free
+ *        or holds a value of the current lap, so the only contended operations are the head and tail increments.
+ * @tparam T A type of the stored values, should be default constructible
+ */
+template <typename T>
+class LockFreeBoundedQueue {
+public:
+    /**
+     * @param capacity The minimal number of the values the queue holds, it is rounded up to a power of two
+     */
+    explicit LockFreeBoundedQueue(std::size_t capacity) {
+        std::size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        _mask = size - 1;
+        _cells.reset(new Cell[size]);
+        for (std::size_t i = 0; i < size; ++i) {
+            _cells[i]._sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Moves the value into the queue
+     * @return false if the queue is full, the value is left untouched in this case
+     */
+    bool try_push(T&& value) {
+        auto pos = _tail.load(std::memory_order_relaxed);
+        while (true) {
+            auto& cell = _cells[pos & _mask];
+            const auto sequence = cell._sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+            if (diff == 0) {
+                if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell._value = std::move(value);
+                    cell._sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Moves the oldest value out of the queue
+     * @return false if the queue is empty or the oldest value is being pushed right now
+     */
+    bool try_pop(T& value) {
+        auto pos = _head.load(std::memory_order_relaxed);
+        while (true) {
+            auto& cell = _cells[pos & _mask];
+            const auto sequence = cell._sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    value = std::move(cell._value);
+                    // does not keep the resources owned by the moved out value
+                    cell._value = T{};
+                    cell._sequence.store(pos + _mask + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = _head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+protected:
+    struct Cell {
+        std::atomic<std::size_t> _sequence;
+        T _value;
+    };
+    std::unique_ptr<Cell[]> _cells;
+    std::size_t _mask = 0;
+    alignas(64) std::atomic<std::size_t> _head{0};
+    alignas(64) std::atomic<std::size_t> _tail{0};
+};
+
 #if ((IE_THREAD == IE_THREAD_TBB) || (IE_THREAD == IE_THREAD_TBB_AUTO))
 template <typename T>
 using ThreadSafeQueue = tbb::concurrent_queue<T>;
@@ -35,4 +35,16 @@ namespace HeteroConfigParams {
 DECLARE_HETERO_CONFIG_KEY(DUMP_GRAPH_DOT);
 
 }  // namespace HeteroConfigParams
+
+namespace Metrics {
+
+/**
+ * @brief Metric of the executable network to get a std::vector<float> of the subgraphs utilization, String value is
+ * METRIC_HETERO_SUBGRAPHS_UTILIZATION.
+ * The value in [0, 1] for each subgraph in the execution order is the share of the time the subgraph had at least one
+ * inference in progress since its first inference
+ */
+DECLARE_EXEC_NETWORK_METRIC_KEY(HETERO_SUBGRAPHS_UTILIZATION, std::vector<float>);
+
+}  // namespace Metrics
 }  // namespace InferenceEngine
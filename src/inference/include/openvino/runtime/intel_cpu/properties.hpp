@@ -49,5 +49,310 @@ static constexpr Property<bool> denormals_optimization{"CPU_DENORMALS_OPTIMIZATI
 
 static constexpr Property<float> sparse_weights_decompression_rate{"SPARSE_WEIGHTS_DECOMPRESSION_RATE"};
 
+/**
+ * @brief This property enables concurrent execution of independent graph branches inside one stream.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * When enabled, the plugin builds a dependency graph of the executable nodes at compile time and dispatches nodes
+ * whose inputs are ready onto the threading runtime task pool, so branches of wide models (e.g. Inception blocks,
+ * multi-head detectors) share the threads of the stream. The intermediate tensors of the nodes which may run
+ * concurrently don't share memory, so the memory footprint grows with the width of the branching (up to the sum of all
+ * the intermediate tensors of the parallel branches). Only static shape models are executed this way.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::parallel_branches(true));
+ * @endcode
+ */
+static constexpr Property<bool> parallel_branches{"CPU_PARALLEL_BRANCHES"};
+
+/**
+ * @brief This property makes all the streams of a compiled model share one thread safe runtime parameters cache.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * By default each stream caches the primitives and executors created for dynamic shapes on its own. With the shared
+ * cache, a primitive built by one stream is reused by the others, and concurrent requests for the same key are built once.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::shared_runtime_cache(true));
+ * @endcode
+ */
+static constexpr Property<bool> shared_runtime_cache{"CPU_SHARED_RUNTIME_CACHE"};
+
+/**
+ * @brief This property enables concurrent compilation of the graph nodes.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * When enabled (default), the supported primitive descriptors of the nodes are initialized and the primitives (oneDNN
+ * primitive descriptors iteration, JIT kernels generation) are created by the threads of the runtime concurrently, so
+ * compile_model time of large models scales with the number of cores. The descriptors selection is sequential anyway,
+ * since it depends on the neighbouring nodes.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::parallel_compilation(false));
+ * @endcode
+ */
+static constexpr Property<bool> parallel_compilation{"CPU_PARALLEL_COMPILATION"};
+
+/**
+ * @brief Read-only property to get the runtime parameters cache counters of a compiled model
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The counters ("hits", "misses", "evictions") are accumulated over the caches of all the streams.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> runtime_cache_statistics{
+    "CPU_RUNTIME_CACHE_STATISTICS"};
+
+/**
+ * @brief Read-only property to get the shape inference counters of a dynamic model
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The counters are accumulated over the graphs of all the streams:
+ * "memo_hits" and "memo_misses" count the node shape inferences served from / missed in the per-node memo of the
+ * output shapes keyed by the input shapes, "fast_path_hits" counts the inferences which skipped the shapes update
+ * entirely since the graph input shapes were the same as in the previous inference.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> shape_inference_statistics{
+    "CPU_SHAPE_INFERENCE_STATISTICS"};
+
+/**
+ * @brief This property declares the input shapes for which the runtime cache of a dynamic model is filled during
+ * compile_model, so the first inferences with these shapes do not spend time on the primitives creation.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The shape sets are separated by ';', each set lists the inputs as name[dims]. The name may be omitted for the
+ * models with a single input.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::warmup_shapes("input_ids[1,128] mask[1,128];input_ids[1,256] mask[1,256]"));
+ * @endcode
+ */
+static constexpr Property<std::string> warmup_shapes{"CPU_WARMUP_SHAPES"};
+
+/**
+ * @brief This property enables persistent storage of the input shapes met by a dynamic model in ov::cache_dir.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * On the next compilation of the same model the stored shapes are used to fill the runtime cache the same way as
+ * ov::intel_cpu::warmup_shapes does, so a restarted process does not create the primitives for the usual shapes again.
+ */
+static constexpr Property<bool> persistent_runtime_cache{"CPU_PERSISTENT_RUNTIME_CACHE"};
+
+/**
+ * @brief This property enables the memory plan of a dynamic model solved once for the shapes upper bounds.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The tensors with bounded dimensions are placed into the single statically planned arena sized for the worst case,
+ * the other dynamic tensors are grown to their upper bound size during compile_model, so the steady state inference
+ * does not allocate memory. The outputs allocated by the plugin are placed into the buffers of the upper bound size,
+ * so their data pointers stay the same from inference to inference. The bounds are taken from the model inputs partial
+ * shapes or from ov::intel_cpu::shape_upper_bounds. The input shapes exceeding the bounds are rejected. compile_model
+ * throws if the memory of the model can't be grown to the bounds.
+ */
+static constexpr Property<bool> static_memory_plan{"CPU_STATIC_MEMORY_PLAN"};
+
+/**
+ * @brief This property declares the upper bounds of the dynamic input dimensions and enables
+ * ov::intel_cpu::static_memory_plan.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The format is the same as ov::intel_cpu::warmup_shapes with a single set of shapes, the static dimensions must match
+ * the model ones. The bounds narrow the compiled graph only, the compiled model inputs and outputs keep the shapes of
+ * the original model.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::shape_upper_bounds("input_ids[8,512] mask[8,512]"));
+ * @endcode
+ */
+static constexpr Property<std::string> shape_upper_bounds{"CPU_SHAPE_UPPER_BOUNDS"};
+
+/**
+ * @brief Read-only property to get how much the resident set size of the process grew at the peak of compile_model
+ * (or import_model) relative to its value at the compilation start, in bytes
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The resident set size is sampled during the compilation, and the process high-water mark is used when the compilation
+ * raises it, so the memory used before the compilation (e.g. by read_model) is not counted and the process state
+ * (e.g. the high-water mark seen by the application) is not changed. The peaks shorter than the sampling period are
+ * missed if they do not exceed the earlier process peak. The counter is process wide: the memory allocated by
+ * the other threads during the compilation, e.g. by the concurrent compile_model calls, is counted as well.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> compile_peak_memory{"CPU_COMPILE_PEAK_MEMORY"};
+
+/**
+ * @brief Enum to define the placement of the model weights on the multi-socket systems
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+enum class WeightsNumaPolicy {
+    REPLICATE = 0,   //!< Each NUMA node keeps its own copy of the weights in the node local memory
+    INTERLEAVE = 1,  //!< A single copy of the weights is shared by all the nodes with the pages interleaved over them
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const WeightsNumaPolicy& policy) {
+    switch (policy) {
+    case WeightsNumaPolicy::REPLICATE:
+        return os << "REPLICATE";
+    case WeightsNumaPolicy::INTERLEAVE:
+        return os << "INTERLEAVE";
+    default:
+        throw ov::Exception{"Unsupported weights NUMA policy"};
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, WeightsNumaPolicy& policy) {
+    std::string str;
+    is >> str;
+    if (str == "REPLICATE") {
+        policy = WeightsNumaPolicy::REPLICATE;
+    } else if (str == "INTERLEAVE") {
+        policy = WeightsNumaPolicy::INTERLEAVE;
+    } else {
+        throw ov::Exception{"Unsupported weights NUMA policy: " + str};
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief This property defines how the weights are placed on the NUMA nodes, the streams of each node read the weights
+ * from ov::intel_cpu::WeightsNumaPolicy::REPLICATE (default) node local copies or from the single
+ * ov::intel_cpu::WeightsNumaPolicy::INTERLEAVE copy, which trades the bandwidth for the memory footprint.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::weights_numa_policy(ov::intel_cpu::WeightsNumaPolicy::INTERLEAVE));
+ * @endcode
+ */
+static constexpr Property<WeightsNumaPolicy> weights_numa_policy{"CPU_WEIGHTS_NUMA_POLICY"};
+
+/**
+ * @brief Read-only property to get the size in bytes of the weights memory resident on each NUMA node, the keys are
+ * the NUMA node ids. The key "-1" accounts the memory which placement is not reported by the OS.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> weights_memory_per_numa_node{
+    "CPU_WEIGHTS_MEMORY_PER_NUMA_NODE"};
+
+/**
+ * @brief This property enables batching of the concurrent infer requests of a model with dynamic batch dimension and
+ * defines the maximal total batch of a combined inference.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The pending requests with the same non-batch dimensions are concatenated along the batch dimension into one dynamic
+ * shape inference and the outputs are split back, so no padding is involved. The value 0 (default) disables batching.
+ *
+ * The batching is applied only to the stateless models whose inputs and outputs all have a dynamic outermost dimension
+ * marked as the batch by the layout ('N' at index 0) and which have no ops combining the data along this dimension,
+ * e.g. a reduction or a softmax over the axis 0. The requests using the preprocessing or the batched input tensors are
+ * inferred alone.
+ *
+ * @code
+ * model->get_parameters()[0]->set_layout("N...");
+ * model->get_results()[0]->set_layout("N...");
+ * core.compile_model(model, "CPU", ov::intel_cpu::dynamic_batching_max_batch(32), ov::intel_cpu::dynamic_batching_timeout(2));
+ * @endcode
+ */
+static constexpr Property<uint32_t> dynamic_batching_max_batch{"CPU_DYNAMIC_BATCHING_MAX_BATCH"};
+
+/**
+ * @brief This property defines the latency budget in milliseconds a request may wait for other requests to be batched
+ * with, see ov::intel_cpu::dynamic_batching_max_batch
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<uint32_t> dynamic_batching_timeout{"CPU_DYNAMIC_BATCHING_TIMEOUT"};
+
+/**
+ * @brief Read-only property to get the average number of infer requests combined into one inference by the dynamic
+ * batching, see ov::intel_cpu::dynamic_batching_max_batch
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<float, PropertyMutability::RO> dynamic_batching_average_batch{
+    "CPU_DYNAMIC_BATCHING_AVERAGE_BATCH"};
+
+/**
+ * @brief This property defines the time in microseconds an idle stream thread polls the task queues before sleeping
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * Polling saves the wake-up latency of the streams, which matters for the models inferred in less than a millisecond,
+ * at the cost of the CPU time burnt by the idle streams. The value 0 (default) disables polling.
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::streams_spin_wait(50));
+ * @endcode
+ */
+static constexpr Property<uint32_t> streams_spin_wait{"CPU_STREAMS_SPIN_WAIT"};
+
+/**
+ * @brief Read-only property to get the average time in nanoseconds the infer requests waited in the task queue of
+ * every stream of the compiled model, the key is the stream index
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> streams_queue_wait_time{
+    "CPU_STREAMS_QUEUE_WAIT_TIME"};
+
+/**
+ * @brief The infer request property to define the scheduling priority of the request among the queued ones
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The queued requests with higher priority are run first, the low priority requests are run when the streams have no
+ * other work to do, but still get a bounded share of the streams time to not be starved. The default is
+ * ov::hint::Priority::MEDIUM, such requests without a deadline are not scheduled at all.
+ *
+ * The property is supported by the CPU infer requests only, the AUTO, MULTI, HETERO and BATCH infer requests do not
+ * forward it to the CPU requests and throw the NotImplemented exception.
+ *
+ * @code
+ * auto request = compiled_model.create_infer_request();
+ * request.set_property(ov::intel_cpu::request_priority(ov::hint::Priority::HIGH));
+ * @endcode
+ */
+static constexpr Property<ov::hint::Priority> request_priority{"CPU_REQUEST_PRIORITY"};
+
+/**
+ * @brief The infer request property to define the time in milliseconds the request result is needed in after the
+ * start of the inference
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * The queued requests of the same priority are run earliest deadline first. The request whose deadline has passed
+ * before it left the queue fails without inference. The value 0 (default) means no deadline. Like
+ * ov::intel_cpu::request_priority, the property is supported by the CPU infer requests only.
+ *
+ * @code
+ * request.set_property(ov::intel_cpu::request_deadline(5));
+ * @endcode
+ */
+static constexpr Property<uint32_t> request_deadline{"CPU_REQUEST_DEADLINE"};
+
+/**
+ * @brief Read-only property to get the number of the infer requests of the compiled model which have missed their
+ * deadline, either rejected before the inference or finished late, see ov::intel_cpu::request_deadline
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> deadline_misses{"CPU_DEADLINE_MISSES"};
+
+/**
+ * @brief This property enables the fusion of Softmax, MVN, ReduceMax and ReduceSum over the innermost axis into the
+ * snippets subgraphs together with the adjacent eltwise operations. Disabled by default, so such operations are
+ * executed by the dedicated plugin nodes.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::snippets_reductions(true));
+ * @endcode
+ */
+static constexpr Property<bool> snippets_reductions{"CPU_SNIPPETS_REDUCTIONS"};
+
+/**
+ * @brief This property enables the fusion of the eltwise operations with dynamic shapes of static rank into the
+ * snippets subgraphs, which are executed by the shape-agnostic kernels. Disabled by default, so such operations are
+ * executed by the dedicated plugin nodes.
+ * @ingroup ov_runtime_cpu_prop_cpp_api
+ *
+ * @code
+ * core.compile_model(model, "CPU", ov::intel_cpu::snippets_dynamic_shapes(true));
+ * @endcode
+ */
+static constexpr Property<bool> snippets_dynamic_shapes{"CPU_SNIPPETS_DYNAMIC_SHAPES"};
+
 }  // namespace intel_cpu
 }  // namespace ov
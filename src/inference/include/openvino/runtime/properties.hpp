@@ -466,6 +466,46 @@ static constexpr Property<Level> level{"LOG_LEVEL"};
  */
 static constexpr Property<std::string> cache_dir{"CACHE_DIR"};
 
+/**
+ * @brief Read-write property to limit the total size of the compiled blobs stored in ov::cache_dir, in bytes.
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * When the limit is exceeded, the least recently used blobs are removed from the cache directory.
+ * The default value 0 means that the size of the cache is not limited.
+ *
+ * @code
+ * ie.set_property({ov::cache_dir("cache/"), ov::cache_size_limit(1024 * 1024 * 1024)});
+ * @endcode
+ */
+static constexpr Property<uint64_t> cache_size_limit{"CACHE_SIZE_LIMIT"};
+
+/**
+ * @brief Read-write property to enable the memory mapping of the IR weights file in ov::Core::read_model and
+ * ov::Core::compile_model from a file.
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * When enabled (default), the constants of the model point into the mapped file, so the weights are read from disk on
+ * the first access and no heap copy is made. If the file can't be mapped, it's read into memory as before.
+ *
+ * @code
+ * ie.set_property(ov::enable_mmap(false));  // read the weights into memory
+ * @endcode
+ */
+static constexpr Property<bool> enable_mmap{"ENABLE_MMAP"};
+
+/**
+ * @brief Read-only property to get the number of compiled models loaded from ov::cache_dir by the Core
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> cache_hits{"CACHE_HITS"};
+
+/**
+ * @brief Read-only property to get the number of compiled models the Core looked for in ov::cache_dir and had to
+ * compile, as they were missing or outdated there
+ * @ingroup ov_runtime_cpp_prop_api
+ */
+static constexpr Property<uint64_t, PropertyMutability::RO> cache_misses{"CACHE_MISSES"};
+
 /**
  * @brief Read-only property to provide information about a range for streams on platforms where streams are supported.
  * @ingroup ov_runtime_cpp_prop_api
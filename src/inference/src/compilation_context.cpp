@@ -7,6 +7,9 @@
 #include <sys/stat.h>
 #include <sys/types.h>
 
+#include <cstring>
+#include <fstream>
+
 #ifndef _WIN32
 #    include <unistd.h>
 #endif
@@ -16,8 +19,10 @@
 #include "details/ie_exception.hpp"
 #include "file_utils.h"
 #include "ie_itt.hpp"
+#include "ie_parallel.hpp"
 #include "ngraph/opsets/opset6.hpp"
 #include "ngraph/variant.hpp"
+#include "openvino/op/util/multi_subgraph_base.hpp"
 #include "openvino/pass/manager.hpp"
 #include "transformations/fix_rt_info.hpp"
 #include "transformations/hash.hpp"
@@ -41,6 +46,175 @@ static int32_t as_int32_t(T v) {
     return static_cast<int32_t>(v);
 }
 
+namespace {
+
+// 64-bit hash of the xxHash64 family: the data is consumed by 32-byte stripes in four independent lanes, so the
+// loop is bound by the memory bandwidth rather than by the latency of a single multiplication chain
+constexpr uint64_t prime1 = 0x9E3779B185EBCA87ULL;
+constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4FULL;
+constexpr uint64_t prime3 = 0x165667B19E3779F9ULL;
+constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ULL;
+constexpr uint64_t prime5 = 0x27D4EB2F165667C5ULL;
+
+inline uint64_t rotl(uint64_t x, int r) {
+    return (x << r) | (x >> (64 - r));
+}
+
+inline uint64_t read64(const uint8_t* p) {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint32_t read32(const uint8_t* p) {
+    uint32_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+inline uint64_t hash_round(uint64_t acc, uint64_t input) {
+    acc += input * prime2;
+    return rotl(acc, 31) * prime1;
+}
+
+inline uint64_t merge_round(uint64_t acc, uint64_t val) {
+    acc ^= hash_round(0, val);
+    return acc * prime1 + prime4;
+}
+
+uint64_t hash_data(const void* data, size_t size, uint64_t seed) {
+    auto p = static_cast<const uint8_t*>(data);
+    const uint8_t* const end = p + size;
+    uint64_t h;
+
+    if (size >= 32) {
+        const uint8_t* const limit = end - 32;
+        uint64_t v1 = seed + prime1 + prime2;
+        uint64_t v2 = seed + prime2;
+        uint64_t v3 = seed;
+        uint64_t v4 = seed - prime1;
+        do {
+            v1 = hash_round(v1, read64(p));
+            v2 = hash_round(v2, read64(p + 8));
+            v3 = hash_round(v3, read64(p + 16));
+            v4 = hash_round(v4, read64(p + 24));
+            p += 32;
+        } while (p <= limit);
+
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = merge_round(h, v1);
+        h = merge_round(h, v2);
+        h = merge_round(h, v3);
+        h = merge_round(h, v4);
+    } else {
+        h = seed + prime5;
+    }
+
+    h += static_cast<uint64_t>(size);
+    for (; p + 8 <= end; p += 8) {
+        h ^= hash_round(0, read64(p));
+        h = rotl(h, 27) * prime1 + prime4;
+    }
+    if (p + 4 <= end) {
+        h ^= static_cast<uint64_t>(read32(p)) * prime1;
+        h = rotl(h, 23) * prime2 + prime3;
+        p += 4;
+    }
+    for (; p < end; ++p) {
+        h ^= static_cast<uint64_t>(*p) * prime5;
+        h = rotl(h, 11) * prime1;
+    }
+
+    h ^= h >> 33;
+    h *= prime2;
+    h ^= h >> 29;
+    h *= prime3;
+    h ^= h >> 32;
+    return h;
+}
+
+void collect_constants(const std::shared_ptr<const ov::Model>& model,
+                       std::vector<std::shared_ptr<ov::op::v0::Constant>>& constants) {
+    for (const auto& op : model->get_ordered_ops()) {
+        if (auto constant = std::dynamic_pointer_cast<ov::op::v0::Constant>(op)) {
+            constants.push_back(constant);
+        } else if (auto sub_graph = std::dynamic_pointer_cast<ov::op::util::MultiSubGraphOp>(op)) {
+            for (size_t i = 0; i < sub_graph->get_internal_subgraphs_size(); i++) {
+                collect_constants(sub_graph->get_function(static_cast<int>(i)), constants);
+            }
+        }
+    }
+}
+
+// The data of the constants is split into the chunks which are hashed in parallel, then the hashes of the chunks
+// are combined in the order of the constants in the model
+uint64_t hash_constants(const std::shared_ptr<const ov::Model>& model, uint64_t seed) {
+    constexpr size_t chunk_size = 4 * 1024 * 1024;
+
+    struct Chunk {
+        const uint8_t* data;
+        size_t size;
+    };
+    std::vector<std::shared_ptr<ov::op::v0::Constant>> constants;
+    collect_constants(model, constants);
+
+    std::vector<Chunk> chunks;
+    for (const auto& constant : constants) {
+        const auto data = static_cast<const uint8_t*>(constant->get_data_ptr());
+        const auto size = constant->get_byte_size();
+        // an empty constant contributes to the hash too, so the data of two constants can't be shifted between them
+        chunks.push_back({data, std::min(size, chunk_size)});
+        for (size_t offset = chunk_size; offset < size; offset += chunk_size) {
+            chunks.push_back({data + offset, std::min(size - offset, chunk_size)});
+        }
+    }
+
+    std::vector<uint64_t> chunk_hashes(chunks.size());
+    parallel_for(chunks.size(), [&](size_t i) {
+        chunk_hashes[i] = hash_data(chunks[i].data, chunks[i].size, i);
+    });
+    return hash_data(chunk_hashes.data(), chunk_hashes.size() * sizeof(uint64_t), seed);
+}
+
+// The hash of the most common values is computed directly, the rest of them are printed as in serialization
+uint64_t hash_rt_info_value(uint64_t seed, const ov::Any& value, std::stringstream& strm) {
+    if (value.is<std::string>()) {
+        return hash_combine(seed, value.as<std::string>());
+    } else if (value.is<int64_t>()) {
+        return hash_combine(seed, value.as<int64_t>());
+    } else if (value.is<bool>()) {
+        return hash_combine(seed, value.as<bool>());
+    }
+    strm.str(std::string());
+    strm.clear();
+    value.print(strm);
+    return hash_combine(seed, strm.str());
+}
+
+// The content of the file is sampled at the beginning, in the middle and at the end. It's enough to detect the
+// most of the modifications which keep the size and the modification time (e.g. the files restored from an archive),
+// while the cost doesn't depend on the size of the model
+uint64_t hash_file_sample(const std::string& filePath, uint64_t fileSize, uint64_t seed) {
+    constexpr uint64_t sample_size = 4096;
+
+    std::ifstream file(filePath, std::ios::binary);
+    if (!file.is_open()) {
+        return seed;
+    }
+    std::vector<char> sample(static_cast<size_t>(std::min(fileSize, sample_size)));
+    for (const auto offset : {uint64_t(0), fileSize / 2, fileSize - sample.size()}) {
+        file.seekg(static_cast<std::streamoff>(std::min(offset, fileSize - sample.size())));
+        file.read(sample.data(), static_cast<std::streamsize>(sample.size()));
+        if (!file) {
+            return seed;
+        }
+        seed = hash_data(sample.data(), sample.size(), seed);
+    }
+    return seed;
+}
+
+}  // namespace
+
 //////////////////////////////////////////////////
 
 std::string NetworkCompilationContext::calculateFileInfo(const std::string& filePath) {
@@ -61,6 +235,7 @@ std::string NetworkCompilationContext::calculateFileInfo(const std::string& file
     if (stat(absPath.c_str(), &result) == 0) {
         seed = hash_combine(seed, result.st_mtime);
         seed = hash_combine(seed, result.st_size);
+        seed = hash_file_sample(absPath, static_cast<uint64_t>(result.st_size), seed);
     }
     return std::to_string(seed);
 }
@@ -72,12 +247,14 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
     IE_ASSERT(network.getFunction());
 
     uint64_t seed = 0;
-    // 1. Calculate hash on function
+    // 1. Calculate hash on function. The data of constants isn't passed through the serializer, it's hashed
+    // separately in parallel, as it takes the most of the time for the large models
     CNNNetwork net(network);
     ov::pass::Manager m;
     m.register_pass<ngraph::pass::FixRtInfo>();
-    m.register_pass<ov::pass::Hash>(seed);
+    m.register_pass<ov::pass::Hash>(seed, false);
     m.run_passes(net.getFunction());
+    seed = hash_constants(net.getFunction(), seed);
 
     // 2. Compute hash on serialized data and options
     for (const auto& kvp : compileOptions) {
@@ -85,13 +262,12 @@ std::string NetworkCompilationContext::computeHash(const CNNNetwork& network,
     }
 
     // 3. Add runtime information which may not be serialized
+    std::stringstream strm;
     for (const auto& op : network.getFunction()->get_ordered_ops()) {
         const auto& rt = op->get_rt_info();
         for (const auto& rtMapData : rt) {
             seed = hash_combine(seed, rtMapData.first);
-            std::stringstream strm;
-            rtMapData.second.print(strm);
-            seed = hash_combine(seed, strm.str());
+            seed = hash_rt_info_value(seed, rtMapData.second, strm);
         }
     }
 
@@ -0,0 +1,211 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ie_cache_manager.hpp"
+
+#include <sys/stat.h>
+#include <sys/types.h>
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <Windows.h>
+#    include <process.h>
+#    include <sys/utime.h>
+#else
+#    include <unistd.h>
+#    include <utime.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <ctime>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#include "ie_common.h"
+#include "ie_mapped_file.hpp"
+#include "openvino/util/file_util.hpp"
+
+#ifdef _WIN32
+#    define stat   _stat
+#    define utime  _utime
+#    define getpid _getpid
+#endif
+
+namespace InferenceEngine {
+
+namespace {
+
+/**
+ * @brief Read-only stream buffer over the memory, the data is read directly from it without intermediate buffering
+ */
+class MemoryStreamBuf final : public std::streambuf {
+public:
+    MemoryStreamBuf(const char* data, size_t size) {
+        // the get area is never written to
+        auto begin = const_cast<char*>(data);
+        setg(begin, begin, begin + size);
+    }
+
+protected:
+    pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override {
+        if (!(which & std::ios_base::in)) {
+            return pos_type(off_type(-1));
+        }
+        char* pos = dir == std::ios_base::beg ? eback() : dir == std::ios_base::cur ? gptr() : egptr();
+        if (off < eback() - pos || off > egptr() - pos) {
+            return pos_type(off_type(-1));
+        }
+        pos += off;
+        setg(eback(), pos, egptr());
+        return pos_type(off_type(pos - eback()));
+    }
+
+    pos_type seekpos(pos_type pos, std::ios_base::openmode which) override {
+        return seekoff(off_type(pos), std::ios_base::beg, which);
+    }
+};
+
+std::string getTempFile(const std::string& blobFile) {
+    // Unique for the concurrent writers of the same entry from the different processes and threads
+    std::stringstream name;
+    name << blobFile << "." << getpid() << "." << std::this_thread::get_id() << ".tmp";
+    return name.str();
+}
+
+// The temporary files older than this are left by the writers which have crashed, the younger ones might be
+// still written by the other processes
+constexpr std::chrono::hours staleTempFileAge{1};
+
+/**
+ * @brief Replaces the destination file with the source one at once, the readers which have already mapped
+ * the destination keep reading it
+ */
+bool replaceFile(const std::string& source, const std::string& destination) {
+#ifdef _WIN32
+#    ifdef OPENVINO_ENABLE_UNICODE_PATH_SUPPORT
+    return MoveFileExW(ov::util::string_to_wstring(source).c_str(),
+                       ov::util::string_to_wstring(destination).c_str(),
+                       MOVEFILE_REPLACE_EXISTING) != 0;
+#    else
+    return MoveFileExA(source.c_str(), destination.c_str(), MOVEFILE_REPLACE_EXISTING) != 0;
+#    endif
+#else
+    return std::rename(source.c_str(), destination.c_str()) == 0;
+#endif
+}
+
+}  // namespace
+
+void FileStorageCacheManager::writeCacheEntry(const std::string& id, StreamWriter writer) {
+    const auto blobFileName = getBlobFile(id);
+    const auto tempFileName = getTempFile(blobFileName);
+    {
+        std::ofstream stream(tempFileName, std::ios_base::binary | std::ofstream::out);
+        try {
+            writer(stream);
+            stream.close();
+        } catch (...) {
+            stream.close();
+            std::remove(tempFileName.c_str());
+            throw;
+        }
+        if (stream.fail()) {
+            // e.g. there is no space left on the device, the network is just not cached then
+            std::remove(tempFileName.c_str());
+            return;
+        }
+    }
+    // The complete blob replaces the old one, so the readers never see a partially written blob
+    if (!replaceFile(tempFileName, blobFileName)) {
+        std::remove(tempFileName.c_str());
+        return;
+    }
+    if (m_sizeLimit > 0) {
+        evictEntries(blobFileName);
+    }
+}
+
+void FileStorageCacheManager::readCacheEntry(const std::string& id, StreamReader reader) {
+    auto blobFileName = getBlobFile(id);
+    if (!FileUtils::fileExist(blobFileName)) {
+        return;
+    }
+    std::unique_ptr<MappedFile> blob;
+    try {
+        blob.reset(new MappedFile(blobFileName));
+    } catch (const Exception&) {
+        // e.g. the file system doesn't support mapping, the blob is read as a regular file then
+    }
+    // The modification time of the blob is the time of its last use for the eviction
+    utime(blobFileName.c_str(), nullptr);
+    if (blob) {
+        MemoryStreamBuf buffer(blob->data(), blob->size());
+        std::istream stream(&buffer);
+        reader(stream);
+    } else {
+        std::ifstream stream(blobFileName, std::ios_base::binary);
+        reader(stream);
+    }
+}
+
+void FileStorageCacheManager::removeCacheEntry(const std::string& id) {
+    auto blobFileName = getBlobFile(id);
+    if (FileUtils::fileExist(blobFileName))
+        std::remove(blobFileName.c_str());
+}
+
+void FileStorageCacheManager::evictEntries(const std::string& keptBlobFile) const {
+    struct Entry {
+        std::string file;
+        time_t lastUse;
+        uint64_t size;
+    };
+    std::vector<Entry> entries;
+    uint64_t totalSize = 0;
+    const auto staleTime = time(nullptr) - std::chrono::duration_cast<std::chrono::seconds>(staleTempFileAge).count();
+    ov::util::iterate_files(m_cachePath, [&](const std::string& file, bool isDir) {
+        struct stat info;
+        if (isDir || stat(file.c_str(), &info) != 0) {
+            return;
+        }
+        const auto ext = FileUtils::fileExt(file);
+        if (ext == "tmp" && info.st_mtime < staleTime) {
+            std::remove(file.c_str());
+            return;
+        }
+        if (ext != "blob") {
+            return;
+        }
+        entries.push_back({file, info.st_mtime, static_cast<uint64_t>(info.st_size)});
+        totalSize += static_cast<uint64_t>(info.st_size);
+    });
+    if (totalSize <= m_sizeLimit) {
+        return;
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        return a.lastUse < b.lastUse;
+    });
+    const auto keptBlobName = ov::util::get_file_name(keptBlobFile);
+    for (const auto& entry : entries) {
+        if (totalSize <= m_sizeLimit) {
+            break;
+        }
+        // The entry which has just been written is kept even if it exceeds the limit alone
+        if (ov::util::get_file_name(entry.file) == keptBlobName) {
+            continue;
+        }
+        // The entry might be removed by another process or be in use on Windows, it's skipped then
+        if (std::remove(entry.file.c_str()) == 0) {
+            totalSize -= entry.size;
+        }
+    }
+}
+
+}  // namespace InferenceEngine
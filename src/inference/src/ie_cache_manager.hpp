@@ -9,6 +9,7 @@
  */
 #pragma once
 
+#include <cstdint>
 #include <fstream>
 #include <functional>
 #include <memory>
@@ -75,22 +76,33 @@ public:
 /**
  * @brief File storage-based Implementation of ICacheManager
  *
- * Uses simple file for read/write cached models.
+ * Every cache entry is stored in a separate file in the cache directory.
+ * The entries are written to a temporary file which is renamed once it's complete, so a failure in the middle of
+ * writing never leaves a partially written blob. The entries are read through the memory mapping of the file.
+ * If the size limit is set, the least recently used entries are removed from the cache directory once the total
+ * size of the entries exceeds it. The modification time of the file is used as the time of the last use.
  *
  */
 class FileStorageCacheManager final : public ICacheManager {
     std::string m_cachePath;
+    uint64_t m_sizeLimit;
 
     std::string getBlobFile(const std::string& blobHash) const {
         return FileUtils::makePath(m_cachePath, blobHash + ".blob");
     }
 
+    void evictEntries(const std::string& keptBlobFile) const;
+
 public:
     /**
      * @brief Constructor
      *
+     * @param cachePath Path to the cache directory
+     * @param sizeLimit Limit of the total size of the entries in bytes, 0 means no limit
      */
-    FileStorageCacheManager(std::string cachePath) : m_cachePath(std::move(cachePath)) {}
+    FileStorageCacheManager(std::string cachePath, uint64_t sizeLimit = 0)
+        : m_cachePath(std::move(cachePath)),
+          m_sizeLimit(sizeLimit) {}
 
     /**
      * @brief Destructor
@@ -99,24 +111,11 @@ public:
     ~FileStorageCacheManager() override = default;
 
 private:
-    void writeCacheEntry(const std::string& id, StreamWriter writer) override {
-        std::ofstream stream(getBlobFile(id), std::ios_base::binary | std::ofstream::out);
-        writer(stream);
-    }
+    void writeCacheEntry(const std::string& id, StreamWriter writer) override;
 
-    void readCacheEntry(const std::string& id, StreamReader reader) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName)) {
-            std::ifstream stream(blobFileName, std::ios_base::binary);
-            reader(stream);
-        }
-    }
+    void readCacheEntry(const std::string& id, StreamReader reader) override;
 
-    void removeCacheEntry(const std::string& id) override {
-        auto blobFileName = getBlobFile(id);
-        if (FileUtils::fileExist(blobFileName))
-            std::remove(blobFileName.c_str());
-    }
+    void removeCacheEntry(const std::string& id) override;
 };
 
 }  // namespace InferenceEngine
@@ -6,6 +6,7 @@
 
 #include <sys/stat.h>
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -257,14 +258,27 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         };
 
         bool flag_allow_auto_batching = true;
+        bool flag_enable_mmap = true;
 
         void setAndUpdate(ov::AnyMap& config) {
-            auto it = config.find(CONFIG_KEY(CACHE_DIR));
+            auto it = config.find(ov::cache_size_limit.name());
             if (it != config.end()) {
                 std::lock_guard<std::mutex> lock(_cacheConfigMutex);
-                fillConfig(_cacheConfig, it->second.as<std::string>());
+                _cacheSizeLimit = it->second.as<uint64_t>();
+                // the cache managers are recreated to apply the limit
+                fillConfig(_cacheConfig, _cacheConfig._cacheDir, _cacheSizeLimit);
                 for (auto& deviceCfg : _cacheConfigPerDevice) {
-                    fillConfig(deviceCfg.second, it->second.as<std::string>());
+                    fillConfig(deviceCfg.second, deviceCfg.second._cacheDir, _cacheSizeLimit);
+                }
+                config.erase(it);
+            }
+
+            it = config.find(CONFIG_KEY(CACHE_DIR));
+            if (it != config.end()) {
+                std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+                fillConfig(_cacheConfig, it->second.as<std::string>(), _cacheSizeLimit);
+                for (auto& deviceCfg : _cacheConfigPerDevice) {
+                    fillConfig(deviceCfg.second, it->second.as<std::string>(), _cacheSizeLimit);
                 }
                 config.erase(it);
             }
@@ -282,11 +296,17 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                 flag_allow_auto_batching = flag;
                 config.erase(it);
             }
+
+            it = config.find(ov::enable_mmap.name());
+            if (it != config.end()) {
+                flag_enable_mmap = it->second.as<bool>();
+                config.erase(it);
+            }
         }
 
         void setCacheForDevice(const std::string& dir, const std::string& name) {
             std::lock_guard<std::mutex> lock(_cacheConfigMutex);
-            fillConfig(_cacheConfigPerDevice[name], dir);
+            fillConfig(_cacheConfigPerDevice[name], dir, _cacheSizeLimit);
         }
 
         std::string get_cache_dir() const {
@@ -294,6 +314,11 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
             return _cacheConfig._cacheDir;
         }
 
+        uint64_t get_cache_size_limit() const {
+            std::lock_guard<std::mutex> lock(_cacheConfigMutex);
+            return _cacheSizeLimit;
+        }
+
         // Creating thread-safe copy of config including shared_ptr to ICacheManager
         // Passing empty or not-existing name will return global cache config
         CacheConfig getCacheConfigForDevice(const std::string& device_name,
@@ -301,7 +326,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
                                             std::map<std::string, std::string>& parsedConfig) const {
             if (parsedConfig.count(CONFIG_KEY(CACHE_DIR))) {
                 CoreConfig::CacheConfig tempConfig;
-                CoreConfig::fillConfig(tempConfig, parsedConfig.at(CONFIG_KEY(CACHE_DIR)));
+                CoreConfig::fillConfig(tempConfig, parsedConfig.at(CONFIG_KEY(CACHE_DIR)), get_cache_size_limit());
                 if (!deviceSupportsCacheDir) {
                     parsedConfig.erase(CONFIG_KEY(CACHE_DIR));
                 }
@@ -326,11 +351,11 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         }
 
     private:
-        static void fillConfig(CacheConfig& config, const std::string& dir) {
+        static void fillConfig(CacheConfig& config, const std::string& dir, uint64_t sizeLimit) {
             config._cacheDir = dir;
             if (!dir.empty()) {
                 FileUtils::createDirectoryRecursive(dir);
-                config._cacheManager = std::make_shared<ie::FileStorageCacheManager>(dir);
+                config._cacheManager = std::make_shared<ie::FileStorageCacheManager>(dir, sizeLimit);
             } else {
                 config._cacheManager = nullptr;
             }
@@ -338,6 +363,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
 
     private:
         mutable std::mutex _cacheConfigMutex;
+        uint64_t _cacheSizeLimit = 0;
         CacheConfig _cacheConfig;
         std::map<std::string, CacheConfig> _cacheConfigPerDevice;
     };
@@ -356,6 +382,9 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
     CoreConfig coreConfig;
 
     ie::CacheGuard cacheGuard;
+    // Statistics of the loads from the cache, see ov::cache_hits and ov::cache_misses
+    mutable std::atomic<uint64_t> cacheHits{0};
+    mutable std::atomic<uint64_t> cacheMisses{0};
 
     struct PluginDescriptor {
         ov::util::FilePath libraryLocation;
@@ -449,12 +478,11 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
         return execNetwork;
     }
 
-    static ov::SoPtr<ie::IExecutableNetworkInternal> LoadNetworkFromCache(
-        const CacheContent& cacheContent,
-        ov::InferencePlugin& plugin,
-        const std::map<std::string, std::string>& config,
-        const std::shared_ptr<ie::RemoteContext>& context,
-        bool& networkIsImported) {
+    ov::SoPtr<ie::IExecutableNetworkInternal> LoadNetworkFromCache(const CacheContent& cacheContent,
+                                                                   ov::InferencePlugin& plugin,
+                                                                   const std::map<std::string, std::string>& config,
+                                                                   const std::shared_ptr<ie::RemoteContext>& context,
+                                                                   bool& networkIsImported) const {
         ov::SoPtr<ie::IExecutableNetworkInternal> execNetwork;
         struct HeaderException {};
 
@@ -494,6 +522,7 @@ class CoreImpl : public ie::ICore, public std::enable_shared_from_this<ie::ICore
             // TODO: temporary disabled by #54335. In future don't throw only for new 'blob_outdated' exception
             // throw;
         }
+        ++(networkIsImported ? cacheHits : cacheMisses);
         return execNetwork;
     }
 
@@ -658,7 +687,12 @@ public:
 
     ie::CNNNetwork ReadNetwork(const std::string& modelPath, const std::string& binPath) const override {
         OV_ITT_SCOPE(FIRST_INFERENCE, ov::itt::domains::IE_RT, "CoreImpl::ReadNetwork from file");
-        return InferenceEngine::details::ReadNetwork(modelPath, binPath, extensions, ov_extensions, newAPI);
+        return InferenceEngine::details::ReadNetwork(modelPath,
+                                                     binPath,
+                                                     extensions,
+                                                     ov_extensions,
+                                                     newAPI,
+                                                     coreConfig.flag_enable_mmap);
     }
 
     ie::CNNNetwork ReadNetwork(const std::string& model,
@@ -1032,9 +1066,17 @@ public:
             return decltype(ov::force_tbb_terminate)::value_type(flag);
         } else if (name == ov::cache_dir.name()) {
             return ov::Any(coreConfig.get_cache_dir());
+        } else if (name == ov::cache_size_limit.name()) {
+            return decltype(ov::cache_size_limit)::value_type(coreConfig.get_cache_size_limit());
+        } else if (name == ov::cache_hits.name()) {
+            return decltype(ov::cache_hits)::value_type(cacheHits.load());
+        } else if (name == ov::cache_misses.name()) {
+            return decltype(ov::cache_misses)::value_type(cacheMisses.load());
         } else if (name == ov::hint::allow_auto_batching.name()) {
             const auto flag = coreConfig.flag_allow_auto_batching;
             return decltype(ov::hint::allow_auto_batching)::value_type(flag);
+        } else if (name == ov::enable_mmap.name()) {
+            return decltype(ov::enable_mmap)::value_type(coreConfig.flag_enable_mmap);
         }
 
         IE_THROW() << "Exception is thrown while trying to call get_property with unsupported property: '" << name
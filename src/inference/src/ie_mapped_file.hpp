@@ -0,0 +1,49 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+/**
+ * @brief This is a header file for the read-only memory mapping of files
+ *
+ * @file ie_mapped_file.hpp
+ */
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace InferenceEngine {
+
+/**
+ * @brief Maps the whole file into the memory for reading. The mapping is released on destruction.
+ * The implementation is platform specific, see os/<platform>/<platform>_mapped_file.cpp
+ */
+class MappedFile final {
+    char* m_data = nullptr;
+    size_t m_size = 0;
+
+public:
+    /**
+     * @brief Maps the file, throws an exception if the file can't be opened or mapped
+     *
+     * @param path Path to the file
+     */
+    explicit MappedFile(const std::string& path);
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    ~MappedFile();
+
+    /**
+     * @brief Returns the mapped content of the file, nullptr for an empty file
+     */
+    const char* data() const noexcept {
+        return m_data;
+    }
+
+    size_t size() const noexcept {
+        return m_size;
+    }
+};
+
+}  // namespace InferenceEngine
@@ -31,6 +31,7 @@
 #include "openvino/core/deprecated.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/core/preprocess/pre_post_process.hpp"
+#include "openvino/runtime/properties.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/util/shared_object.hpp"
 #include "so_ptr.hpp"
@@ -416,7 +417,8 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath,
                                 const std::string& binPath,
                                 const std::vector<IExtensionPtr>& exts,
                                 const std::vector<ov::Extension::Ptr>& ov_exts,
-                                bool newAPI) {
+                                bool newAPI,
+                                bool enableMmap) {
 #ifdef ENABLE_IR_V7_READER
     // IR v7 obsolete code
     {
@@ -461,6 +463,9 @@ CNNNetwork details::ReadNetwork(const std::string& modelPath,
         FE->add_extension(ov_exts);
         if (!exts.empty())
             FE->add_extension(wrap_old_extensions(exts));
+        // the weights loading options are understood by the IR frontend only
+        if (FE->get_name() == "ir")
+            params.emplace_back(ov::AnyMap{{ov::enable_mmap.name(), enableMmap}});
         inputModel = FE->load(params);
     }
 
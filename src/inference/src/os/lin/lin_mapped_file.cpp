@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+
+#include "ie_common.h"
+#include "ie_mapped_file.hpp"
+
+namespace InferenceEngine {
+
+MappedFile::MappedFile(const std::string& path) {
+    const int fd = open(path.c_str(), O_RDONLY);
+    if (fd == -1) {
+        IE_THROW() << "Can not open file " << path << " for mapping";
+    }
+    struct stat sb = {};
+    if (fstat(fd, &sb) == -1) {
+        close(fd);
+        IE_THROW() << "Can not get file size for " << path;
+    }
+    m_size = static_cast<size_t>(sb.st_size);
+    if (m_size > 0) {
+        void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        const int err = errno;
+        // the mapping keeps the file alive, so the descriptor isn't needed anymore
+        close(fd);
+        if (data == MAP_FAILED) {
+            IE_THROW() << "Can not create file mapping for " << path << ", err=" << strerror(err);
+        }
+        m_data = static_cast<char*>(data);
+        // the file is expected to be read from the beginning to the end, the advice is not mandatory
+        madvise(data, m_size, MADV_SEQUENTIAL);
+    } else {
+        close(fd);
+    }
+}
+
+MappedFile::~MappedFile() {
+    if (m_data != nullptr) {
+        munmap(m_data, m_size);
+    }
+}
+
+}  // namespace InferenceEngine
@@ -0,0 +1,57 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#ifndef NOMINMAX
+#    define NOMINMAX
+#endif
+#include <windows.h>
+
+#include "ie_common.h"
+#include "ie_mapped_file.hpp"
+
+namespace InferenceEngine {
+
+MappedFile::MappedFile(const std::string& path) {
+    HANDLE file = ::CreateFileA(path.c_str(),
+                                GENERIC_READ,
+                                FILE_SHARE_READ | FILE_SHARE_DELETE,
+                                nullptr,
+                                OPEN_EXISTING,
+                                FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN,
+                                nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        IE_THROW() << "Can not open file " << path << " for mapping";
+    }
+    LARGE_INTEGER file_size;
+    if (!::GetFileSizeEx(file, &file_size)) {
+        ::CloseHandle(file);
+        IE_THROW() << "Can not get file size for " << path;
+    }
+    m_size = static_cast<size_t>(file_size.QuadPart);
+    if (m_size > 0) {
+        HANDLE mapping = ::CreateFileMapping(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        ::CloseHandle(file);
+        if (mapping == nullptr) {
+            IE_THROW() << "Can not create file mapping for " << path << ", err=" << ::GetLastError();
+        }
+        // the view keeps the mapping alive, so the handles aren't needed anymore
+        void* data = ::MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, m_size);
+        const auto err = ::GetLastError();
+        ::CloseHandle(mapping);
+        if (data == nullptr) {
+            IE_THROW() << "Can not create a map view for " << path << ", err=" << err;
+        }
+        m_data = static_cast<char*>(data);
+    } else {
+        ::CloseHandle(file);
+    }
+}
+
+MappedFile::~MappedFile() {
+    if (m_data != nullptr) {
+        ::UnmapViewOfFile(m_data);
+    }
+}
+
+}  // namespace InferenceEngine
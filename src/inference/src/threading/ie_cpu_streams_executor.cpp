@@ -4,8 +4,10 @@
 
 #include "threading/ie_cpu_streams_executor.hpp"
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <climits>
 #include <condition_variable>
 #include <memory>
@@ -22,6 +24,7 @@
 #include "threading/ie_executor_manager.hpp"
 #include "threading/ie_thread_affinity.hpp"
 #include "threading/ie_thread_local.hpp"
+#include "threading/ie_thread_safe_containers.hpp"
 
 using namespace openvino;
 
@@ -275,35 +278,239 @@ struct CPUStreamsExecutor::Impl {
             }
         }
 #endif
+        _streamWorkers = std::vector<std::atomic<int>>(static_cast<std::size_t>(std::max(_config._streams, 0)));
+        for (auto& workerIdx : _streamWorkers) {
+            workerIdx = -1;
+        }
+        for (auto streamId = 0; streamId < _config._streams; ++streamId) {
+            _workers.emplace_back(new Worker{workerQueueCapacity});
+        }
+        _urgentTasks.set_capacity(1);
+        _backgroundTasks.set_capacity(1);
         for (auto streamId = 0; streamId < _config._streams; ++streamId) {
             _threads.emplace_back([this, streamId] {
                 openvino::itt::threadName(_config._name + "_" + std::to_string(streamId));
-                for (bool stopped = false; !stopped;) {
-                    Task task;
-                    {
-                        std::unique_lock<std::mutex> lock(_mutex);
-                        _queueCondVar.wait(lock, [&] {
-                            return !_taskQueue.empty() || (stopped = _isStopped);
-                        });
-                        if (!_taskQueue.empty()) {
-                            task = std::move(_taskQueue.front());
-                            _taskQueue.pop();
-                        }
-                    }
-                    if (task) {
-                        Execute(task, *(_streams.local()));
+                Run(streamId);
+            });
+        }
+    }
+
+    // the task queue of the stream thread, other stream threads steal from it when they have nothing to do and
+    // the owner is busy with a task, so the task lands on the preferred stream whenever it is free
+    struct QueuedTask {
+        Task _task;
+        std::chrono::steady_clock::time_point _enqueueTime;
+    };
+    struct Worker {
+        explicit Worker(std::size_t queueCapacity) : _queue{queueCapacity} {}
+        LockFreeBoundedQueue<QueuedTask> _queue;
+        std::mutex _mutex;
+        std::condition_variable _condVar;
+        std::atomic<bool> _parked{false};
+        std::atomic<bool> _busy{false};
+        std::atomic<int> _streamId{-1};
+        std::atomic<uint64_t> _executedTasks{0};
+        std::atomic<uint64_t> _queueWaitTime{0};  // nanoseconds
+    };
+    static constexpr std::size_t workerQueueCapacity = 256;
+    static constexpr std::size_t backgroundTasksShare = 8;
+
+    // the tasks with a priority or a deadline are shared by all the streams and ordered by urgency
+    struct ScheduledTask {
+        QueuedTask _queued;
+        Task _cancel;
+        int _priority;
+        std::chrono::steady_clock::time_point _deadline;
+        uint64_t _sequence;
+        // the less urgent task is the greater one
+        bool operator>(const ScheduledTask& other) const {
+            if (_priority != other._priority) {
+                return _priority < other._priority;
+            }
+            if (_deadline != other._deadline) {
+                return _deadline > other._deadline;
+            }
+            return _sequence > other._sequence;
+        }
+    };
+
+    void Run(const int workerIdx) {
+        auto& worker = *_workers[workerIdx];
+        while (true) {
+            QueuedTask queued;
+            if (TryPop(workerIdx, queued)) {
+                auto& stream = *(_streams.local());
+                if (worker._streamId.load(std::memory_order_relaxed) < 0) {
+                    worker._streamId = stream._streamId;
+                    if (stream._streamId < static_cast<int>(_streamWorkers.size())) {
+                        _streamWorkers[stream._streamId] = workerIdx;
                     }
                 }
-            });
+                const auto waitTime = std::chrono::steady_clock::now() - queued._enqueueTime;
+                worker._queueWaitTime += std::chrono::duration_cast<std::chrono::nanoseconds>(waitTime).count();
+                worker._executedTasks++;
+                worker._busy = true;
+                Execute(queued._task, stream);
+                worker._busy = false;
+                continue;
+            }
+            // all the queued tasks are done or cancelled before the thread exits
+            if (_isStopped && 0 == _pendingTasks) {
+                break;
+            }
+            if (!SpinWait()) {
+                Park(worker);
+            }
+        }
+    }
+
+    // the scheduled tasks still queued when the executor is stopped are cancelled instead of being run
+    bool TryPopScheduled(ThreadSafeBoundedPriorityQueue<ScheduledTask>& tasks,
+                         std::atomic<std::size_t>& tasksNum,
+                         QueuedTask& queued) {
+        ScheduledTask scheduled;
+        if (0 == tasksNum || !tasks.try_pop(scheduled)) {
+            return false;
+        }
+        tasksNum--;
+        queued = std::move(scheduled._queued);
+        if (_isStopped) {
+            queued._task = scheduled._cancel ? std::move(scheduled._cancel) : [] {};
+        }
+        return true;
+    }
+
+    bool TryPop(const int workerIdx, QueuedTask& queued) {
+        if (0 == _pendingTasks) {
+            return false;
+        }
+        // every backgroundTasksShare-th task is a low priority one if any is queued, so they are not starved
+        bool popped = (backgroundTasksShare - 1 == _poppedTasks % backgroundTasksShare &&
+                       TryPopScheduled(_backgroundTasks, _backgroundTasksNum, queued)) ||
+                      TryPopScheduled(_urgentTasks, _urgentTasksNum, queued) ||
+                      _workers[workerIdx]->_queue.try_pop(queued);
+        if (!popped && 0 != _overflowTasks) {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
+            if (!_overflowQueue.empty()) {
+                queued = std::move(_overflowQueue.front());
+                _overflowQueue.pop();
+                _overflowTasks--;
+                popped = true;
+            }
+        }
+        for (std::size_t i = 1; !popped && i < _workers.size(); ++i) {
+            auto& victim = *_workers[(workerIdx + i) % _workers.size()];
+            popped = victim._busy && victim._queue.try_pop(queued);
+        }
+        popped = popped || TryPopScheduled(_backgroundTasks, _backgroundTasksNum, queued);
+        if (popped) {
+            _pendingTasks--;
+            _poppedTasks++;
         }
+        return popped;
     }
 
-    void Enqueue(Task task) {
-        {
-            std::lock_guard<std::mutex> lock(_mutex);
-            _taskQueue.emplace(std::move(task));
+    // returns true if a task may be available, so the thread should not sleep
+    bool SpinWait() {
+        if (_config._spinWaitTime <= 0) {
+            return false;
+        }
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::microseconds(_config._spinWaitTime);
+        do {
+            std::this_thread::yield();
+            if (0 != _pendingTasks || _isStopped) {
+                return true;
+            }
+        } while (std::chrono::steady_clock::now() < deadline);
+        return false;
+    }
+
+    // the parked flag is raised before the queues are checked and the producers check it after the task is counted,
+    // so either the thread sees the task or the producer sees the thread parked and wakes it up
+    void Park(Worker& worker) {
+        worker._parked = true;
+        if (0 != _pendingTasks || _isStopped) {
+            // the task is being pushed or its free owner is about to take it
+            worker._parked = false;
+            std::this_thread::yield();
+            return;
+        }
+        std::unique_lock<std::mutex> lock(worker._mutex);
+        worker._condVar.wait(lock, [&] {
+            return !worker._parked;
+        });
+    }
+
+    bool Wake(Worker& worker) {
+        if (!worker._parked || !worker._parked.exchange(false)) {
+            return false;
+        }
+        { std::lock_guard<std::mutex> lock(worker._mutex); }
+        worker._condVar.notify_one();
+        return true;
+    }
+
+    void Enqueue(Task task, const int preferredStreamId = -1) {
+        QueuedTask queued{std::move(task), std::chrono::steady_clock::now()};
+        int workerIdx = -1;
+        if (preferredStreamId >= 0 && preferredStreamId < static_cast<int>(_streamWorkers.size())) {
+            workerIdx = _streamWorkers[preferredStreamId];
+        }
+        if (workerIdx < 0) {
+            workerIdx = static_cast<int>(_nextWorker++ % _workers.size());
+        }
+        _pendingTasks++;
+        if (!_workers[workerIdx]->_queue.try_push(std::move(queued))) {
+            std::lock_guard<std::mutex> lock(_overflowMutex);
+            _overflowQueue.push(std::move(queued));
+            _overflowTasks++;
+        }
+        WakeFor(workerIdx);
+    }
+
+    void EnqueueScheduled(Task task, const TaskSchedule& schedule) {
+        ScheduledTask scheduled{{std::move(task), std::chrono::steady_clock::now()},
+                                schedule.cancel,
+                                schedule.priority,
+                                schedule.deadline,
+                                _sequence++};
+        int workerIdx = -1;
+        if (schedule.streamId >= 0 && schedule.streamId < static_cast<int>(_streamWorkers.size())) {
+            workerIdx = _streamWorkers[schedule.streamId];
+        }
+        _pendingTasks++;
+        if (schedule.priority < 0) {
+            _backgroundTasksNum++;
+            _backgroundTasks.try_push(std::move(scheduled));
+        } else {
+            _urgentTasksNum++;
+            _urgentTasks.try_push(std::move(scheduled));
+        }
+        WakeFor(workerIdx);
+    }
+
+    // the preferred stream takes the task if it sleeps, otherwise any sleeping stream takes or steals it
+    void WakeFor(const int workerIdx) {
+        if (workerIdx >= 0 && Wake(*_workers[workerIdx])) {
+            return;
+        }
+        for (auto& worker : _workers) {
+            if (Wake(*worker)) {
+                break;
+            }
+        }
+    }
+
+    void Stop() {
+        _isStopped = true;
+        for (auto& worker : _workers) {
+            Wake(*worker);
+        }
+        for (auto& thread : _threads) {
+            if (thread.joinable()) {
+                thread.join();
+            }
         }
-        _queueCondVar.notify_one();
     }
 
     void Execute(const Task& task, Stream& stream) {
@@ -340,10 +547,20 @@ struct CPUStreamsExecutor::Impl {
     int _streamId = 0;
     std::queue<int> _streamIdQueue;
     std::vector<std::thread> _threads;
-    std::mutex _mutex;
-    std::condition_variable _queueCondVar;
-    std::queue<Task> _taskQueue;
-    bool _isStopped = false;
+    std::vector<std::unique_ptr<Worker>> _workers;
+    std::vector<std::atomic<int>> _streamWorkers;  // the worker thread index for every stream id
+    std::atomic<std::size_t> _nextWorker{0};
+    std::atomic<std::size_t> _pendingTasks{0};
+    std::mutex _overflowMutex;
+    std::queue<QueuedTask> _overflowQueue;
+    std::atomic<std::size_t> _overflowTasks{0};
+    ThreadSafeBoundedPriorityQueue<ScheduledTask> _urgentTasks;
+    std::atomic<std::size_t> _urgentTasksNum{0};
+    ThreadSafeBoundedPriorityQueue<ScheduledTask> _backgroundTasks;
+    std::atomic<std::size_t> _backgroundTasksNum{0};
+    std::atomic<uint64_t> _sequence{0};
+    std::atomic<std::size_t> _poppedTasks{0};
+    std::atomic<bool> _isStopped{false};
     std::vector<int> _usedNumaNodes;
     ThreadLocal<std::shared_ptr<Stream>> _streams;
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -371,16 +588,7 @@ int CPUStreamsExecutor::GetNumaNodeId() {
 CPUStreamsExecutor::CPUStreamsExecutor(const IStreamsExecutor::Config& config) : _impl{new Impl{config}} {}
 
 CPUStreamsExecutor::~CPUStreamsExecutor() {
-    {
-        std::lock_guard<std::mutex> lock(_impl->_mutex);
-        _impl->_isStopped = true;
-    }
-    _impl->_queueCondVar.notify_all();
-    for (auto& thread : _impl->_threads) {
-        if (thread.joinable()) {
-            thread.join();
-        }
-    }
+    _impl->Stop();
 }
 
 void CPUStreamsExecutor::Execute(Task task) {
@@ -388,11 +596,38 @@ void CPUStreamsExecutor::Execute(Task task) {
 }
 
 void CPUStreamsExecutor::run(Task task) {
+    runOnStream(std::move(task), -1);
+}
+
+void CPUStreamsExecutor::runOnStream(Task task, int streamId) {
+    if (0 == _impl->_config._streams) {
+        _impl->Defer(std::move(task));
+    } else {
+        _impl->Enqueue(std::move(task), streamId);
+    }
+}
+
+void CPUStreamsExecutor::runScheduled(Task task, const TaskSchedule& schedule) {
     if (0 == _impl->_config._streams) {
         _impl->Defer(std::move(task));
+    } else if (0 == schedule.priority && std::chrono::steady_clock::time_point::max() == schedule.deadline) {
+        _impl->Enqueue(std::move(task), schedule.streamId);
     } else {
-        _impl->Enqueue(std::move(task));
+        _impl->EnqueueScheduled(std::move(task), schedule);
+    }
+}
+
+std::vector<CPUStreamsExecutor::QueueWaitStatistics> CPUStreamsExecutor::GetQueueWaitStatistics() const {
+    std::vector<QueueWaitStatistics> statistics;
+    for (const auto& worker : _impl->_workers) {
+        if (worker->_streamId < 0) {
+            continue;
+        }
+        statistics.push_back({worker->_streamId,
+                              worker->_executedTasks,
+                              std::chrono::nanoseconds(worker->_queueWaitTime.load())});
     }
+    return statistics;
 }
 
 }  // namespace InferenceEngine
@@ -22,6 +22,14 @@
 namespace InferenceEngine {
 IStreamsExecutor::~IStreamsExecutor() {}
 
+void IStreamsExecutor::runOnStream(Task task, int) {
+    run(std::move(task));
+}
+
+void IStreamsExecutor::runScheduled(Task task, const TaskSchedule& schedule) {
+    runOnStream(std::move(task), schedule.streamId);
+}
+
 std::vector<std::string> IStreamsExecutor::Config::SupportedKeys() const {
     return {
         CONFIG_KEY(CPU_THROUGHPUT_STREAMS),
@@ -13,6 +13,7 @@
 #include <gmock/gmock.h>
 
 #include "ie_core.hpp"
+#include "openvino/runtime/core.hpp"
 #include "ngraph/function.hpp"
 #include "ie_metric_helpers.hpp"
 #include "openvino/core/model.hpp"
@@ -542,6 +543,53 @@ TEST_P(CachingTest, TestLoad) {
     }
 }
 
+/// \brief Verifies that ov::cache_hits and ov::cache_misses count the loads of the same model from the cache
+TEST_P(CachingTest, TestCacheHitsAndMisses) {
+    if (m_remoteContext) {
+        return;  // the model is compiled for the device here
+    }
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(ov::supported_properties.name(), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_METRICS), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(IMPORT_EXPORT_SUPPORT), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(DEVICE_ARCHITECTURE), _)).Times(AnyNumber());
+    EXPECT_CALL(*mockPlugin, GetMetric(ov::device::capabilities.name(), _)).Times(AnyNumber());
+    m_post_mock_net_callbacks.emplace_back([&](MockExecutableNetwork& net) {
+        EXPECT_CALL(net, Export(_)).Times(1);
+    });
+
+    ov::Core core;
+    injectProxyEngine(mockPlugin.get());
+    core.register_plugin(ov::util::make_plugin_library_name(CommonTestUtils::getExecutableDirectory(),
+        std::string("mock_engine") + IE_BUILD_POSTFIX), deviceName);
+    core.set_property(ov::cache_dir(m_cacheDir));
+    auto compile = [&]() {
+        if (m_type == TestLoadType::EModelName) {
+            core.compile_model(modelName, deviceToLoad);
+        } else {
+            core.compile_model(core.read_model(modelName), deviceToLoad);
+        }
+    };
+
+    {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(1);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(0);
+        compile();
+        EXPECT_EQ(core.get_property("", ov::cache_hits), 0u);
+        EXPECT_EQ(core.get_property("", ov::cache_misses), 1u);
+    }
+
+    {
+        EXPECT_CALL(*mockPlugin, LoadExeNetworkImpl(_, _)).Times(0);
+        EXPECT_CALL(*mockPlugin, ImportNetwork(_, _)).Times(1);
+        compile();
+        EXPECT_EQ(core.get_property("", ov::cache_hits), 1u);
+        EXPECT_EQ(core.get_property("", ov::cache_misses), 1u);
+    }
+    EXPECT_EQ(networks.size(), 1);
+    core.unload_plugin(deviceName);
+}
+
 /// \brief Verifies that ie.SetConfig({{"CACHE_DIR", <dir>}}, "deviceName"}}); enables caching for one device
 TEST_P(CachingTest, TestLoad_by_device_name) {
     EXPECT_CALL(*mockPlugin, GetMetric(METRIC_KEY(SUPPORTED_CONFIG_KEYS), _)).Times(AnyNumber());
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
 #include <future>
 
 #include <gtest/gtest.h>
@@ -187,6 +188,149 @@ TEST_P(ASyncTaskExecutorTests, runAndWaitDoesNotOwnTasks) {
     ASSERT_EQ(1, useCount);
 }
 
+TEST(CPUStreamsExecutorTests, queueWaitStatisticsCountAllTasks) {
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"TestCPUStreamsExecutor", 4, 1}};
+    std::vector<std::future<void>> futures;
+    for (int i = 0; i < MAX_NUMBER_OF_TASKS_IN_QUEUE; i++) {
+        auto task = std::make_shared<std::packaged_task<void()>>([] {});
+        futures.emplace_back(task->get_future());
+        // the stream preference is only a hint, out of range one is ignored
+        executor.runOnStream([task] {(*task)();}, i - 1);
+    }
+    for (auto& f : futures) {
+        f.wait();
+    }
+
+    uint64_t executedTasks = 0;
+    for (const auto& item : executor.GetQueueWaitStatistics()) {
+        EXPECT_GE(item.streamId, 0);
+        executedTasks += item.executedTasks;
+    }
+    ASSERT_EQ(MAX_NUMBER_OF_TASKS_IN_QUEUE, executedTasks);
+}
+
+TEST(CPUStreamsExecutorTests, scheduledTasksRunByPriorityAndEarliestDeadline) {
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1}};
+    // the only stream is blocked until all the tasks are queued
+    std::promise<void> unblock;
+    std::promise<void> blocked;
+    auto blockedFuture = blocked.get_future();
+    auto unblockFuture = unblock.get_future().share();
+    executor.run([&blocked, unblockFuture] {
+        blocked.set_value();
+        unblockFuture.wait();
+    });
+    blockedFuture.wait();
+
+    std::mutex mutex;
+    std::vector<std::string> order;
+    const auto now = std::chrono::steady_clock::now();
+    auto schedule = [&](const std::string& name, int priority, int deadline) {
+        IStreamsExecutor::TaskSchedule taskSchedule;
+        taskSchedule.priority = priority;
+        if (deadline)
+            taskSchedule.deadline = now + std::chrono::milliseconds(deadline);
+        executor.runScheduled([&, name] {
+            std::lock_guard<std::mutex> lock{mutex};
+            order.push_back(name);
+        }, taskSchedule);
+    };
+    schedule("fifo", 0, 0);
+    schedule("low", -1, 0);
+    schedule("deadline30", 0, 30);
+    schedule("deadline10", 0, 10);
+    schedule("high", 1, 0);
+
+    std::promise<void> done;
+    IStreamsExecutor::TaskSchedule last;
+    last.priority = -1;
+    executor.runScheduled([&done] {
+        done.set_value();
+    }, last);
+    unblock.set_value();
+    done.get_future().wait();
+
+    ASSERT_EQ((std::vector<std::string>{"high", "deadline10", "deadline30", "fifo", "low"}), order);
+}
+
+TEST(CPUStreamsExecutorTests, lowPriorityTasksAreNotStarved) {
+    CPUStreamsExecutor executor{IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1}};
+    std::promise<void> unblock;
+    std::promise<void> blocked;
+    auto blockedFuture = blocked.get_future();
+    auto unblockFuture = unblock.get_future().share();
+    executor.run([&blocked, unblockFuture] {
+        blocked.set_value();
+        unblockFuture.wait();
+    });
+    blockedFuture.wait();
+
+    std::mutex mutex;
+    std::vector<int> order;
+    auto schedule = [&](int priority) {
+        IStreamsExecutor::TaskSchedule taskSchedule;
+        taskSchedule.priority = priority;
+        executor.runScheduled([&, priority] {
+            std::lock_guard<std::mutex> lock{mutex};
+            order.push_back(priority);
+        }, taskSchedule);
+    };
+    schedule(-1);
+    const int highTasksNum = 32;
+    for (int i = 0; i < highTasksNum; i++) {
+        schedule(1);
+    }
+
+    std::promise<void> done;
+    IStreamsExecutor::TaskSchedule last;
+    last.priority = -1;
+    executor.runScheduled([&done] {
+        done.set_value();
+    }, last);
+    unblock.set_value();
+    done.get_future().wait();
+
+    ASSERT_EQ(highTasksNum + 1, order.size());
+    const auto lowTaskIdx = std::find(order.begin(), order.end(), -1) - order.begin();
+    ASSERT_LT(lowTaskIdx, 8);
+}
+
+TEST(CPUStreamsExecutorTests, scheduledTasksAreCancelledOnStop) {
+    std::unique_ptr<CPUStreamsExecutor> executor{
+        new CPUStreamsExecutor{IStreamsExecutor::Config{"TestCPUStreamsExecutor", 1, 1}}};
+    std::promise<void> unblock;
+    std::promise<void> blocked;
+    auto blockedFuture = blocked.get_future();
+    auto unblockFuture = unblock.get_future().share();
+    executor->run([&blocked, unblockFuture] {
+        blocked.set_value();
+        unblockFuture.wait();
+    });
+    blockedFuture.wait();
+
+    std::atomic<bool> executed{false};
+    std::atomic<bool> cancelled{false};
+    IStreamsExecutor::TaskSchedule taskSchedule;
+    taskSchedule.priority = 1;
+    taskSchedule.cancel = [&cancelled] {
+        cancelled = true;
+    };
+    executor->runScheduled([&executed] {
+        executed = true;
+    }, taskSchedule);
+
+    // the executor is stopped while the only stream is still busy
+    std::thread stopThread{[&executor] {
+        executor.reset();
+    }};
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    unblock.set_value();
+    stopThread.join();
+
+    ASSERT_FALSE(executed);
+    ASSERT_TRUE(cancelled);
+}
+
 class StreamsExecutorConfigTest : public ::testing::Test {};
 
 static auto Executors = ::testing::Values(
@@ -208,6 +352,13 @@ static auto Executors = ::testing::Values(
         return std::make_shared<CPUStreamsExecutor>(IStreamsExecutor::Config{"TestCPUStreamsExecutor",
                                                streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE});
     },
+    [] {
+        auto streams = getNumberOfCPUCores();
+        auto threads = parallel_get_max_threads();
+        IStreamsExecutor::Config config{"TestCPUStreamsExecutor", streams, threads/streams, IStreamsExecutor::ThreadBindingType::NONE};
+        config._spinWaitTime = 100;
+        return std::make_shared<CPUStreamsExecutor>(config);
+    },
     [] {
         return std::make_shared<ImmediateExecutor>();
     }
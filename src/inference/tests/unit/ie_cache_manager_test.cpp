@@ -0,0 +1,141 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#ifndef _WIN32
+#    include <sys/stat.h>
+#    include <utime.h>
+#endif
+
+#include "common_test_utils/file_utils.hpp"
+#include "ie_cache_manager.hpp"
+
+using namespace InferenceEngine;
+using namespace ::testing;
+
+class FileStorageCacheManagerTests : public Test {
+public:
+    std::string m_cacheDir;
+
+    void SetUp() override {
+        std::stringstream ss;
+        ss << "cache_manager_test_" << std::this_thread::get_id() << "_"
+           << std::chrono::high_resolution_clock::now().time_since_epoch().count();
+        m_cacheDir = ss.str();
+        CommonTestUtils::createDirectoryRecursive(m_cacheDir);
+    }
+
+    void TearDown() override {
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "blob");
+        CommonTestUtils::removeFilesWithExt(m_cacheDir, "tmp");
+        CommonTestUtils::removeDir(m_cacheDir);
+    }
+
+    static void write(ICacheManager& cacheManager, const std::string& id, const std::string& content) {
+        cacheManager.writeCacheEntry(id, [&](std::ostream& stream) {
+            stream << content;
+        });
+    }
+
+    static std::string read(ICacheManager& cacheManager, const std::string& id) {
+        std::string content;
+        cacheManager.readCacheEntry(id, [&](std::istream& stream) {
+            std::stringstream ss;
+            ss << stream.rdbuf();
+            content = ss.str();
+        });
+        return content;
+    }
+};
+
+TEST_F(FileStorageCacheManagerTests, WriteAndRead) {
+    FileStorageCacheManager fileCacheManager(m_cacheDir);
+    ICacheManager& cacheManager = fileCacheManager;
+    write(cacheManager, "entry", "header\npayload");
+
+    cacheManager.readCacheEntry("entry", [&](std::istream& stream) {
+        std::string header;
+        std::getline(stream, header);
+        EXPECT_EQ(header, "header");
+        EXPECT_EQ(stream.tellg(), std::streampos(7));
+
+        std::string payload(7, '\0');
+        stream.read(&payload[0], payload.size());
+        EXPECT_EQ(payload, "payload");
+
+        stream.seekg(-7, std::ios_base::end);
+        EXPECT_EQ(stream.tellg(), std::streampos(7));
+        stream.seekg(0);
+        std::getline(stream, header);
+        EXPECT_EQ(header, "header");
+    });
+    EXPECT_EQ(read(cacheManager, "missing"), "");
+    EXPECT_TRUE(CommonTestUtils::listFilesWithExt(m_cacheDir, "tmp").empty());
+}
+
+TEST_F(FileStorageCacheManagerTests, FailedWriteKeepsEntry) {
+    FileStorageCacheManager fileCacheManager(m_cacheDir);
+    ICacheManager& cacheManager = fileCacheManager;
+    write(cacheManager, "entry", "original");
+
+    EXPECT_ANY_THROW(cacheManager.writeCacheEntry("entry", [](std::ostream& stream) {
+        stream << "partial";
+        throw std::runtime_error("export failed");
+    }));
+    EXPECT_EQ(read(cacheManager, "entry"), "original");
+    EXPECT_TRUE(CommonTestUtils::listFilesWithExt(m_cacheDir, "tmp").empty());
+}
+
+#ifndef _WIN32
+TEST_F(FileStorageCacheManagerTests, EvictsLeastRecentlyUsed) {
+    const std::string content(1000, 'a');
+    FileStorageCacheManager fileCacheManager(m_cacheDir, 2500);
+    ICacheManager& cacheManager = fileCacheManager;
+    write(cacheManager, "entry1", content);
+    write(cacheManager, "entry2", content);
+
+    // entry1 is older, but it's read after entry2 was written
+    auto setLastUse = [&](const std::string& id, time_t time) {
+        struct utimbuf times;
+        times.actime = time;
+        times.modtime = time;
+        ASSERT_EQ(utime(CommonTestUtils::makePath(m_cacheDir, id + ".blob").c_str(), &times), 0);
+    };
+    const auto now = time(nullptr);
+    setLastUse("entry1", now - 100);
+    setLastUse("entry2", now - 50);
+    EXPECT_EQ(read(cacheManager, "entry1"), content);
+
+    write(cacheManager, "entry3", content);
+    EXPECT_EQ(read(cacheManager, "entry1"), content);
+    EXPECT_EQ(read(cacheManager, "entry2"), "");
+    EXPECT_EQ(read(cacheManager, "entry3"), content);
+}
+#endif
+
+#ifndef _WIN32
+TEST_F(FileStorageCacheManagerTests, EvictsStaleTempFiles) {
+    FileStorageCacheManager fileCacheManager(m_cacheDir, 2500);
+    ICacheManager& cacheManager = fileCacheManager;
+    const auto staleFile = CommonTestUtils::makePath(m_cacheDir, "stale.blob.1.1.tmp");
+    const auto activeFile = CommonTestUtils::makePath(m_cacheDir, "active.blob.2.2.tmp");
+    CommonTestUtils::createFile(staleFile, "partial");
+    CommonTestUtils::createFile(activeFile, "partial");
+    // the writer of the stale file has crashed a day ago, the active one is still being written
+    struct utimbuf times;
+    times.actime = times.modtime = time(nullptr) - 24 * 60 * 60;
+    ASSERT_EQ(utime(staleFile.c_str(), &times), 0);
+
+    write(cacheManager, "entry", "content");
+    EXPECT_FALSE(CommonTestUtils::fileExists(staleFile));
+    EXPECT_TRUE(CommonTestUtils::fileExists(activeFile));
+    EXPECT_EQ(read(cacheManager, "entry"), "content");
+}
+#endif
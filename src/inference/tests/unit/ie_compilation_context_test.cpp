@@ -8,6 +8,11 @@
 #include <thread>
 #include <chrono>
 
+#ifndef _WIN32
+#    include <sys/stat.h>
+#    include <utime.h>
+#endif
+
 #include "compilation_context.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/ops.hpp"
@@ -119,9 +124,30 @@ TEST_F(NetworkContext_CalcFileInfoTests, SizeModified) {
     ASSERT_NE(info1, info2);
 }
 
+#ifndef _WIN32
+TEST_F(NetworkContext_CalcFileInfoTests, ContentModified) {
+    createFile(m_fileName, 10000);
+    struct stat info;
+    ASSERT_EQ(stat(m_fileName.c_str(), &info), 0);
+    auto info1 = NetworkCompilationContext::calculateFileInfo(m_fileName);
+    {
+        std::fstream str(m_fileName, std::ios::binary | std::ios::in | std::ios::out);
+        str.seekp(5000);
+        str.put('b');
+    }
+    // Restore the modification time, so only the content of the file differs
+    struct utimbuf times;
+    times.actime = info.st_atime;
+    times.modtime = info.st_mtime;
+    ASSERT_EQ(utime(m_fileName.c_str(), &times), 0);
+    auto info2 = NetworkCompilationContext::calculateFileInfo(m_fileName);
+    ASSERT_NE(info1, info2);
+}
+#endif
+
 ////////////////////////////////////////////////////
 
-static std::shared_ptr<ngraph::Function> create_simple_function() {
+static std::shared_ptr<ngraph::Function> create_simple_function(int8_t mul_value = 3, int8_t add_value = 2) {
     // This example is taken from docs, shows how to create ngraph::Function
     //
     // Parameter--->Multiply--->Add--->Result
@@ -133,14 +159,14 @@ static std::shared_ptr<ngraph::Function> create_simple_function() {
     data->set_friendly_name("Parameter");
     data->get_output_tensor(0).set_names({"parameter"});
 
-    auto mul_constant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{1}, {3});
+    auto mul_constant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{1}, {mul_value});
     mul_constant->set_friendly_name("mul_constant");
     mul_constant->get_output_tensor(0).set_names({"mul_constant"});
     auto mul = std::make_shared<ngraph::opset6::Multiply>(data, mul_constant);
     mul->set_friendly_name("mul");
     mul->get_output_tensor(0).set_names({"mul"});
 
-    auto add_constant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{1}, {2});
+    auto add_constant = ngraph::opset6::Constant::create(ngraph::element::i8, ngraph::Shape{1}, {add_value});
     add_constant->set_friendly_name("add_constant");
     add_constant->get_output_tensor(0).set_names({"add_constant"});
     auto add = std::make_shared<ngraph::opset6::Add>(mul, add_constant);
@@ -161,6 +187,28 @@ static CNNNetwork createNetwork() {
     return res;
 }
 
+// Parameter--->TensorIterator--->Result, the body adds the constant to the slices of the input
+static CNNNetwork createNetworkWithTensorIterator(float add_value) {
+    auto data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{4, 1, 2});
+    data->set_friendly_name("Parameter");
+
+    auto body_data = std::make_shared<ngraph::opset6::Parameter>(ngraph::element::f32, ngraph::Shape{1, 1, 2});
+    auto body_constant = ngraph::opset6::Constant::create(ngraph::element::f32, ngraph::Shape{1}, {add_value});
+    auto body_add = std::make_shared<ngraph::opset6::Add>(body_data, body_constant);
+    auto body_res = std::make_shared<ngraph::opset6::Result>(body_add);
+    auto body = std::make_shared<ngraph::Function>(ngraph::ResultVector{body_res}, ngraph::ParameterVector{body_data});
+
+    auto tensor_iterator = std::make_shared<ngraph::opset6::TensorIterator>();
+    tensor_iterator->set_body(body);
+    tensor_iterator->set_sliced_input(body_data, data, 0, 1, 1, -1, 0);
+    auto out = tensor_iterator->get_concatenated_slices(body_res, 0, 1, 1, -1, 0);
+    tensor_iterator->set_friendly_name("tensor_iterator");
+
+    auto res = std::make_shared<ngraph::opset6::Result>(out);
+    res->set_friendly_name("res");
+    return CNNNetwork(std::make_shared<ngraph::Function>(ngraph::ResultVector{res}, ngraph::ParameterVector{data}));
+}
+
 static CNNNetwork createNetworkWithLayout(const ov::Layout& layout) {
     auto fun = create_simple_function();
     fun->get_parameters()[0]->set_layout(layout);
@@ -403,6 +451,33 @@ TEST(NetworkContext_CNNNetwork, HashWithDifferentMeanValues) {
               NetworkCompilationContext::computeHash(net3, {}));
 }
 
+TEST(NetworkContext_CNNNetwork, HashWithDifferentConstantValues) {
+    auto net1 = CNNNetwork(create_simple_function(3, 2));
+    auto net2 = CNNNetwork(create_simple_function(3, 2));
+    auto net3 = CNNNetwork(create_simple_function(3, 5));
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithSwappedConstantValues) {
+    auto net1 = CNNNetwork(create_simple_function(3, 2));
+    auto net2 = CNNNetwork(create_simple_function(2, 3));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+}
+
+TEST(NetworkContext_CNNNetwork, HashWithDifferentConstantValuesInBody) {
+    auto net1 = createNetworkWithTensorIterator(1.f);
+    auto net2 = createNetworkWithTensorIterator(1.f);
+    auto net3 = createNetworkWithTensorIterator(2.f);
+    ASSERT_EQ(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net2, {}));
+    ASSERT_NE(NetworkCompilationContext::computeHash(net1, {}),
+              NetworkCompilationContext::computeHash(net3, {}));
+}
+
 // Verify all internal hash calculations are thread-safe (like ngraph::function serialization)
 TEST(NetworkContext_CNNNetwork, HashOfSameMultiThreading) {
     auto net1 = createNetwork();
@@ -17,9 +17,14 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
       _heteroInferRequest(std::static_pointer_cast<HeteroInferRequest>(request)) {
     _pipeline.clear();
     for (std::size_t requestId = 0; requestId < _heteroInferRequest->_inferRequests.size(); ++requestId) {
+        // Each subgraph is a stage of the pipeline, so while this request is in the next stage, the other requests
+        // of the network can run the subgraph
         struct RequestExecutor : ITaskExecutor {
-            explicit RequestExecutor(SoIInferRequestInternal& inferRequest) : _inferRequest(inferRequest) {
+            explicit RequestExecutor(HeteroInferRequest::SubRequestDesc& desc)
+                : _inferRequest(desc._request),
+                  _utilization(desc._utilization) {
                 _inferRequest->SetCallback([this](std::exception_ptr exceptionPtr) mutable {
+                    _utilization->finish();
                     _exceptionPtr = exceptionPtr;
                     auto capturedTask = std::move(_task);
                     capturedTask();
@@ -27,15 +32,21 @@ HeteroAsyncInferRequest::HeteroAsyncInferRequest(const IInferRequestInternal::Pt
             }
             void run(Task task) override {
                 _task = std::move(task);
-                _inferRequest->StartAsync();
+                _utilization->start();
+                try {
+                    _inferRequest->StartAsync();
+                } catch (...) {
+                    _utilization->finish();
+                    throw;
+                }
             };
             SoIInferRequestInternal& _inferRequest;
+            std::shared_ptr<HeteroInferRequest::SubgraphUtilization> _utilization;
             std::exception_ptr _exceptionPtr;
             Task _task;
         };
 
-        auto requestExecutor =
-            std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]._request);
+        auto requestExecutor = std::make_shared<RequestExecutor>(_heteroInferRequest->_inferRequests[requestId]);
         _pipeline.emplace_back(requestExecutor, [requestExecutor] {
             if (nullptr != requestExecutor->_exceptionPtr) {
                 std::rethrow_exception(requestExecutor->_exceptionPtr);
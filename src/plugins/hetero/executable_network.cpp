@@ -515,6 +515,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(const InferenceEngine::CNNNetwo
         network._network = _heteroPlugin->GetCore()->LoadNetwork(network._clonedNetwork,
                                                                  network._device,
                                                                  metaDevices[network._device]);
+        network._utilization = std::make_shared<HeteroInferRequest::SubgraphUtilization>();
     }
 }
 
@@ -630,6 +631,7 @@ HeteroExecutableNetwork::HeteroExecutableNetwork(std::istream& heteroModel,
             deviceName,
             loaded ? cnnnetwork : CNNNetwork{},
             executableNetwork,
+            std::make_shared<HeteroInferRequest::SubgraphUtilization>(),
         });
     }
     const auto parseNode = [](const pugi::xml_node& xml_node, bool is_param) -> std::shared_ptr<const ov::Node> {
@@ -811,6 +813,7 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
+        desc._utilization = subnetwork._utilization;
         inferRequests.push_back(desc);
     }
     return std::make_shared<HeteroInferRequest>(inputs, outputs, inferRequests, _blobNameMap);
@@ -824,6 +827,7 @@ IInferRequestInternal::Ptr HeteroExecutableNetwork::CreateInferRequestImpl(Input
         HeteroInferRequest::SubRequestDesc desc;
         desc._network = subnetwork._network;
         desc._profilingTask = openvino::itt::handle("Infer" + std::to_string(index++));
+        desc._utilization = subnetwork._utilization;
         inferRequests.push_back(desc);
     }
     return std::make_shared<HeteroInferRequest>(networkInputs, networkOutputs, inferRequests, _blobNameMap);
@@ -908,7 +912,8 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
                                                   METRIC_KEY(SUPPORTED_METRICS),
                                                   METRIC_KEY(SUPPORTED_CONFIG_KEYS),
                                                   ov::optimal_number_of_infer_requests.name(),
-                                                  ov::execution_devices.name()};
+                                                  ov::execution_devices.name(),
+                                                  METRIC_KEY(HETERO_SUBGRAPHS_UTILIZATION)};
 
         {
             std::vector<::Metrics> pluginMetrics;
@@ -951,12 +956,23 @@ InferenceEngine::Parameter HeteroExecutableNetwork::GetMetric(const std::string&
     } else if (ov::model_name == name) {
         return decltype(ov::model_name)::value_type{_name};
     } else if (ov::optimal_number_of_infer_requests == name) {
+        // The subgraphs are the stages of the pipeline which run the different requests at the same time, so
+        // all of them are kept busy when every subgraph gets its own optimal number of requests.
+        // NOTE: this is the sum of the subgraph values for every HETERO configuration, it used to be their maximum.
+        // The applications which create this number of requests get more of them than before, e.g. a GPU+CPU split
+        // gets the GPU requests plus the CPU ones, and every request creates a request with its own blobs in all
+        // the subgraphs, so the memory consumption grows accordingly
         unsigned int value = 0u;
         for (auto&& desc : _networks) {
-            value = std::max(value,
-                             desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>());
+            value += desc._network->GetMetric(METRIC_KEY(OPTIMAL_NUMBER_OF_INFER_REQUESTS)).as<unsigned int>();
         }
         return decltype(ov::optimal_number_of_infer_requests)::value_type{value};
+    } else if (METRIC_KEY(HETERO_SUBGRAPHS_UTILIZATION) == name) {
+        std::vector<float> utilization;
+        for (auto&& desc : _networks) {
+            utilization.push_back(desc._utilization->get());
+        }
+        IE_SET_METRIC_RETURN(HETERO_SUBGRAPHS_UTILIZATION, utilization);
     } else if (name == ov::execution_devices) {
         std::vector<std::string> exeDevices;
         std::set<std::string> s;
@@ -70,6 +70,7 @@ private:
         std::string _device;
         InferenceEngine::CNNNetwork _clonedNetwork;
         InferenceEngine::SoExecutableNetworkInternal _network;
+        std::shared_ptr<HeteroInferRequest::SubgraphUtilization> _utilization;
     };
 
     std::vector<NetworkDesc> _networks;
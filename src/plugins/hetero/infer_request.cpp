@@ -118,12 +118,48 @@ const InferenceEngine::PreProcessInfo& HeteroInferRequest::GetPreProcess(const s
     return itRequest->second->GetPreProcess(name);
 }
 
+void HeteroInferRequest::SubgraphUtilization::start() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_inProgress++ == 0) {
+        _busySince = Clock::now();
+        if (!_started) {
+            _firstStart = _busySince;
+            _started = true;
+        }
+    }
+}
+
+void HeteroInferRequest::SubgraphUtilization::finish() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (--_inProgress == 0) {
+        _busy += Clock::now() - _busySince;
+    }
+}
+
+float HeteroInferRequest::SubgraphUtilization::get() const {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!_started) {
+        return 0.f;
+    }
+    const auto now = Clock::now();
+    const auto busy = _inProgress > 0 ? _busy + (now - _busySince) : _busy;
+    const auto total = now - _firstStart;
+    return total.count() > 0 ? std::chrono::duration<float>(busy) / std::chrono::duration<float>(total) : 1.f;
+}
+
 void HeteroInferRequest::InferImpl() {
     for (auto&& desc : _inferRequests) {
         OV_ITT_SCOPED_TASK(itt::domains::HeteroPlugin, desc._profilingTask);
         auto& r = desc._request;
         assert(r);
-        r->Infer();
+        desc._utilization->start();
+        try {
+            r->Infer();
+        } catch (...) {
+            desc._utilization->finish();
+            throw;
+        }
+        desc._utilization->finish();
     }
 }
 
@@ -6,10 +6,12 @@
 
 #include <ie_common.h>
 
+#include <chrono>
 #include <cpp_interfaces/interface/ie_iexecutable_network_internal.hpp>
 #include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <openvino/itt.hpp>
 #include <string>
 #include <unordered_map>
@@ -21,10 +23,32 @@ class HeteroInferRequest : public InferenceEngine::IInferRequestInternal {
 public:
     typedef std::shared_ptr<HeteroInferRequest> Ptr;
 
+    /**
+     * @brief Share of the time the subgraph had at least one inference in progress since its first inference.
+     * It's shared by all the infer requests of the network, so it shows how well the subgraphs of the different
+     * requests overlap in the pipeline
+     */
+    class SubgraphUtilization {
+    public:
+        void start();
+        void finish();
+        float get() const;
+
+    private:
+        using Clock = std::chrono::steady_clock;
+        mutable std::mutex _mutex;
+        size_t _inProgress = 0;
+        bool _started = false;
+        Clock::time_point _firstStart;
+        Clock::time_point _busySince;
+        Clock::duration _busy = Clock::duration::zero();
+    };
+
     struct SubRequestDesc {
         InferenceEngine::SoExecutableNetworkInternal _network;
         InferenceEngine::SoIInferRequestInternal _request;
         openvino::itt::handle_t _profilingTask;
+        std::shared_ptr<SubgraphUtilization> _utilization;
     };
     using SubRequestsList = std::vector<SubRequestDesc>;
 
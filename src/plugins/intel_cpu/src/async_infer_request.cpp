@@ -3,13 +3,134 @@
 //
 
 #include "async_infer_request.h"
+#include "exec_network.h"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include <memory>
 
 ov::intel_cpu::AsyncInferRequest::AsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr& inferRequest,
                                                     const InferenceEngine::ITaskExecutor::Ptr& taskExecutor,
-                                                    const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor)
-    : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor) {
+                                                    const InferenceEngine::ITaskExecutor::Ptr& callbackExecutor,
+                                                    const DynamicBatcher::Ptr& batcher)
+    : InferenceEngine::AsyncInferRequestThreadSafeDefault(inferRequest, taskExecutor, callbackExecutor),
+      _batcher(batcher) {
     static_cast<InferRequestBase*>(inferRequest.get())->SetAsyncRequest(this);
+    _deadlineMisses = std::static_pointer_cast<ExecNetwork>(inferRequest->getPointerToExecutableNetworkInternal())->_deadlineMisses;
+
+    if (_batcher) {
+        // the executor hands the request over to the batcher, which continues the pipeline once the outputs are ready
+        struct BatcherExecutor : public InferenceEngine::ITaskExecutor {
+            BatcherExecutor(AsyncInferRequest* request, InferenceEngine::IInferRequestInternal* syncRequest)
+                : _request(request), _syncRequest(syncRequest) {}
+            void run(InferenceEngine::Task task) override {
+                _request->_batcher->enqueue(_syncRequest, [this, task](std::exception_ptr exception) {
+                    _request->_batchedInferException = exception;
+                    task();
+                });
+            }
+            AsyncInferRequest* _request;
+            InferenceEngine::IInferRequestInternal* _syncRequest;
+        };
+        _pipeline = {{std::make_shared<BatcherExecutor>(this, inferRequest.get()), [this] {
+                          if (_batchedInferException)
+                              std::rethrow_exception(_batchedInferException);
+                      }}};
+    } else if (auto streamsExecutor = std::dynamic_pointer_cast<InferenceEngine::IStreamsExecutor>(taskExecutor)) {
+        struct StreamAffinityExecutor : public InferenceEngine::ITaskExecutor {
+            StreamAffinityExecutor(AsyncInferRequest* request, InferenceEngine::IStreamsExecutor::Ptr executor)
+                : _request(request), _executor(std::move(executor)) {}
+            void run(InferenceEngine::Task task) override {
+                _executor->runOnStream(std::move(task), _request->_lastStreamId);
+            }
+            AsyncInferRequest* _request;
+            InferenceEngine::IStreamsExecutor::Ptr _executor;
+        };
+        auto syncRequest = inferRequest.get();
+        _pipeline = {{std::make_shared<StreamAffinityExecutor>(this, streamsExecutor), [this, syncRequest, streamsExecutor] {
+                          _lastStreamId = streamsExecutor->GetStreamId();
+                          syncRequest->InferImpl();
+                      }}};
+        _affinityPipeline = _pipeline;
+
+        // the request with a priority or a deadline is queued according to them and preferably goes back to the
+        // stream which has run its previous inference
+        struct SchedulingExecutor : public InferenceEngine::ITaskExecutor {
+            SchedulingExecutor(AsyncInferRequest* request, InferenceEngine::IStreamsExecutor::Ptr executor)
+                : _request(request), _executor(std::move(executor)) {}
+            void run(InferenceEngine::Task task) override {
+                InferenceEngine::IStreamsExecutor::TaskSchedule schedule;
+                schedule.priority = static_cast<int>(_request->_priority) - static_cast<int>(ov::hint::Priority::MEDIUM);
+                schedule.streamId = _request->_lastStreamId;
+                _request->_deadline = std::chrono::steady_clock::time_point::max();
+                if (_request->_deadlineBudget.count()) {
+                    _request->_deadline = std::chrono::steady_clock::now() + _request->_deadlineBudget;
+                    schedule.deadline = _request->_deadline;
+                }
+                // the stage still runs on the cancellation to complete the pipeline, but skips the inference
+                auto sharedTask = std::make_shared<InferenceEngine::Task>(std::move(task));
+                auto request = _request;
+                schedule.cancel = [request, sharedTask] {
+                    request->_cancelledByExecutor = true;
+                    (*sharedTask)();
+                };
+                _executor->runScheduled([sharedTask] {
+                    (*sharedTask)();
+                }, schedule);
+            }
+            AsyncInferRequest* _request;
+            InferenceEngine::IStreamsExecutor::Ptr _executor;
+        };
+        _scheduledPipeline = {{std::make_shared<SchedulingExecutor>(this, streamsExecutor), [this, syncRequest, streamsExecutor] {
+                                   if (_cancelledByExecutor) {
+                                       _cancelledByExecutor = false;
+                                       IE_THROW(InferCancelled) << "The executor has been stopped before the request left the queue";
+                                   }
+                                   ThrowIfCanceled();
+                                   if (std::chrono::steady_clock::now() > _deadline) {
+                                       (*_deadlineMisses)++;
+                                       IE_THROW() << "The inference deadline has passed before the request left the queue";
+                                   }
+                                   _lastStreamId = streamsExecutor->GetStreamId();
+                                   syncRequest->InferImpl();
+                                   if (std::chrono::steady_clock::now() > _deadline)
+                                       (*_deadlineMisses)++;
+                               }}};
+    }
+}
+
+void ov::intel_cpu::AsyncInferRequest::SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) {
+    CheckState();
+    for (const auto& item : config) {
+        if (item.first == ov::intel_cpu::request_priority.name()) {
+            _priority = item.second.as<ov::hint::Priority>();
+        } else if (item.first == ov::intel_cpu::request_deadline.name()) {
+            _deadlineBudget = std::chrono::milliseconds(item.second.as<uint32_t>());
+        } else {
+            IE_THROW(NotFound) << "Unsupported infer request property " << item.first << " by CPU plugin";
+        }
+    }
+    // the requests without a priority and a deadline are not scheduled to spare the overhead
+    if (!_scheduledPipeline.empty()) {
+        const bool scheduled = _priority != ov::hint::Priority::MEDIUM || _deadlineBudget.count();
+        _pipeline = scheduled ? _scheduledPipeline : _affinityPipeline;
+    }
+}
+
+InferenceEngine::Parameter ov::intel_cpu::AsyncInferRequest::GetConfig(const std::string& name) const {
+    if (name == ov::intel_cpu::request_priority.name()) {
+        return decltype(ov::intel_cpu::request_priority)::value_type(_priority);
+    } else if (name == ov::intel_cpu::request_deadline.name()) {
+        return decltype(ov::intel_cpu::request_deadline)::value_type(_deadlineBudget.count());
+    }
+    IE_THROW(NotFound) << "Unsupported infer request property " << name << " by CPU plugin";
+}
+
+void ov::intel_cpu::AsyncInferRequest::Infer_ThreadUnsafe() {
+    if (_batcher) {
+        // the synchronous inference also goes through the batcher to be combined with the concurrent requests
+        InferUsingAsync();
+    } else {
+        InferenceEngine::AsyncInferRequestThreadSafeDefault::Infer_ThreadUnsafe();
+    }
 }
 
 ov::intel_cpu::AsyncInferRequest::~AsyncInferRequest() {
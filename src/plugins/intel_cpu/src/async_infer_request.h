@@ -4,10 +4,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <string>
 #include <map>
 #include <cpp_interfaces/impl/ie_infer_async_request_thread_safe_default.hpp>
 #include "infer_request.h"
+#include "dynamic_batcher.h"
+#include "openvino/runtime/properties.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -16,8 +20,30 @@ class AsyncInferRequest : public InferenceEngine::AsyncInferRequestThreadSafeDef
 public:
     AsyncInferRequest(const InferenceEngine::IInferRequestInternal::Ptr &inferRequest,
                       const InferenceEngine::ITaskExecutor::Ptr &taskExecutor,
-                      const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor);
+                      const InferenceEngine::ITaskExecutor::Ptr &callbackExecutor,
+                      const DynamicBatcher::Ptr &batcher = nullptr);
     ~AsyncInferRequest();
+
+    void SetConfig(const std::map<std::string, InferenceEngine::Parameter>& config) override;
+    InferenceEngine::Parameter GetConfig(const std::string& name) const override;
+
+protected:
+    void Infer_ThreadUnsafe() override;
+
+private:
+    // keeps the batcher alive while the request exists, the compiled model holds only a weak reference
+    DynamicBatcher::Ptr _batcher;
+    std::exception_ptr _batchedInferException;
+    // the stream which has run the last inference, the next one is preferably run there to reuse the warm caches
+    int _lastStreamId = -1;
+    // the pipeline is switched to the scheduled one once the request has a priority or a deadline
+    Pipeline _affinityPipeline;
+    Pipeline _scheduledPipeline;
+    bool _cancelledByExecutor = false;
+    ov::hint::Priority _priority = ov::hint::Priority::MEDIUM;
+    std::chrono::milliseconds _deadlineBudget{0};
+    std::chrono::steady_clock::time_point _deadline = std::chrono::steady_clock::time_point::max();
+    std::shared_ptr<std::atomic<uint64_t>> _deadlineMisses;
 };
 
 }   // namespace intel_cpu
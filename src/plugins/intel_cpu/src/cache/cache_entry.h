@@ -4,9 +4,11 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <functional>
 #include "lru_cache.h"
+#include "concurrent_lru_cache.h"
 
 namespace ov {
 namespace intel_cpu {
@@ -17,8 +19,38 @@ public:
         Hit,
         Miss
     };
+
+    struct Statistics {
+        size_t hits = 0;
+        size_t misses = 0;
+        size_t evictions = 0;
+    };
 public:
     virtual ~CacheEntryBase() = default;
+
+    /**
+     * @brief Returns the lookup and eviction counters of the entry.
+     * @note The hit and miss counters may be read concurrently with the lookups.
+     */
+    Statistics getStatistics() const {
+        Statistics stats;
+        stats.hits = _hits.load(std::memory_order_relaxed);
+        stats.misses = _misses.load(std::memory_order_relaxed);
+        stats.evictions = getEvictionsCount();
+        return stats;
+    }
+
+protected:
+    virtual size_t getEvictionsCount() const = 0;
+
+    void countLookUp(LookUpStatus status) {
+        auto& counter = status == LookUpStatus::Hit ? _hits : _misses;
+        counter.fetch_add(1, std::memory_order_relaxed);
+    }
+
+private:
+    std::atomic_size_t _hits{0};
+    std::atomic_size_t _misses{0};
 };
 
 /**
@@ -63,12 +95,51 @@ public:
             if (retVal != retEmpty)
                 _impl.put(key, retVal);
         }
+        countLookUp(retStatus);
         return {retVal, retStatus};
     }
 
+protected:
+    size_t getEvictionsCount() const override {
+        return _impl.getEvictionsCount();
+    }
+
 public:
     ImplType _impl;
 };
 
+/**
+ * @brief Thread safe specialization of the cache entry, which is backed by the sharded ConcurrentLruCache.
+ *        Concurrent misses on the same key call the builder only once, the other callers receive the built value with the Hit status.
+ */
+
+template<typename KeyType, typename ValType>
+class CacheEntry<KeyType, ValType, ConcurrentLruCache<KeyType, ValType>> : public CacheEntryBase {
+public:
+    using ResultType = std::pair<ValType, LookUpStatus>;
+
+public:
+    explicit CacheEntry(size_t capacity) : _impl(capacity) {}
+
+    ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
+        if (0 == _impl.getCapacity()) {
+            // fast track
+            return {builder(key), CacheEntryBase::LookUpStatus::Miss};
+        }
+        auto result = _impl.getOrCreate(key, builder);
+        auto retStatus = result.second ? LookUpStatus::Miss : LookUpStatus::Hit;
+        countLookUp(retStatus);
+        return {result.first, retStatus};
+    }
+
+protected:
+    size_t getEvictionsCount() const override {
+        return _impl.getEvictionsCount();
+    }
+
+public:
+    ConcurrentLruCache<KeyType, ValType> _impl;
+};
+
 }   // namespace intel_cpu
 }   // namespace ov
@@ -0,0 +1,177 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "lru_cache.h"
+
+/**
+ * @brief Thread safe preemptive cache with LRU eviction policy, which may be shared between several streams.
+ *        The records are distributed between several independently locked shards (each one is an LruCache), so the
+ *        concurrent lookups of different keys rarely contend. The LRU policy is applied inside each shard.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ */
+
+namespace ov {
+namespace intel_cpu {
+
+template<typename Key, typename Value>
+class ConcurrentLruCache {
+public:
+    static constexpr size_t defaultShardsNum = 16;
+
+public:
+    explicit ConcurrentLruCache(size_t capacity, size_t shardsNum = defaultShardsNum) : _capacity(capacity) {
+        shardsNum = std::min(std::max(shardsNum, static_cast<size_t>(1)), std::max(capacity, static_cast<size_t>(1)));
+        const size_t shardCapacity = (capacity + shardsNum - 1) / shardsNum;
+        _shards.reserve(shardsNum);
+        for (size_t i = 0; i < shardsNum; ++i) {
+            _shards.emplace_back(new Shard(shardCapacity));
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     */
+
+    void put(const Key &key, const Value &val) {
+        if (0 == _capacity) {
+            return;
+        }
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.cache.put(key, val);
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+
+    Value get(const Key &key) {
+        if (0 == _capacity) {
+            return Value();
+        }
+        auto& shard = getShard(key);
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        return shard.cache.get(key);
+    }
+
+    /**
+     * @brief Searches a value associated with the key, or builds it using the builder functor and puts it to the cache.
+     *        Concurrent requests of the same missing key are served by a single builder call, other callers wait for its result.
+     * @param key is the search key
+     * @param builder is a callable object that creates the Value object from the Key lval reference
+     * @return the pair of the requested value and the flag whether the value was built by this call
+     */
+
+    std::pair<Value, bool> getOrCreate(const Key &key, const std::function<Value(const Key&)>& builder) {
+        if (0 == _capacity) {
+            return {builder(key), true};
+        }
+
+        auto& shard = getShard(key);
+        std::shared_future<Value> pending;
+        std::promise<Value> promise;
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            Value cached = shard.cache.get(key);
+            if (cached != Value()) {
+                return {cached, false};
+            }
+            auto itr = shard.inFlight.find(key);
+            if (itr != shard.inFlight.end()) {
+                pending = itr->second;
+            } else {
+                shard.inFlight.emplace(key, promise.get_future().share());
+            }
+        }
+
+        if (pending.valid()) {
+            return {pending.get(), false};
+        }
+
+        Value result;
+        try {
+            result = builder(key);
+        } catch (...) {
+            {
+                std::lock_guard<std::mutex> lock(shard.mutex);
+                shard.inFlight.erase(key);
+            }
+            promise.set_exception(std::current_exception());
+            throw;
+        }
+        {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (result != Value())
+                shard.cache.put(key, result);
+            shard.inFlight.erase(key);
+        }
+        promise.set_value(result);
+        return {result, true};
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the number of records evicted from all the shards since the cache creation
+     * @return the number of evicted records
+     */
+    size_t getEvictionsCount() const {
+        size_t evictions = 0;
+        for (const auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard->mutex);
+            evictions += shard->cache.getEvictionsCount();
+        }
+        return evictions;
+    }
+
+private:
+    struct key_hasher {
+        std::size_t operator()(const Key &k) const {
+            return k.hash();
+        }
+    };
+
+    struct Shard {
+        explicit Shard(size_t capacity) : cache(capacity) {}
+
+        mutable std::mutex mutex;
+        LruCache<Key, Value> cache;
+        std::unordered_map<Key, std::shared_future<Value>, key_hasher> inFlight;
+    };
+
+    Shard& getShard(const Key &key) {
+        // the low bits are also used by the shard's hash table, so mix the high ones in
+        size_t hash = key.hash();
+        hash ^= hash >> 16;
+        return *_shards[hash % _shards.size()];
+    }
+
+    std::vector<std::unique_ptr<Shard>> _shards;
+    size_t _capacity;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
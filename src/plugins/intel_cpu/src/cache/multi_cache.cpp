@@ -9,5 +9,17 @@ namespace intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+MultiCache::Statistics MultiCache::getStatistics() const {
+    Statistics total;
+    std::lock_guard<std::mutex> lock(_storageMutex);
+    for (const auto& item : _storage) {
+        auto stats = item.second->getStatistics();
+        total.hits += stats.hits;
+        total.misses += stats.misses;
+        total.evictions += stats.evictions;
+    }
+    return total;
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
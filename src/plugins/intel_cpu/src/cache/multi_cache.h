@@ -7,6 +7,7 @@
 #include <functional>
 #include <unordered_map>
 #include <atomic>
+#include <mutex>
 #include "cache_entry.h"
 
 namespace ov {
@@ -15,23 +16,44 @@ namespace intel_cpu {
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @attention The records of the cache ARE NOT THREAD SAFE unless the cache is created in the Mode::Concurrent mode,
+ *            in which case it can be shared between several graphs (streams).
+ *
+ * A value put to the Concurrent cache may be executed by several streams at the same time, so it must be reentrant:
+ * the execution must not modify the state of the cached object. The cached oneDNN primitives (the scratchpad is
+ * provided by the node), DnnlExecutor (the intermediate reorders' memory is allocated per call) and the JIT / reference
+ * executors of the nodes (the per call buffers are owned by the node and passed as the arguments) meet this
+ * requirement. A new executor type must be reentrant, or its node must not use the runtime cache.
  */
 
 class MultiCache {
 public:
+    enum class Mode {
+        Exclusive,  // the cache is used by a single thread at a time
+        Concurrent  // the cache may be shared between threads, concurrent misses on the same key are built once
+    };
+
     template<typename KeyType, typename ValueType>
     using EntryTypeT = CacheEntry<KeyType, ValueType>;
+    template<typename KeyType, typename ValueType>
+    using ConcurrentEntryTypeT = CacheEntry<KeyType, ValueType, ConcurrentLruCache<KeyType, ValueType>>;
     using EntryBasePtr = std::shared_ptr<CacheEntryBase>;
     template<typename KeyType, typename ValueType>
     using EntryPtr = std::shared_ptr<EntryTypeT<KeyType, ValueType>>;
+    using Statistics = CacheEntryBase::Statistics;
 
 public:
     /**
     * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
+    * @param mode defines whether the cache records may be accessed concurrently
     * @note zero capacity means empty cache so no records are stored and no entries are created
     */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, Mode mode = Mode::Exclusive) : _capacity(capacity), _mode(mode) {}
+
+    MultiCache(const MultiCache& other) : _capacity(other._capacity), _mode(other._mode) {
+        std::lock_guard<std::mutex> lock(other._storageMutex);
+        _storage = other._storage;
+    }
 
     /**
     * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if nothing was found)
@@ -45,19 +67,34 @@ public:
     template<typename KeyType, typename BuilderType, typename ValueType = typename std::result_of<BuilderType&(const KeyType&)>::type>
     typename CacheEntry<KeyType, ValueType>::ResultType
     getOrCreate(const KeyType& key, BuilderType builder) {
-        auto entry = getEntry<KeyType, ValueType>();
+        if (Mode::Concurrent == _mode) {
+            auto entry = getEntry<ConcurrentEntryTypeT<KeyType, ValueType>>();
+            return entry->getOrCreate(key, std::move(builder));
+        }
+        auto entry = getEntry<EntryTypeT<KeyType, ValueType>>();
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+    * @brief Returns the hit/miss/eviction counters accumulated over all the entries of the cache
+    */
+    Statistics getStatistics() const;
+
+    Mode getMode() const noexcept {
+        return _mode;
+    }
+
 private:
     template<typename T>
     size_t getTypeId();
-    template<typename KeyType, typename ValueType>
-    EntryPtr<KeyType, ValueType> getEntry();
+    template<typename EntryType>
+    std::shared_ptr<EntryType> getEntry();
 
 private:
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    Mode _mode;
+    mutable std::mutex _storageMutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -67,12 +104,18 @@ size_t MultiCache::getTypeId() {
     return id;
 }
 
-template<typename KeyType, typename ValueType>
-MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
-    using EntryType = EntryTypeT<KeyType, ValueType>;
+template<typename EntryType>
+std::shared_ptr<EntryType> MultiCache::getEntry() {
     size_t id = getTypeId<EntryType>();
+    std::unique_lock<std::mutex> lock(_storageMutex, std::defer_lock);
+    // In the exclusive mode the storage is modified by the owning thread only, so the lookup doesn't need the lock,
+    // only the insertion is guarded against the concurrent getStatistics() calls
+    if (Mode::Concurrent == _mode)
+        lock.lock();
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
+        if (!lock.owns_lock())
+            lock.lock();
         auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
         itr = result.first;
     }
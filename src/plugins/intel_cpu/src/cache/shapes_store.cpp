@@ -0,0 +1,105 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "shapes_store.h"
+
+#include <cctype>
+#include <fstream>
+#include <sstream>
+
+#include "ie_common.h"
+
+namespace ov {
+namespace intel_cpu {
+
+InputShapesStore::InputShapesStore(std::string filePath, size_t capacity)
+    : _filePath(std::move(filePath)), _capacity(capacity) {}
+
+std::vector<InputShapesStore::ShapesSet> InputShapesStore::load() {
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::vector<ShapesSet> result;
+    std::ifstream file(_filePath);
+    std::string line;
+    while (file && std::getline(file, line)) {
+        if (line.empty())
+            continue;
+        try {
+            for (auto& shapes : parse(line)) {
+                if (_stored.insert(shapes).second)
+                    result.push_back(std::move(shapes));
+            }
+        } catch (const InferenceEngine::Exception&) {
+            // the line may be truncated if the previous process was killed while writing, just skip it
+        }
+    }
+    return result;
+}
+
+void InputShapesStore::record(const ShapesSet& shapes) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_stored.size() >= _capacity || _stored.count(shapes))
+        return;
+    _stored.insert(shapes);
+
+    std::ofstream file(_filePath, std::ios::app);
+    if (file) {
+        file << toString(shapes) << std::endl;
+    }
+}
+
+std::vector<InputShapesStore::ShapesSet> InputShapesStore::parse(const std::string& str) {
+    std::vector<ShapesSet> result;
+    std::stringstream setsStream(str);
+    std::string setStr;
+    while (std::getline(setsStream, setStr, ';')) {
+        ShapesSet shapes;
+        size_t pos = 0;
+        while (pos < setStr.size()) {
+            if (std::isspace(setStr[pos])) {
+                ++pos;
+                continue;
+            }
+            const auto begin = setStr.find('[', pos);
+            const auto end = setStr.find(']', pos);
+            if (begin == std::string::npos || end == std::string::npos || end < begin)
+                IE_THROW() << "Cannot parse input shapes: " << setStr;
+
+            const auto name = setStr.substr(pos, begin - pos);
+            VectorDims dims;
+            std::stringstream dimsStream(setStr.substr(begin + 1, end - begin - 1));
+            std::string dim;
+            while (std::getline(dimsStream, dim, ',')) {
+                try {
+                    dims.push_back(static_cast<Dim>(std::stoull(dim)));
+                } catch (const std::exception&) {
+                    IE_THROW() << "Cannot parse input shapes: " << setStr << ". Only static dimensions are expected";
+                }
+            }
+            shapes[name] = dims;
+            pos = end + 1;
+        }
+        if (!shapes.empty())
+            result.push_back(std::move(shapes));
+    }
+    return result;
+}
+
+std::string InputShapesStore::toString(const ShapesSet& shapes) {
+    std::stringstream ss;
+    bool firstInput = true;
+    for (const auto& input : shapes) {
+        if (!firstInput)
+            ss << " ";
+        ss << input.first << "[";
+        for (size_t i = 0; i < input.second.size(); ++i) {
+            ss << (i ? "," : "") << input.second[i];
+        }
+        ss << "]";
+        firstInput = false;
+    }
+    return ss.str();
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
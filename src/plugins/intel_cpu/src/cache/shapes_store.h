@@ -0,0 +1,62 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "cpu_types.h"
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Persistent storage of the graph input shapes met during inference of a dynamic model.
+ * All the runtime cache keys (convolution, matmul, eltwise, etc. executors) are derived from the input shapes, so
+ * replaying the stored shapes on the next model compilation rebuilds the same cache records which the previous process used.
+ * The records are appended to a text file, one set of input shapes per line, so the storage survives process restarts.
+ */
+class InputShapesStore {
+public:
+    using ShapesSet = std::map<std::string, VectorDims>;
+    using Ptr = std::shared_ptr<InputShapesStore>;
+
+    /**
+     * @param filePath the storage file, it is created on the first record
+     * @param capacity the maximal number of the shapes sets kept in the file, new sets are ignored when it is reached
+     */
+    InputShapesStore(std::string filePath, size_t capacity);
+
+    /**
+     * @brief Reads the shapes sets stored in the file. A missing or corrupted file results in an empty list.
+     */
+    std::vector<ShapesSet> load();
+
+    /**
+     * @brief Appends the shapes set to the file unless it has been already stored or loaded. Thread safe.
+     */
+    void record(const ShapesSet& shapes);
+
+    /**
+     * @brief Parses shapes sets in the form "in1[1,3,224,224] in2[1,10];in1[1,3,320,320] in2[1,20]".
+     * The input name may be omitted for single input models: "[1,128];[1,256]".
+     */
+    static std::vector<ShapesSet> parse(const std::string& str);
+
+    static std::string toString(const ShapesSet& shapes);
+
+private:
+    std::string _filePath;
+    size_t _capacity;
+    std::mutex _mutex;
+    std::set<ShapesSet> _stored;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -13,10 +13,12 @@
 #include "ie_common.h"
 #include "ie_parallel.hpp"
 #include "ie_system_conf.h"
+#include "cache/shapes_store.h"
 
 #include <cpp_interfaces/interface/ie_internal_plugin_config.hpp>
 #include "openvino/core/type/element_type_traits.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include <cpu/x64/cpu_isa_traits.hpp>
 
 namespace ov {
@@ -173,6 +175,112 @@ void Config::readProperties(const std::map<std::string, std::string> &prop) {
                 IE_THROW() << "Wrong value for property key " << CPUConfigParams::KEY_CPU_DENORMALS_OPTIMIZATION
                 << ". Expected only YES/NO";
             }
+        } else if (key == ov::intel_cpu::parallel_branches.name()) {
+            if (val == PluginConfigParams::YES)
+                parallelBranches = true;
+            else if (val == PluginConfigParams::NO)
+                parallelBranches = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::parallel_branches.name()
+                           << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::parallel_compilation.name()) {
+            if (val == PluginConfigParams::YES)
+                parallelCompilation = true;
+            else if (val == PluginConfigParams::NO)
+                parallelCompilation = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::parallel_compilation.name()
+                           << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::shared_runtime_cache.name()) {
+            if (val == PluginConfigParams::YES)
+                sharedRtCache = true;
+            else if (val == PluginConfigParams::NO)
+                sharedRtCache = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::shared_runtime_cache.name()
+                           << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::persistent_runtime_cache.name()) {
+            if (val == PluginConfigParams::YES)
+                persistentRtCache = true;
+            else if (val == PluginConfigParams::NO)
+                persistentRtCache = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::persistent_runtime_cache.name()
+                           << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::warmup_shapes.name()) {
+            try {
+                InputShapesStore::parse(val);
+            } catch (const InferenceEngine::Exception& ex) {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::warmup_shapes.name() << ". " << ex.what();
+            }
+            warmupShapes = val;
+        } else if (key == ov::intel_cpu::shape_upper_bounds.name()) {
+            std::vector<InputShapesStore::ShapesSet> bounds;
+            try {
+                bounds = InputShapesStore::parse(val);
+            } catch (const InferenceEngine::Exception& ex) {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::shape_upper_bounds.name() << ". " << ex.what();
+            }
+            if (bounds.size() > 1)
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::shape_upper_bounds.name()
+                           << ". Expected a single set of the input shapes";
+            shapeUpperBounds = val;
+        } else if (key == ov::intel_cpu::weights_numa_policy.name()) {
+            try {
+                weightsNumaPolicy = ov::util::from_string(val, ov::intel_cpu::weights_numa_policy);
+            } catch (const ov::Exception&) {
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::weights_numa_policy.name()
+                           << ". Expected only " << ov::intel_cpu::WeightsNumaPolicy::REPLICATE << "/"
+                           << ov::intel_cpu::WeightsNumaPolicy::INTERLEAVE;
+            }
+        } else if (key == ov::intel_cpu::static_memory_plan.name()) {
+            if (val == PluginConfigParams::YES)
+                staticMemoryPlan = true;
+            else if (val == PluginConfigParams::NO)
+                staticMemoryPlan = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::static_memory_plan.name()
+                           << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::snippets_reductions.name()) {
+            if (val == PluginConfigParams::YES)
+                snippetsReductions = true;
+            else if (val == PluginConfigParams::NO)
+                snippetsReductions = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::snippets_reductions.name()
+                           << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::snippets_dynamic_shapes.name()) {
+            if (val == PluginConfigParams::YES)
+                snippetsDynamicShapes = true;
+            else if (val == PluginConfigParams::NO)
+                snippetsDynamicShapes = false;
+            else
+                IE_THROW() << "Wrong value for property key " << ov::intel_cpu::snippets_dynamic_shapes.name()
+                           << ". Expected only YES/NO";
+        } else if (key == ov::intel_cpu::dynamic_batching_max_batch.name() ||
+                   key == ov::intel_cpu::dynamic_batching_timeout.name()) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << key << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << key << ". Expected only non-negative integer numbers";
+            if (key == ov::intel_cpu::dynamic_batching_max_batch.name())
+                dynamicBatchingMaxBatch = static_cast<uint32_t>(val_i);
+            else
+                dynamicBatchingTimeout = static_cast<uint32_t>(val_i);
+        } else if (key == ov::intel_cpu::streams_spin_wait.name()) {
+            int val_i = -1;
+            try {
+                val_i = std::stoi(val);
+            } catch (const std::exception&) {
+                IE_THROW() << "Wrong value for property key " << key << ". Expected only non-negative integer numbers";
+            }
+            if (val_i < 0)
+                IE_THROW() << "Wrong value for property key " << key << ". Expected only non-negative integer numbers";
+            streamExecutorConfig._spinWaitTime = val_i;
         } else {
             IE_THROW(NotFound) << "Unsupported property " << key << " by CPU plugin";
         }
@@ -237,6 +345,19 @@ void Config::updateProperties() {
     _config.insert({ PluginConfigParams::KEY_PERFORMANCE_HINT_NUM_REQUESTS,
             std::to_string(perfHintsConfig.ovPerfHintNumRequests) });
     _config.insert({PluginConfigParams::KEY_CACHE_DIR, cache_dir});
+    _config.insert({ov::intel_cpu::parallel_branches.name(), parallelBranches ? PluginConfigParams::YES : PluginConfigParams::NO});
+    _config.insert({ov::intel_cpu::shared_runtime_cache.name(), sharedRtCache ? PluginConfigParams::YES : PluginConfigParams::NO});
+    _config.insert({ov::intel_cpu::parallel_compilation.name(), parallelCompilation ? PluginConfigParams::YES : PluginConfigParams::NO});
+    _config.insert({ov::intel_cpu::persistent_runtime_cache.name(), persistentRtCache ? PluginConfigParams::YES : PluginConfigParams::NO});
+    _config.insert({ov::intel_cpu::warmup_shapes.name(), warmupShapes});
+    _config.insert({ov::intel_cpu::dynamic_batching_max_batch.name(), std::to_string(dynamicBatchingMaxBatch)});
+    _config.insert({ov::intel_cpu::dynamic_batching_timeout.name(), std::to_string(dynamicBatchingTimeout)});
+    _config.insert({ov::intel_cpu::shape_upper_bounds.name(), shapeUpperBounds});
+    _config.insert({ov::intel_cpu::static_memory_plan.name(), staticMemoryPlan ? PluginConfigParams::YES : PluginConfigParams::NO});
+    _config.insert({ov::intel_cpu::snippets_reductions.name(), snippetsReductions ? PluginConfigParams::YES : PluginConfigParams::NO});
+    _config.insert({ov::intel_cpu::snippets_dynamic_shapes.name(), snippetsDynamicShapes ? PluginConfigParams::YES : PluginConfigParams::NO});
+    _config.insert({ov::intel_cpu::weights_numa_policy.name(), ov::util::to_string(weightsNumaPolicy)});
+    _config.insert({ov::intel_cpu::streams_spin_wait.name(), std::to_string(streamExecutorConfig._spinWaitTime)});
 }
 
 #ifdef CPU_DEBUG_CAPS
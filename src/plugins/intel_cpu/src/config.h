@@ -6,6 +6,7 @@
 
 #include <threading/ie_istreams_executor.hpp>
 #include <ie_performance_hints.hpp>
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "utils/debug_capabilities.h"
 
 #include <string>
@@ -36,6 +37,18 @@ struct Config {
     int batchLimit = 0;
     float fcSparseWeiDecompressionRate = 1.0f;
     size_t rtCacheCapacity = 5000ul;
+    bool parallelBranches = false;
+    bool sharedRtCache = false;
+    bool parallelCompilation = true;
+    bool persistentRtCache = false;
+    std::string warmupShapes = "";
+    uint32_t dynamicBatchingMaxBatch = 0;
+    uint32_t dynamicBatchingTimeout = 1;
+    std::string shapeUpperBounds = "";
+    bool staticMemoryPlan = false;
+    bool snippetsReductions = false;
+    bool snippetsDynamicShapes = false;
+    ov::intel_cpu::WeightsNumaPolicy weightsNumaPolicy = ov::intel_cpu::WeightsNumaPolicy::REPLICATE;
     InferenceEngine::IStreamsExecutor::Config streamExecutorConfig;
     InferenceEngine::PerfHintsConfig  perfHintsConfig;
 #if defined(__arm__) || defined(__aarch64__)
@@ -16,6 +16,7 @@
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include "nodes/reorder.h"
 #include "memory_desc/cpu_memory_desc.h"
+#include "utils/numa_memory.h"
 
 using namespace InferenceEngine;
 using namespace dnnl;
@@ -183,13 +184,19 @@ bool MemoryMngrWithReuse::resize(size_t size) {
     constexpr int cacheLineSize = 64;
     bool sizeChanged = false;
     if (size > _memUpperBound) {
-        void *ptr = dnnl::impl::malloc(size, cacheLineSize);
-        if (!ptr) {
-            throw std::bad_alloc();
+        // the memory created in the NUMA allocation scope (e.g. the shared weights) is bound before it is filled
+        const auto numaNodeIds = NumaAllocationScope::current();
+        if (void *ptr = numaNodeIds ? allocateOnNumaNodes(size, *numaNodeIds) : nullptr) {
+            _data = decltype(_data)(ptr, [size](void *ptr) { freeNumaMemory(ptr, size); });
+        } else {
+            ptr = dnnl::impl::malloc(size, cacheLineSize);
+            if (!ptr) {
+                throw std::bad_alloc();
+            }
+            _data = decltype(_data)(ptr, destroy);
         }
         _memUpperBound = size;
         _useExternalStorage = false;
-        _data = decltype(_data)(ptr, destroy);
         sizeChanged = true;
     }
     return sizeChanged;
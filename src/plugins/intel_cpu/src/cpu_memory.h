@@ -83,7 +83,7 @@ public:
 private:
     bool _useExternalStorage = false;
     size_t _memUpperBound = 0ul;
-    std::unique_ptr<void, void (*)(void *)> _data;
+    std::unique_ptr<void, std::function<void(void *)>> _data;
 
     static void release(void *ptr);
     static void destroy(void *ptr);
@@ -5,6 +5,7 @@
 #pragma once
 
 #include <memory>
+#include <mutex>
 
 #include "common/memory.hpp"
 #include "cpu_memory.h"
@@ -16,6 +17,8 @@ namespace intel_cpu {
 class DnnlScratchPad {
     DnnlMemoryMngrPtr mgrPtr;
     dnnl::engine eng;
+    // the primitives of a graph may be created concurrently, while all of them share the scratchpad memory manager
+    std::mutex mgrMutex;
 
 public:
     DnnlScratchPad(dnnl::engine eng) : eng(eng) {
@@ -24,6 +27,7 @@ public:
 
     MemoryPtr createScratchPadMem(const MemoryDescPtr& md) {
         auto mem = std::make_shared<Memory>(eng);
+        std::lock_guard<std::mutex> lock(mgrMutex);
         mem->Create(md, mgrPtr);
         return mem;
     }
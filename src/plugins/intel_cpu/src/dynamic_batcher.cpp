@@ -0,0 +1,385 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dynamic_batcher.h"
+
+#include <algorithm>
+#include <blob_factory.hpp>
+#include <ie_common.h>
+#include <openvino/core/validation_util.hpp>
+#include <openvino/op/util/gather_base.hpp>
+#include <openvino/op/util/reduction_base.hpp>
+#include <openvino/opsets/opset8.hpp>
+
+#include "infer_request.h"
+#include "nodes/common/cpu_memcpy.h"
+
+namespace ov {
+namespace intel_cpu {
+
+using namespace InferenceEngine;
+
+DynamicBatcher::DynamicBatcher(std::vector<std::string> inputNames,
+                               std::vector<std::string> outputNames,
+                               RequestFactory createRequest,
+                               ITaskExecutor::Ptr executor,
+                               size_t maxBatch,
+                               std::chrono::milliseconds timeout,
+                               std::shared_ptr<Statistics> statistics)
+    : _inputNames(std::move(inputNames)),
+      _outputNames(std::move(outputNames)),
+      _createRequest(std::move(createRequest)),
+      _executor(std::move(executor)),
+      _maxBatch(maxBatch),
+      _timeout(timeout),
+      _statistics(std::move(statistics)) {
+    _worker = std::thread([this] {
+        run();
+    });
+}
+
+DynamicBatcher::~DynamicBatcher() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _cv.notify_all();
+    _worker.join();
+
+    // the batches dispatched to the executor use the batcher, so wait for them
+    std::unique_lock<std::mutex> lock(_mutex);
+    _cv.wait(lock, [this] {
+        return _inFlight == 0;
+    });
+}
+
+namespace {
+
+// reads the constant axes of the input port normalized to the given rank, returns false if they are not constant
+bool getConstAxes(const ov::Node* node, size_t port, const ov::Rank& rank, std::vector<int64_t>& axes) {
+    const auto constant = ov::as_type<const ov::opset8::Constant>(node->get_input_node_ptr(port));
+    if (!constant || rank.is_dynamic())
+        return false;
+    axes = constant->cast_vector<int64_t>();
+    for (auto& axis : axes) {
+        axis = ov::normalize_axis(node, axis, rank);
+    }
+    return true;
+}
+
+bool hasAxis(const std::vector<int64_t>& axes, int64_t axis) {
+    return std::find(axes.begin(), axes.end(), axis) != axes.end();
+}
+
+bool isConstantInput(const ov::Node* node, size_t port) {
+    return ov::is_type<ov::opset8::Constant>(node->get_input_node_ptr(port));
+}
+
+// checks whether the op combines the data of the different batch items, i.e. works along the outermost axis of a
+// non-constant input, so the result depends on how the requests are combined
+bool mixesBatchItems(const std::shared_ptr<const ov::Node>& node) {
+    using namespace ov::opset8;
+    const auto inRank = node->get_input_size() ? node->get_input_partial_shape(0).rank() : ov::Rank(0);
+    std::vector<int64_t> axes;
+
+    if (const auto subgraph = ov::as_type_ptr<const ov::op::util::SubGraphOp>(node)) {
+        for (const auto& op : subgraph->get_function()->get_ordered_ops()) {
+            if (mixesBatchItems(op))
+                return true;
+        }
+        return false;
+    }
+    if (const auto reduction = ov::as_type_ptr<const ov::op::util::ReductionBase>(node)) {
+        return !reduction->reduction_axes_constant() || reduction->get_reduction_axes().count(0);
+    }
+    if (const auto softmax = ov::as_type_ptr<const ov::op::v1::Softmax>(node)) {
+        return softmax->get_axis() == 0;
+    }
+    if (const auto softmax = ov::as_type_ptr<const Softmax>(node)) {
+        return ov::normalize_axis(node.get(), softmax->get_axis(), inRank) == 0;
+    }
+    if (const auto logSoftmax = ov::as_type_ptr<const LogSoftmax>(node)) {
+        return ov::normalize_axis(node.get(), logSoftmax->get_axis(), inRank) == 0;
+    }
+    if (const auto concat = ov::as_type_ptr<const Concat>(node)) {
+        return concat->get_concatenation_axis() == 0;
+    }
+    if (const auto gather = ov::as_type_ptr<const ov::op::util::GatherBase>(node)) {
+        // e.g. the embeddings lookup takes the rows of a constant table
+        return !isConstantInput(node.get(), 0) && (!isConstantInput(node.get(), 2) || gather->get_axis() == 0);
+    }
+    if (const auto topK = ov::as_type_ptr<const ov::op::v1::TopK>(node)) {
+        return topK->get_axis() == 0;
+    }
+    if (ov::is_type<MVN>(node) || ov::is_type<Split>(node) || ov::is_type<VariadicSplit>(node) ||
+        ov::is_type<CumSum>(node)) {
+        return !getConstAxes(node.get(), 1, inRank, axes) || hasAxis(axes, 0);
+    }
+    if (ov::is_type<Roll>(node)) {
+        return !getConstAxes(node.get(), 2, inRank, axes) || hasAxis(axes, 0);
+    }
+    if (ov::is_type<Transpose>(node)) {
+        const auto order = ov::as_type<const Constant>(node->get_input_node_ptr(1));
+        return !order || order->cast_vector<int64_t>().empty() || order->cast_vector<int64_t>()[0] != 0;
+    }
+    if (const auto reshape = ov::as_type_ptr<const ov::op::v1::Reshape>(node)) {
+        const auto pattern = ov::as_type<const Constant>(node->get_input_node_ptr(1));
+        if (!pattern)
+            return true;
+        const auto dims = pattern->cast_vector<int64_t>();
+        if (dims.empty())
+            return true;
+        if (dims[0] == 0 && reshape->get_special_zero())
+            return false;
+        // [-1, ...] keeps the batch only if the rest of the dims keeps the number of elements in a batch item
+        const auto& inShape = node->get_input_partial_shape(0);
+        const auto& outShape = node->get_output_partial_shape(0);
+        if (dims[0] != -1 || inShape.rank().is_dynamic() || inShape.rank().get_length() == 0 || outShape.rank().is_dynamic())
+            return true;
+        int64_t inItem = 1, outItem = 1;
+        for (int64_t i = 1; i < inShape.rank().get_length(); ++i) {
+            if (inShape[i].is_dynamic())
+                return true;
+            inItem *= inShape[i].get_length();
+        }
+        for (int64_t i = 1; i < outShape.rank().get_length(); ++i) {
+            if (outShape[i].is_dynamic())
+                return true;
+            outItem *= outShape[i].get_length();
+        }
+        return inItem != outItem;
+    }
+    if (const auto matMul = ov::as_type_ptr<const MatMul>(node)) {
+        // the batch is a matrix dimension of the 2D operands, so it is contracted with the other operand
+        auto isMatrixWithBatch = [&](size_t port) {
+            const auto rank = node->get_input_partial_shape(port).rank();
+            return !isConstantInput(node.get(), port) && (rank.is_dynamic() || rank.get_length() <= 2);
+        };
+        return (isMatrixWithBatch(0) && matMul->get_transpose_a()) || isMatrixWithBatch(1);
+    }
+    return ov::is_type<BatchToSpace>(node) || ov::is_type<SpaceToBatch>(node) || ov::is_type<ReverseSequence>(node);
+}
+
+}   // namespace
+
+bool DynamicBatcher::isApplicable(const std::shared_ptr<const ov::Model>& model) {
+    auto hasDynamicBatch = [](const ov::PartialShape& shape, const ov::Layout& layout) {
+        return shape.rank().is_static() && shape.rank().get_length() > 0 && shape[0].is_dynamic() &&
+               ov::layout::has_batch(layout) && ov::layout::batch_idx(layout) == 0;
+    };
+    if (!model->get_sinks().empty() || !model->get_variables().empty())
+        return false;
+    for (const auto& parameter : model->get_parameters()) {
+        if (!hasDynamicBatch(parameter->get_output_partial_shape(0), parameter->get_layout()))
+            return false;
+    }
+    for (const auto& result : model->get_results()) {
+        if (!hasDynamicBatch(result->get_input_partial_shape(0), result->get_layout()))
+            return false;
+    }
+    for (const auto& op : model->get_ordered_ops()) {
+        if (mixesBatchItems(op))
+            return false;
+    }
+    return !model->get_parameters().empty();
+}
+
+void DynamicBatcher::enqueue(IInferRequestInternal* request, Completion completion) {
+    Pending pending{request, std::move(completion), {}, 0, std::chrono::steady_clock::now()};
+    try {
+        for (const auto& name : _inputNames) {
+            pending.inputs.push_back(request->GetBlob(name));
+        }
+    } catch (...) {
+        pending.completion(std::current_exception());
+        return;
+    }
+
+    // all the inputs must share the outermost dimension to be batched, otherwise the request is inferred alone
+    bool batchable = static_cast<InferRequestBase*>(request)->CanBeBatched();
+    for (const auto& input : pending.inputs) {
+        if (!batchable)
+            break;
+        const auto& dims = input->getTensorDesc().getDims();
+        if (dims.empty() || dims[0] == 0 || (pending.batch && dims[0] != pending.batch)) {
+            batchable = false;
+            break;
+        }
+        pending.batch = dims[0];
+    }
+
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (!batchable || pending.batch >= _maxBatch) {
+        // nothing to wait for, dispatch it right away
+        pending.batch = _maxBatch;
+        pending.arrival = std::chrono::steady_clock::time_point::min();
+    }
+    _queuedBatch += pending.batch;
+    _queue.push_back(std::move(pending));
+    _cv.notify_all();
+}
+
+void DynamicBatcher::run() {
+    std::unique_lock<std::mutex> lock(_mutex);
+    while (true) {
+        _cv.wait(lock, [this] {
+            return _stop || !_queue.empty();
+        });
+        if (_queue.empty())
+            break;
+
+        const auto arrival = _queue.front().arrival;
+        if (arrival != std::chrono::steady_clock::time_point::min()) {
+            _cv.wait_until(lock, arrival + _timeout, [this] {
+                return _stop || _queuedBatch >= _maxBatch;
+            });
+        }
+
+        auto batch = std::make_shared<std::vector<Pending>>(takeBatch());
+        ++_inFlight;
+        lock.unlock();
+        _executor->run([this, batch] {
+            execute(*batch);
+            std::lock_guard<std::mutex> lock(_mutex);
+            --_inFlight;
+            _cv.notify_all();
+        });
+        lock.lock();
+    }
+}
+
+bool DynamicBatcher::isCompatible(const Pending& lhs, const Pending& rhs) {
+    for (size_t i = 0; i < lhs.inputs.size(); ++i) {
+        const auto& lhsDesc = lhs.inputs[i]->getTensorDesc();
+        const auto& rhsDesc = rhs.inputs[i]->getTensorDesc();
+        if (lhsDesc.getPrecision() != rhsDesc.getPrecision() ||
+            lhsDesc.getDims().empty() || lhsDesc.getDims().size() != rhsDesc.getDims().size() ||
+            !std::equal(lhsDesc.getDims().begin() + 1, lhsDesc.getDims().end(), rhsDesc.getDims().begin() + 1))
+            return false;
+    }
+    return true;
+}
+
+std::vector<DynamicBatcher::Pending> DynamicBatcher::takeBatch() {
+    std::vector<Pending> batch;
+    batch.push_back(std::move(_queue.front()));
+    _queue.pop_front();
+    size_t total = batch.front().batch;
+
+    for (auto it = _queue.begin(); it != _queue.end() && total < _maxBatch;) {
+        if (total + it->batch <= _maxBatch && isCompatible(batch.front(), *it)) {
+            total += it->batch;
+            batch.push_back(std::move(*it));
+            it = _queue.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    _queuedBatch -= total;
+    return batch;
+}
+
+void DynamicBatcher::execute(std::vector<Pending>& batch) {
+    auto inferAlone = [this](Pending& pending) {
+        std::exception_ptr exception;
+        try {
+            pending.request->InferImpl();
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        _statistics->inferences++;
+        _statistics->requests++;
+        pending.completion(exception);
+    };
+
+    if (batch.size() == 1) {
+        inferAlone(batch.front());
+        return;
+    }
+
+    try {
+        inferBatched(batch);
+    } catch (...) {
+        // e.g. the outputs do not follow the inputs batch, each request still gets its own result
+        for (auto& pending : batch) {
+            inferAlone(pending);
+        }
+        return;
+    }
+    _statistics->inferences++;
+    _statistics->requests += batch.size();
+    for (auto& pending : batch) {
+        pending.completion(nullptr);
+    }
+}
+
+void DynamicBatcher::inferBatched(std::vector<Pending>& batch) {
+    size_t total = 0;
+    for (const auto& pending : batch) {
+        total += pending.batch;
+    }
+
+    auto request = acquireRequest();
+    try {
+        for (size_t i = 0; i < _inputNames.size(); ++i) {
+            const auto& desc = batch.front().inputs[i]->getTensorDesc();
+            auto dims = desc.getDims();
+            dims[0] = total;
+            auto blob = make_blob_with_precision(TensorDesc(desc.getPrecision(), dims, TensorDesc::getLayoutByRank(dims.size())));
+            blob->allocate();
+
+            auto dst = blob->buffer().as<uint8_t*>();
+            for (const auto& pending : batch) {
+                const auto& input = pending.inputs[i];
+                cpu_memcpy(dst, input->cbuffer().as<const uint8_t*>(), input->byteSize());
+                dst += input->byteSize();
+            }
+            request->SetBlob(_inputNames[i], blob);
+        }
+
+        request->InferImpl();
+
+        for (const auto& name : _outputNames) {
+            const auto output = request->GetBlob(name);
+            const auto& desc = output->getTensorDesc();
+            if (desc.getDims().empty() || desc.getDims()[0] != total)
+                IE_THROW() << "Output " << name << " does not follow the batch dimension of the inputs";
+
+            const size_t rowSize = output->byteSize() / total;
+            auto src = output->cbuffer().as<const uint8_t*>();
+            for (const auto& pending : batch) {
+                auto dims = desc.getDims();
+                dims[0] = pending.batch;
+                if (pending.request->GetBlob(name)->getTensorDesc().getPrecision() != desc.getPrecision())
+                    IE_THROW() << "Output " << name << " precision differs from the batched inference one";
+                static_cast<InferRequestBase*>(pending.request)->PullBatchedOutput(name, src, dims);
+                src += rowSize * pending.batch;
+            }
+        }
+    } catch (...) {
+        releaseRequest(request);
+        throw;
+    }
+    releaseRequest(request);
+}
+
+IInferRequestInternal::Ptr DynamicBatcher::acquireRequest() {
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!_idleRequests.empty()) {
+            auto request = _idleRequests.back();
+            _idleRequests.pop_back();
+            return request;
+        }
+    }
+    return _createRequest();
+}
+
+void DynamicBatcher::releaseRequest(IInferRequestInternal::Ptr request) {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _idleRequests.push_back(std::move(request));
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,110 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <cpp_interfaces/interface/ie_iinfer_request_internal.hpp>
+#include <threading/ie_itask_executor.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Combines the concurrent infer requests of a model with dynamic batch dimension into one inference.
+ * The requests are queued until the total batch reaches the limit or the oldest request waits longer than the latency
+ * budget. The requests with the same non-batch input dimensions are concatenated along the batch dimension, inferred
+ * with a single dynamic shape inference and the outputs are split back, so no padding is involved.
+ * A request which can not be batched with the others is inferred alone.
+ */
+class DynamicBatcher {
+public:
+    using Ptr = std::shared_ptr<DynamicBatcher>;
+    using RequestFactory = std::function<InferenceEngine::IInferRequestInternal::Ptr()>;
+    using Completion = std::function<void(std::exception_ptr)>;
+
+    /**
+     * @brief Counters shared with the compiled model, which may outlive the batcher
+     */
+    struct Statistics {
+        std::atomic<uint64_t> inferences{0};
+        std::atomic<uint64_t> requests{0};
+
+        float averageBatch() const {
+            const auto inferencesNum = inferences.load();
+            return inferencesNum ? static_cast<float>(requests.load()) / inferencesNum : 0.f;
+        }
+    };
+
+    DynamicBatcher(std::vector<std::string> inputNames,
+                   std::vector<std::string> outputNames,
+                   RequestFactory createRequest,
+                   InferenceEngine::ITaskExecutor::Ptr executor,
+                   size_t maxBatch,
+                   std::chrono::milliseconds timeout,
+                   std::shared_ptr<Statistics> statistics);
+    ~DynamicBatcher();
+
+    /**
+     * @brief Queues the request for the batched inference. The completion is called from the executor thread once the
+     * request outputs are filled or the inference failed.
+     */
+    void enqueue(InferenceEngine::IInferRequestInternal* request, Completion completion);
+
+    /**
+     * @brief Checks that the model is stateless, all its inputs and outputs have dynamic outermost dimension marked as
+     * the batch one by the layout ('N' at index 0) and none of its ops combines the data along the batch dimension,
+     * e.g. a reduction or a softmax over the axis 0
+     */
+    static bool isApplicable(const std::shared_ptr<const ov::Model>& model);
+
+private:
+    struct Pending {
+        InferenceEngine::IInferRequestInternal* request;
+        Completion completion;
+        std::vector<InferenceEngine::Blob::Ptr> inputs;
+        size_t batch;
+        std::chrono::steady_clock::time_point arrival;
+    };
+
+    void run();
+    std::vector<Pending> takeBatch();
+    void execute(std::vector<Pending>& batch);
+    void inferBatched(std::vector<Pending>& batch);
+    static bool isCompatible(const Pending& lhs, const Pending& rhs);
+
+    InferenceEngine::IInferRequestInternal::Ptr acquireRequest();
+    void releaseRequest(InferenceEngine::IInferRequestInternal::Ptr request);
+
+    const std::vector<std::string> _inputNames;
+    const std::vector<std::string> _outputNames;
+    const RequestFactory _createRequest;
+    const InferenceEngine::ITaskExecutor::Ptr _executor;
+    const size_t _maxBatch;
+    const std::chrono::milliseconds _timeout;
+    const std::shared_ptr<Statistics> _statistics;
+
+    std::mutex _mutex;
+    std::condition_variable _cv;
+    std::deque<Pending> _queue;
+    size_t _queuedBatch = 0;
+    size_t _inFlight = 0;
+    bool _stop = false;
+    // requests used for the combined inferences, one per concurrently executed batch
+    std::vector<InferenceEngine::IInferRequestInternal::Ptr> _idleRequests;
+    std::thread _worker;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -107,6 +107,9 @@ KernelEmitter::KernelEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl:
     map_abstract_registers(vec_regs_pool, gp_regs_pool, vecs_used, gprs_used);
     remove_regs_from_pool(gp_regs_pool, gprs_used);
     remove_regs_from_pool(vec_regs_pool, vecs_used);
+    // reg_const_params stays reserved in the shape-agnostic kernel, so TileScheduler needs one more free gpr
+    if (jcp.is_dynamic && gp_regs_pool.empty())
+        IE_THROW() << "KernelEmitter can't generate shape-agnostic kernel: there are no free gprs left";
     // Remember used gprs to pass it to the TileSchedulerEmitter, so it can init them with appropriate data ptrs
     gp_regs_used = std::vector<size_t>(gprs_used.begin(), gprs_used.end());
 }
@@ -141,11 +144,23 @@ void KernelEmitter::init_data_pointers(size_t num_inputs, size_t num_params,
             }
         }
     };
+    auto init_ptrs_with_runtime_offsets = [&](Reg64 pointer, size_t offsets_idx, Reg64 reg_tmp) {
+        for (int j = 0; j < harness_num_dims; j++) {
+            h->mov(reg_tmp, h->ptr[reg_const_params + GET_OFF(data_offsets) + (offsets_idx + j) * sizeof(int64_t)]);
+            h->imul(reg_tmp, h->ptr[reg_indexes + j * sizeof(size_t)]);
+            h->add(pointer, reg_tmp);
+        }
+    };
     for (auto i = 0; i < num_params; i++) {
         if (i < num_inputs)
             h->mov(data_ptr_regs[i], h->ptr[reg_const_params + GET_OFF(src_ptrs) + i * sizeof(void*)]);
         else
             h->mov(data_ptr_regs[i], h->ptr[reg_const_params + GET_OFF(dst_ptrs) + (i - num_inputs) * sizeof(void*)]);
+        if (jcp.is_dynamic) {
+            // reg_const_params is needed until the end of the kernel, so a free gpr is used as tmp_reg
+            init_ptrs_with_runtime_offsets(data_ptr_regs[i], i * harness_num_dims, Reg64(static_cast<int>(gp_regs_pool.front())));
+            continue;
+        }
         // we can use the last data_ptr_reg as tmp_reg until the last iteration, and reg_const_params then
         Reg64 reg_tmp = i < num_params-1 ? data_ptr_regs.back() : reg_const_params;
         init_ptrs_with_offsets(data_ptr_regs[i], &jcp.data_offsets[i * harness_num_dims], reg_tmp);
@@ -171,13 +186,17 @@ void KernelEmitter::emit_impl(const std::vector<size_t>& in,
     //  we need a more elegant approach to avoid a full copy here
     auto local_gpr_pool = gp_regs_pool;
     local_gpr_pool.push_back(static_cast<size_t>(reg_indexes.getIdx()));
-    local_gpr_pool.push_back(static_cast<size_t>(reg_const_params.getIdx()));
+    if (!jcp.is_dynamic)
+        local_gpr_pool.push_back(static_cast<size_t>(reg_const_params.getIdx()));
     for (const auto& c : body) {
         const auto& emitter = c.first;
         std::vector<size_t> in_regs, out_regs;
         std::tie(in_regs, out_regs) = c.second;
-        if (auto tile_scheduler = std::dynamic_pointer_cast<TileSchedulerEmitter>(emitter))
+        if (auto tile_scheduler = std::dynamic_pointer_cast<TileSchedulerEmitter>(emitter)) {
             out_regs = gp_regs_used;
+            if (jcp.is_dynamic)
+                in_regs.push_back(static_cast<size_t>(reg_const_params.getIdx()));
+        }
         emitter->emit_code(in_regs, out_regs, vec_regs_pool, local_gpr_pool);
     }
     h->postamble();
@@ -190,7 +209,7 @@ TileSchedulerEmitter::TileSchedulerEmitter(dnnl::impl::cpu::x64::jit_generator*
         IE_THROW() << "TileSchedulerEmitter invoked with invalid op argument";
     if (!tile_scheduler->compile_params)
         IE_THROW() << "TileEmitter invoked without compile_params";
-    body = {tile_scheduler->vector_region, tile_scheduler->scalar_region};
+    body = tile_scheduler->region;
     jcp = *reinterpret_cast<const jit_snippets_compile_args*>(tile_scheduler->compile_params);
 }
 void TileSchedulerEmitter::emit_code(const std::vector<size_t> &in,
@@ -204,22 +223,58 @@ void TileSchedulerEmitter::validate_arguments(const std::vector<size_t> &in,
                                      const std::vector<size_t> &out,
                                      const std::vector<size_t> &pool,
                                      const std::vector<size_t> &gpr) const {
-    if (in.size() != 3)
-        IE_THROW() << "TileSchedulerEmitter got invalid number of inputs. Expected 3, got " << in.size();
+    const size_t expected_in_size = jcp.is_dynamic ? 4 : 3;
+    if (in.size() != expected_in_size)
+        IE_THROW() << "TileSchedulerEmitter got invalid number of inputs. Expected " << expected_in_size << ", got " << in.size();
     if (out.size() != in[0] + in[1])
         IE_THROW() << "TileSchedulerEmitter got invalid number of outputs. Expected " << in[0] + in[1] << " , got " << out.size();
-    if (body.size() != 2)
-        IE_THROW() << "TileSchedulerEmitter got invalid body size, expected 2 (vector & scalar TileEmitter), got " << body.size();
-    if (!(std::dynamic_pointer_cast<TileEmitter>(body[0].first) && std::dynamic_pointer_cast<TileEmitter>(body[1].first)))
-        IE_THROW() << "TileSchedulerEmitter can contain only TileEmitters inside its body";
+    if (body.size() < 2)
+        IE_THROW() << "TileSchedulerEmitter got invalid body size, expected at least 2 (vector & scalar TileEmitter), got " << body.size();
+    for (size_t i = 0; i < body.size();) {
+        if (!(i + 1 < body.size() && std::dynamic_pointer_cast<TileEmitter>(body[i].first) &&
+              std::dynamic_pointer_cast<TileEmitter>(body[i + 1].first)))
+            IE_THROW() << "TileSchedulerEmitter expects a pair of vector & scalar TileEmitters at the beginning of each sweep";
+        for (i += 2; i < body.size() && !std::dynamic_pointer_cast<TileEmitter>(body[i].first); i++) {
+            if (!std::dynamic_pointer_cast<HorizonEmitter>(body[i].first))
+                IE_THROW() << "TileSchedulerEmitter can contain only TileEmitters and HorizonEmitters inside its body";
+        }
+    }
+}
+
+void TileSchedulerEmitter::emit_sweeps(const Reg64& reg_inner_amount, const Reg64& reg_const_params, const std::vector<Reg64>& data_ptr_regs,
+                                       size_t vector_size, const std::vector<size_t>& vec_pool, const std::vector<size_t>& gpr_pool) const {
+    for (size_t i = 0; i < body.size();) {
+        const auto& vector_tile = body[i];
+        const auto& scalar_tile = body[i + 1];
+        // Accumulators are shared by the vector and the scalar Tiles of the sweep
+        for (const auto& code : std::dynamic_pointer_cast<TileEmitter>(vector_tile.first)->get_nested_code()) {
+            if (const auto accumulate = std::dynamic_pointer_cast<AccumulateEmitter>(code.first))
+                accumulate->emit_init(code.second.second[0]);
+        }
+        size_t work_amount = 0;
+        if (jcp.is_dynamic)
+            emit_dynamic_tiles(vector_tile, scalar_tile, reg_inner_amount, reg_const_params, data_ptr_regs, vector_size, vec_pool, gpr_pool);
+        else
+            work_amount = emit_tiles(vector_tile, scalar_tile, reg_inner_amount, data_ptr_regs, vector_size, vec_pool, gpr_pool);
+        for (i += 2; i < body.size() && !std::dynamic_pointer_cast<TileEmitter>(body[i].first); i++)
+            body[i].first->emit_code(body[i].second.first, body[i].second.second, vec_pool, gpr_pool);
+        // The next sweep reads the same row again
+        if (i < body.size() && jcp.is_dynamic) {
+            h->mov(reg_inner_amount, h->ptr[reg_const_params + GET_OFF(scheduler_dims) + sizeof(int64_t)]);
+            std::dynamic_pointer_cast<TileEmitter>(vector_tile.first)->emit_ptr_decrements(data_ptr_regs, reg_inner_amount);
+        } else if (i < body.size() && work_amount != 0) {
+            std::dynamic_pointer_cast<TileEmitter>(vector_tile.first)->emit_ptr_decrements(data_ptr_regs, work_amount);
+        }
+    }
 }
 
-void TileSchedulerEmitter::emit_tiles(const Reg64& reg_inner_amount, const std::vector<Reg64>& data_ptr_regs, size_t vector_size,
-                                      const std::vector<size_t>& vec_pool, const std::vector<size_t>& gpr_pool) const {
+size_t TileSchedulerEmitter::emit_tiles(const AllocatedEmitter& vector_code, const AllocatedEmitter& scalar_code,
+                                        const Reg64& reg_inner_amount, const std::vector<Reg64>& data_ptr_regs, size_t vector_size,
+                                        const std::vector<size_t>& vec_pool, const std::vector<size_t>& gpr_pool) const {
     // TileAllocatedEmitter is just an alias to perform dynamic_pointer_cast only once and reuse it below several times
     using TileAllocatedEmitter = std::pair<std::shared_ptr<TileEmitter>, const ngraph::snippets::RegInfo&>;
-    TileAllocatedEmitter vector_tile {std::dynamic_pointer_cast<TileEmitter>(body[0].first), body[0].second};
-    TileAllocatedEmitter scalar_tile {std::dynamic_pointer_cast<TileEmitter>(body[1].first), body[1].second};
+    TileAllocatedEmitter vector_tile {std::dynamic_pointer_cast<TileEmitter>(vector_code.first), vector_code.second};
+    TileAllocatedEmitter scalar_tile {std::dynamic_pointer_cast<TileEmitter>(scalar_code.first), scalar_code.second};
     const size_t inner_work_amount = jcp.scheduler_dims[1];
     auto process_tile =
         [&](const bool evaluate_once, const TileAllocatedEmitter& tile) {
@@ -264,6 +319,38 @@ void TileSchedulerEmitter::emit_tiles(const Reg64& reg_inner_amount, const std::
         }
         process_tile(scalar_evaluate_once, scalar_tile);
     }
+    // Tiles evaluated once don't increment data pointers at the end, so the pointers are advanced by less than work amount
+    size_t pointers_advance = inner_work_amount;
+    if (inner_work_amount >= vector_size && inner_work_amount < 2 * vector_size && inner_work_amount % vector_size == 0)
+        pointers_advance -= vector_size;
+    if (inner_work_amount % vector_size == 1)
+        pointers_advance -= 1;
+    return pointers_advance;
+}
+
+void TileSchedulerEmitter::emit_dynamic_tiles(const AllocatedEmitter& vector_code, const AllocatedEmitter& scalar_code,
+                                              const Reg64& reg_inner_amount, const Reg64& reg_const_params,
+                                              const std::vector<Reg64>& data_ptr_regs, size_t vector_size,
+                                              const std::vector<size_t>& vec_pool, const std::vector<size_t>& gpr_pool) const {
+    // The inner work amount is known only in runtime, so both Tiles are emitted as loops that are skipped if there is
+    // not enough work for them. Note that the data pointers are always advanced by the whole inner work amount in this case.
+    auto process_tile = [&](const AllocatedEmitter& tile, size_t increment) {
+        Label tile_end;
+        h->cmp(reg_inner_amount, increment);
+        h->jl(tile_end, CodeGenerator::T_NEAR);
+        std::vector<size_t> in_regs, out_regs;
+        std::tie(in_regs, out_regs) = tile.second;
+        // pass work_amount reg to Tile
+        in_regs.push_back(static_cast<size_t>(reg_inner_amount.getIdx()));
+        for (const auto& reg : data_ptr_regs)
+            out_regs.emplace_back(reg.getIdx());
+        tile.first->emit_code(in_regs, out_regs, vec_pool, gpr_pool);
+        h->L(tile_end);
+    };
+    h->mov(reg_inner_amount, h->ptr[reg_const_params + GET_OFF(scheduler_dims) + sizeof(int64_t)]);
+    // vector Tile leaves the tail in reg_inner_amount, and it's processed by the scalar Tile
+    process_tile(vector_code, vector_size);
+    process_tile(scalar_code, 1);
 }
 
 void TileSchedulerEmitter::emit_impl(const std::vector<size_t>& in,
@@ -286,16 +373,34 @@ void TileSchedulerEmitter::emit_impl(const std::vector<size_t>& in,
     Reg64 reg_inner_amount = Reg64(static_cast<int>(local_gpr_pool.back()));
     local_gpr_pool.pop_back();
     Label for_body;
+    if (jcp.is_dynamic) {
+        const Reg64 reg_const_params = Reg64(static_cast<int>(in[3]));
+        // Outer work amount is at least 1, since the nodes with empty tensors aren't executed
+        h->mov(reg_outer_amount, h->ptr[reg_const_params + GET_OFF(scheduler_dims)]);
+        h->L(for_body);
+        {
+            emit_sweeps(reg_inner_amount, reg_const_params, data_ptr_regs, vector_size, vec_pool, local_gpr_pool);
+
+            for (auto i = 0; i < num_params; i++)
+                h->add(data_ptr_regs[i], h->ptr[reg_const_params + GET_OFF(scheduler_offsets) + i * sizeof(int64_t)]);
+            h->sub(reg_outer_amount, 1);
+            h->cmp(reg_outer_amount, 1);
+            h->jge(for_body, CodeGenerator::T_NEAR);
+        }
+        return;
+    }
+    // call args aren't read by the Tiles of the static kernel
+    const Reg64 reg_const_params {};
     const size_t outer_work_amount = jcp.scheduler_dims[0];
     if (outer_work_amount == 1) {
         // emit code directly without looping over external dim
-        emit_tiles(reg_inner_amount, data_ptr_regs, vector_size, vec_pool, local_gpr_pool);
+        emit_sweeps(reg_inner_amount, reg_const_params, data_ptr_regs, vector_size, vec_pool, local_gpr_pool);
     } else if (outer_work_amount > 1) {
         // We need to create a Loop in this case
         h->mov(reg_outer_amount, outer_work_amount);
         h->L(for_body);
         {
-            emit_tiles(reg_inner_amount, data_ptr_regs, vector_size, vec_pool, local_gpr_pool);
+            emit_sweeps(reg_inner_amount, reg_const_params, data_ptr_regs, vector_size, vec_pool, local_gpr_pool);
 
             // Todo: Load and Store emitters are currently implemented so they ALWAYS increment appropriate pointers
             //   after reading/writing. This might be a problem if we need to read the same data multiple times (broadcasting shapes).
@@ -365,6 +470,22 @@ void TileEmitter::emit_ptr_increments(const std::vector<Reg64>& data_ptr_regs) c
     }
 }
 
+void TileEmitter::emit_ptr_decrements(const std::vector<Reg64>& data_ptr_regs, size_t work_amount) const {
+    for (size_t i = 0; i < num_inputs + num_outputs; i++) {
+        if (io_dims[i] != 1)
+            h->sub(data_ptr_regs[i], work_amount * io_data_size[i]);
+    }
+}
+
+void TileEmitter::emit_ptr_decrements(const std::vector<Reg64>& data_ptr_regs, const Reg64& reg_work_amount) const {
+    // lea doesn't need a tmp register to scale the work amount, since the data sizes are valid scale factors
+    h->neg(reg_work_amount);
+    for (size_t i = 0; i < num_inputs + num_outputs; i++) {
+        if (io_dims[i] != 1)
+            h->lea(data_ptr_regs[i], h->ptr[data_ptr_regs[i] + reg_work_amount * static_cast<int>(io_data_size[i])]);
+    }
+}
+
 void TileEmitter::emit_impl(const std::vector<size_t>& in,
                             const std::vector<size_t>& out,
                             const std::vector<size_t>& vec_pool,
@@ -456,6 +577,146 @@ void ScalarEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<si
 }
 
 
+AccumulateEmitter::AccumulateEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa,
+                                     const std::shared_ptr<ov::Node>& n) : jit_emitter(h, isa, n) {
+    const auto accumulate = ov::as_type_ptr<ngraph::snippets::op::Accumulate>(n);
+    if (!accumulate)
+        IE_THROW() << "AccumulateEmitter invoked with invalid op argument";
+    if (n->get_input_element_type(0) != ov::element::f32)
+        IE_THROW() << "AccumulateEmitter supports only f32 but gets: " << n->get_input_element_type(0);
+    is_max = ov::is_type<ngraph::snippets::op::AccumulateMax>(n);
+    count = accumulate->get_count();
+}
+
+void AccumulateEmitter::emit_impl(const std::vector<size_t>& in,
+                                  const std::vector<size_t>& out,
+                                  const std::vector<size_t>& pool,
+                                  const std::vector<size_t>& gpr,
+                                  const ov::intel_cpu::emitter_context *emit_context) const {
+    if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+        emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+        emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_core) {
+        emit_isa<dnnl::impl::cpu::x64::avx512_core>(in, out);
+    } else {
+        IE_THROW() << "Accumulate emitter doesn't support " << host_isa_;
+    }
+}
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+void AccumulateEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+            Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_src = Vmm(in[0]);
+    Vmm vmm_acc = Vmm(out[0]);
+    if (count == 1) {
+        // Only the first lane is loaded by the scalar Tile: max is idempotent, so the lane could be broadcasted,
+        // while sum needs other lanes to be zeroed
+        Vmm vmm_aux = Vmm(aux_vec_idxs[0]);
+        Xmm xmm_aux = Xmm(aux_vec_idxs[0]);
+        if (is_max) {
+            h->uni_vbroadcastss(vmm_aux, Xmm(in[0]));
+        } else {
+            h->uni_vpxor(vmm_aux, vmm_aux, vmm_aux);
+            if (isa == dnnl::impl::cpu::x64::sse41)
+                h->movss(xmm_aux, Xmm(in[0]));
+            else
+                h->vmovss(xmm_aux, xmm_aux, Xmm(in[0]));
+        }
+        vmm_src = vmm_aux;
+    }
+    if (is_max)
+        h->uni_vmaxps(vmm_acc, vmm_acc, vmm_src);
+    else
+        h->uni_vaddps(vmm_acc, vmm_acc, vmm_src);
+}
+
+void AccumulateEmitter::emit_init(size_t out_vec_idx) const {
+    if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+        emit_init_isa<dnnl::impl::cpu::x64::sse41>(out_vec_idx);
+    } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+        emit_init_isa<dnnl::impl::cpu::x64::avx2>(out_vec_idx);
+    } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_core) {
+        emit_init_isa<dnnl::impl::cpu::x64::avx512_core>(out_vec_idx);
+    } else {
+        IE_THROW() << "Accumulate emitter doesn't support " << host_isa_;
+    }
+}
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+void AccumulateEmitter::emit_init_isa(size_t out_vec_idx) const {
+    using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+            Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_acc = Vmm(out_vec_idx);
+    if (is_max) {
+        // -inf (0xff800000) is all ones shifted left by 23, so the table isn't needed
+        if (isa == dnnl::impl::cpu::x64::avx512_core)
+            h->vpternlogd(vmm_acc, vmm_acc, vmm_acc, 0xFF);
+        else
+            h->uni_vpcmpeqd(vmm_acc, vmm_acc, vmm_acc);
+        h->uni_vpslld(vmm_acc, vmm_acc, 23);
+    } else {
+        h->uni_vpxor(vmm_acc, vmm_acc, vmm_acc);
+    }
+}
+
+HorizonEmitter::HorizonEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa,
+                               const std::shared_ptr<ov::Node>& n) : jit_emitter(h, isa, n) {
+    if (n->get_input_element_type(0) != ov::element::f32)
+        IE_THROW() << "HorizonEmitter supports only f32 but gets: " << n->get_input_element_type(0);
+    is_max = ov::is_type<ngraph::snippets::op::HorizonMax>(n);
+}
+
+void HorizonEmitter::emit_impl(const std::vector<size_t>& in,
+                               const std::vector<size_t>& out,
+                               const std::vector<size_t>& pool,
+                               const std::vector<size_t>& gpr,
+                               const ov::intel_cpu::emitter_context *emit_context) const {
+    if (host_isa_ == dnnl::impl::cpu::x64::sse41) {
+        emit_isa<dnnl::impl::cpu::x64::sse41>(in, out);
+    } else if (host_isa_ == dnnl::impl::cpu::x64::avx2) {
+        emit_isa<dnnl::impl::cpu::x64::avx2>(in, out);
+    } else if (host_isa_ == dnnl::impl::cpu::x64::avx512_core) {
+        emit_isa<dnnl::impl::cpu::x64::avx512_core>(in, out);
+    } else {
+        IE_THROW() << "Horizon emitter doesn't support " << host_isa_;
+    }
+}
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+void HorizonEmitter::emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const {
+    using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+            Xmm, isa == dnnl::impl::cpu::x64::avx2, Ymm, Zmm>::type;
+    Vmm vmm_dst = Vmm(out[0]);
+    Vmm vmm_aux = Vmm(aux_vec_idxs[0]);
+    if (in[0] != out[0])
+        h->uni_vmovups(vmm_dst, Vmm(in[0]));
+    // Each step reduces the pairs of the lanes blocks swapped by the shuffle, so all the lanes hold the result in the end
+    if (isa == dnnl::impl::cpu::x64::avx512_core) {
+        h->vshuff32x4(Zmm(vmm_aux.getIdx()), Zmm(vmm_dst.getIdx()), Zmm(vmm_dst.getIdx()), 0x4E);
+        perform_op<Vmm>(vmm_dst, vmm_dst, vmm_aux);
+        h->vshuff32x4(Zmm(vmm_aux.getIdx()), Zmm(vmm_dst.getIdx()), Zmm(vmm_dst.getIdx()), 0xB1);
+        perform_op<Vmm>(vmm_dst, vmm_dst, vmm_aux);
+    } else if (isa == dnnl::impl::cpu::x64::avx2) {
+        h->vperm2f128(Ymm(vmm_aux.getIdx()), Ymm(vmm_dst.getIdx()), Ymm(vmm_dst.getIdx()), 0x01);
+        perform_op<Vmm>(vmm_dst, vmm_dst, vmm_aux);
+    }
+    h->uni_vshufps(vmm_aux, vmm_dst, vmm_dst, 0x4E);
+    perform_op<Vmm>(vmm_dst, vmm_dst, vmm_aux);
+    h->uni_vshufps(vmm_aux, vmm_dst, vmm_dst, 0xB1);
+    perform_op<Vmm>(vmm_dst, vmm_dst, vmm_aux);
+}
+
+template <typename Vmm>
+void HorizonEmitter::perform_op(const Vmm& vmm1, const Vmm& vmm2, const Vmm& vmm3) const {
+    if (is_max)
+        h->uni_vmaxps(vmm1, vmm2, vmm3);
+    else
+        h->uni_vaddps(vmm1, vmm2, vmm3);
+}
+
+
 MemoryEmitter::MemoryEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa,
                              const std::shared_ptr<ov::Node>& n) : jit_emitter(h, isa, n) {
     src_prc = InferenceEngine::details::convertPrecision(n->get_input_element_type(0));
@@ -27,6 +27,11 @@ namespace intel_cpu {
 struct jit_snippets_call_args {
     const void *src_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     void *dst_ptrs[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
+    // The schedule is passed in runtime only to the kernels generated with jit_snippets_compile_args::is_dynamic,
+    // the same fields of jit_snippets_compile_args are ignored by such kernels
+    int64_t scheduler_dims[SNIPPETS_MAX_TILE_RANK] = {};
+    int64_t scheduler_offsets[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
+    int64_t data_offsets[SNIPPETS_MAX_SNIPPETS_DIMS * SNIPPETS_MAX_HARNESS_DIMS] = {};
 };
 
 struct jit_snippets_compile_args {
@@ -34,6 +39,8 @@ struct jit_snippets_compile_args {
     int64_t scheduler_offsets[SNIPPETS_MAX_SNIPPETS_DIMS] = {};
     int64_t data_offsets[SNIPPETS_MAX_SNIPPETS_DIMS * SNIPPETS_MAX_HARNESS_DIMS] = {};
     std::vector<size_t> output_dims = {};
+    // Generate shape-agnostic kernel: work amounts and offsets are read from jit_snippets_call_args
+    bool is_dynamic = false;
 };
 ///
 /// \brief jit_container_emitter designed to wrap Emitters that contain other Emitters (presently KernelEmitter,
@@ -63,9 +70,12 @@ protected:
 ///         TileEmitter {    /* inner scalar tile for tail processing */
 ///             ...          /* All the necessary Load/Strore/elementwise emitters */
 ///         }
+///         ...              /* Horizon emitters and the Tiles of the next sweeps if the body has reductions */
 ///     }
 /// }
 /// Note that Kernel doesn't accept any input arguments.
+/// The shape-agnostic Kernel keeps the call args pointer in a gpr during the whole execution and passes it to
+/// TileSchedulerEmitter as an additional input, so one gpr less is available for data pointers in this case.
 ///
 class KernelEmitter : public jit_container_emitter {
 public:
@@ -99,10 +109,14 @@ private:
 /// \brief  TileSchedulerEmitter contains Tiles to be executed (presently vector and scalar). It calculates data offsets
 /// and work amounts, performs data pointer decrements if necessary. It also performs some Tile optimizations: scalar/vector
 /// tiles are emitted only if necessary; Tile body could be emitted directly, if only one Tile evaluation is required.
+/// If the body has reductions, it contains several sweeps over the innermost dimension: the vector and the scalar Tiles
+/// of each sweep followed by Horizon emitters. Accumulators are initialized before the sweep, and data pointers are
+/// moved back to the beginning of the row after each sweep except the last one.
 ///
 /// \param      in[0]      The number of the node inputs
 /// \param      in[1]      The number of the node outputs
 /// \param      in[2]      The number of elements that fits into vector register
+/// \param      in[3]      The gpr with the call args pointer, it's passed only to the shape-agnostic TileScheduler
 ///
 
 class TileSchedulerEmitter : public jit_container_emitter {
@@ -127,7 +141,12 @@ private:
                    const std::vector<size_t>& gpr,
                    const ov::intel_cpu::emitter_context *emit_context) const override;
 
-    void emit_tiles(const Reg64&, const std::vector<Reg64>&, size_t, const std::vector<size_t>& , const std::vector<size_t>&) const;
+    void emit_sweeps(const Reg64&, const Reg64&, const std::vector<Reg64>&, size_t,
+                     const std::vector<size_t>& , const std::vector<size_t>&) const;
+    size_t emit_tiles(const AllocatedEmitter&, const AllocatedEmitter&,
+                      const Reg64&, const std::vector<Reg64>&, size_t, const std::vector<size_t>& , const std::vector<size_t>&) const;
+    void emit_dynamic_tiles(const AllocatedEmitter&, const AllocatedEmitter&, const Reg64&,
+                            const Reg64&, const std::vector<Reg64>&, size_t, const std::vector<size_t>& , const std::vector<size_t>&) const;
 
     jit_snippets_compile_args jcp;
 };
@@ -152,6 +171,9 @@ public:
 
     void emit_body(const std::vector<size_t>& vec_pool, const std::vector<size_t>& gpr_pool) const;
     void emit_ptr_increments(const std::vector<Reg64>& data_ptr_regs) const;
+    void emit_ptr_decrements(const std::vector<Reg64>& data_ptr_regs, size_t work_amount) const;
+    // Decrements the pointers by the work amount that is known only in runtime. Note that the register is negated
+    void emit_ptr_decrements(const std::vector<Reg64>& data_ptr_regs, const Reg64& reg_work_amount) const;
 
 private:
     void validate_arguments(const std::vector<size_t> &in,
@@ -232,6 +254,67 @@ private:
     int32_t value;
 };
 
+///
+/// \brief  AccumulateEmitter reduces the Tile iterations into the accumulator register lane by lane (max or sum).
+/// The accumulator is initialized by TileSchedulerEmitter before the sweep. Only the first lane of the input is
+/// accumulated in the scalar Tile.
+///
+class AccumulateEmitter : public jit_emitter {
+public:
+    AccumulateEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n);
+
+    size_t get_inputs_num() const override {return 1;}
+    void emit_init(size_t out_vec_idx) const;
+
+protected:
+    size_t aux_vecs_count() const override {return count == 1 ? 1 : 0;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+                   const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool,
+                   const std::vector<size_t>& gpr,
+                   const ov::intel_cpu::emitter_context *emit_context) const override;
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_init_isa(size_t out_vec_idx) const;
+
+private:
+    bool is_max = false;
+    size_t count = 0;
+};
+
+///
+/// \brief  HorizonEmitter reduces the lanes of the accumulator register and broadcasts the result to all the lanes.
+/// It's executed by TileSchedulerEmitter between the sweeps.
+///
+class HorizonEmitter : public jit_emitter {
+public:
+    HorizonEmitter(dnnl::impl::cpu::x64::jit_generator* h, dnnl::impl::cpu::x64::cpu_isa_t isa, const std::shared_ptr<ov::Node>& n);
+
+    size_t get_inputs_num() const override {return 1;}
+
+protected:
+    size_t aux_vecs_count() const override {return 1;}
+
+private:
+    void emit_impl(const std::vector<size_t>& in,
+                   const std::vector<size_t>& out,
+                   const std::vector<size_t>& pool,
+                   const std::vector<size_t>& gpr,
+                   const ov::intel_cpu::emitter_context *emit_context) const override;
+
+    template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+    void emit_isa(const std::vector<size_t> &in, const std::vector<size_t> &out) const;
+    template <typename Vmm>
+    void perform_op(const Vmm& vmm1, const Vmm& vmm2, const Vmm& vmm3) const;
+
+private:
+    bool is_max = false;
+};
+
 ///
 /// Memory emitters:
 ///
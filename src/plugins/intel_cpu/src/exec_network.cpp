@@ -26,12 +26,15 @@
 #include "cpp_interfaces/interface/ie_iplugin_internal.hpp"
 #include "ie_icore.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 #include "openvino/util/common_util.hpp"
+#include "openvino/util/file_util.hpp"
 
 #include <algorithm>
 #include <unordered_set>
 #include <utility>
 #include <cstring>
+#include <sstream>
 
 using namespace InferenceEngine;
 using namespace InferenceEngine::details;
@@ -79,6 +82,7 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
 
     _cfg.isNewApi = !isLegacyAPI();
     _mutex = std::make_shared<std::mutex>();
+    _numaNodesWeights = NumaNodesWeights(_cfg.weightsNumaPolicy == ov::intel_cpu::WeightsNumaPolicy::INTERLEAVE);
 
     // WA for inference dynamic batch cases in new API
     if (_cfg.isNewApi) {
@@ -119,6 +123,10 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
         _callbackExecutor = _taskExecutor;
     }
 
+    if (_cfg.sharedRtCache) {
+        _rtParamsCache = std::make_shared<MultiCache>(_cfg.rtCacheCapacity, MultiCache::Mode::Concurrent);
+    }
+
     int streams = std::max(1, _cfg.streamExecutorConfig._streams);
     std::vector<Task> tasks; tasks.resize(streams);
     _graphs.resize(streams);
@@ -162,6 +170,89 @@ ExecNetwork::ExecNetwork(const InferenceEngine::CNNNetwork &network,
             }
         }
     }
+
+    GrowMemoryToUpperBounds(function);
+    WarmUpRuntimeCache(function);
+
+    if (_cfg.dynamicBatchingMaxBatch > 1 && !isLegacyAPI() && DynamicBatcher::isApplicable(function)) {
+        _batchingStatistics = std::make_shared<DynamicBatcher::Statistics>();
+    }
+}
+
+void ExecNetwork::GrowMemoryToUpperBounds(const std::shared_ptr<const ov::Model>& function) {
+    if (!function->is_dynamic() || (!_cfg.staticMemoryPlan && _cfg.shapeUpperBounds.empty()))
+        return;
+
+    // the tensors with bounded shapes are already placed into the statically planned workspace, the memory of the
+    // remaining dynamic tensors is grown by the inference with the upper bound shapes and is never shrunk
+    InputShapesStore::ShapesSet upperShapes;
+    for (const auto& param : function->get_parameters()) {
+        const auto& shape = param->get_output_partial_shape(0);
+        if (shape.rank().is_dynamic())
+            return;
+        VectorDims dims;
+        for (const auto& dim : shape) {
+            if (dim.get_max_length() < 0)
+                return;
+            dims.push_back(static_cast<Dim>(dim.get_max_length()));
+        }
+        upperShapes[ngraph::op::util::get_ie_output_name(param->output(0))] = dims;
+    }
+
+    for (auto& graph : _graphs) {
+        auto graphLock = GraphGuard::Lock(graph);
+        try {
+            graphLock._graph.WarmUp(upperShapes);
+        } catch (const std::exception& ex) {
+            // e.g. the zero filled inputs are not valid for the model, then the requested static memory plan can't be
+            // guaranteed
+            IE_THROW() << "Failed to grow the memory of the model " << _name << " to the shape upper bounds: " << ex.what();
+        }
+    }
+}
+
+void ExecNetwork::WarmUpRuntimeCache(const std::shared_ptr<const ov::Model>& function) {
+    if (!function->is_dynamic())
+        return;
+    // the warm up defines nothing but the input shapes, so neither the shapes are stored nor the graph is warmed up
+    // if the shapes inside the graph depend on the input data
+    if (GetGraph()._graph.HasDataDependentShapes())
+        return;
+
+    const auto declaredShapes = InputShapesStore::parse(_cfg.warmupShapes);
+    std::vector<InputShapesStore::ShapesSet> storedShapes;
+    if (_cfg.persistentRtCache && !_cfg.cache_dir.empty() && _cfg.rtCacheCapacity > 0) {
+        // the file is bound to the model by its name and inputs
+        std::stringstream modelId;
+        modelId << function->get_friendly_name();
+        for (const auto& param : function->get_parameters()) {
+            modelId << ";" << param->get_friendly_name() << param->get_output_partial_shape(0)
+                    << param->get_output_element_type(0);
+        }
+        const auto fileName = "cpu_rt_shapes_" + std::to_string(std::hash<std::string>()(modelId.str())) + ".txt";
+        _shapesStore = std::make_shared<InputShapesStore>(ov::util::path_join({_cfg.cache_dir, fileName}), _cfg.rtCacheCapacity);
+        storedShapes = _shapesStore->load();
+    }
+
+    if (declaredShapes.empty() && storedShapes.empty())
+        return;
+
+    for (auto& graph : _graphs) {
+        auto graphLock = GraphGuard::Lock(graph);
+        for (const auto& shapes : declaredShapes) {
+            graphLock._graph.WarmUp(shapes);
+        }
+        for (const auto& shapes : storedShapes) {
+            try {
+                graphLock._graph.WarmUp(shapes);
+            } catch (const std::exception&) {
+                // the stored shapes may be stale if the model has changed under the same name, they are just skipped
+            }
+        }
+        // all the graphs use the same records of the shared cache
+        if (_rtParamsCache)
+            break;
+    }
 }
 
 ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
@@ -181,7 +272,7 @@ ExecNetwork::GraphGuard::Lock ExecNetwork::GetGraph() const {
                     std::lock_guard<std::mutex> lock{*_mutex.get()};
                     graphLock._graph.setConfig(_cfg);
                 }
-                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId], _mutex);
+                graphLock._graph.CreateGraph(_network, extensionManager, _numaNodesWeights[numaNodeId], _mutex, _rtParamsCache);
             } catch(...) {
                 exception = std::current_exception();
             }
@@ -212,7 +303,41 @@ void ExecNetwork::setProperty(const std::map<std::string, std::string> &properti
 }
 
 InferenceEngine::IInferRequestInternal::Ptr ExecNetwork::CreateInferRequest() {
-    return CreateAsyncInferRequestFromSync<AsyncInferRequest>();
+    if (!_batchingStatistics)
+        return CreateAsyncInferRequestFromSync<AsyncInferRequest>();
+
+    auto syncRequestImpl = CreateInferRequestImpl(_parameters, _results);
+    syncRequestImpl->setPointerToExecutableNetworkInternal(shared_from_this());
+    return std::make_shared<AsyncInferRequest>(syncRequestImpl, _taskExecutor, _callbackExecutor, GetDynamicBatcher());
+}
+
+DynamicBatcher::Ptr ExecNetwork::GetDynamicBatcher() {
+    std::lock_guard<std::mutex> lock{*_mutex.get()};
+    auto batcher = _batcher.lock();
+    if (batcher)
+        return batcher;
+
+    std::vector<std::string> inputNames, outputNames;
+    for (const auto& parameter : _parameters) {
+        inputNames.push_back(ngraph::op::util::get_ie_output_name(ngraph::Output<const ngraph::Node>(parameter)));
+    }
+    for (const auto& result : _results) {
+        outputNames.push_back(ngraph::op::util::get_ie_output_name(result->input_value(0)));
+    }
+    auto createRequest = [this]() {
+        auto request = CreateInferRequestImpl(_parameters, _results);
+        request->setPointerToExecutableNetworkInternal(shared_from_this());
+        return request;
+    };
+    batcher = std::make_shared<DynamicBatcher>(inputNames,
+                                               outputNames,
+                                               createRequest,
+                                               _taskExecutor,
+                                               _cfg.dynamicBatchingMaxBatch,
+                                               std::chrono::milliseconds(_cfg.dynamicBatchingTimeout),
+                                               _batchingStatistics);
+    _batcher = batcher;
+    return batcher;
 }
 
 std::shared_ptr<ngraph::Function> ExecNetwork::GetExecGraphInfo() {
@@ -284,9 +409,56 @@ InferenceEngine::Parameter ExecNetwork::GetMetricLegacy(const std::string &name,
     }
 }
 
+MultiCache::Statistics ExecNetwork::GetRuntimeCacheStatistics() const {
+    if (_rtParamsCache)
+        return _rtParamsCache->getStatistics();
+
+    MultiCache::Statistics total;
+    for (auto& graph : _graphs) {
+        auto graphLock = GraphGuard::Lock(graph);
+        auto cache = graphLock._graph.getRuntimeCache();
+        if (!cache)
+            continue;
+        auto stats = cache->getStatistics();
+        total.hits += stats.hits;
+        total.misses += stats.misses;
+        total.evictions += stats.evictions;
+    }
+    return total;
+}
+
+Graph::ShapeInferStatistics ExecNetwork::GetShapeInferStatistics() const {
+    Graph::ShapeInferStatistics total;
+    for (auto& graph : _graphs) {
+        auto graphLock = GraphGuard::Lock(graph);
+        const auto stats = graphLock._graph.getShapeInferStatistics();
+        total.memoHits += stats.memoHits;
+        total.memoMisses += stats.memoMisses;
+        total.fastPathHits += stats.fastPathHits;
+    }
+    return total;
+}
+
 InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const {
     if (_graphs.empty())
         IE_THROW() << "No graph was found";
+
+    if (name == ov::intel_cpu::runtime_cache_statistics && !isLegacyAPI()) {
+        // must be collected before the current stream graph is locked below
+        const auto stats = GetRuntimeCacheStatistics();
+        return decltype(ov::intel_cpu::runtime_cache_statistics)::value_type{
+            {"hits", stats.hits},
+            {"misses", stats.misses},
+            {"evictions", stats.evictions}};
+    }
+    if (name == ov::intel_cpu::shape_inference_statistics && !isLegacyAPI()) {
+        // must be collected before the current stream graph is locked below
+        const auto stats = GetShapeInferStatistics();
+        return decltype(ov::intel_cpu::shape_inference_statistics)::value_type{
+            {"memo_hits", stats.memoHits},
+            {"memo_misses", stats.memoMisses},
+            {"fast_path_hits", stats.fastPathHits}};
+    }
     // @todo Can't we just use local copy (_cfg) instead?
     auto graphLock = GetGraph();
     const auto& graph = graphLock._graph;
@@ -312,6 +484,13 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
             RO_property(ov::hint::inference_precision.name()),
             RO_property(ov::hint::performance_mode.name()),
             RO_property(ov::hint::num_requests.name()),
+            RO_property(ov::intel_cpu::runtime_cache_statistics.name()),
+            RO_property(ov::intel_cpu::shape_inference_statistics.name()),
+            RO_property(ov::intel_cpu::compile_peak_memory.name()),
+            RO_property(ov::intel_cpu::weights_memory_per_numa_node.name()),
+            RO_property(ov::intel_cpu::dynamic_batching_average_batch.name()),
+            RO_property(ov::intel_cpu::streams_queue_wait_time.name()),
+            RO_property(ov::intel_cpu::deadline_misses.name()),
         };
     }
 
@@ -354,6 +533,28 @@ InferenceEngine::Parameter ExecNetwork::GetMetric(const std::string &name) const
     } else if (name == ov::hint::num_requests) {
         const auto perfHintNumRequests = config.perfHintsConfig.ovPerfHintNumRequests;
         return decltype(ov::hint::num_requests)::value_type(perfHintNumRequests);
+    } else if (name == ov::intel_cpu::compile_peak_memory) {
+        return decltype(ov::intel_cpu::compile_peak_memory)::value_type(_compilePeakMemory);
+    } else if (name == ov::intel_cpu::weights_memory_per_numa_node) {
+        decltype(ov::intel_cpu::weights_memory_per_numa_node)::value_type report;
+        for (const auto& item : _numaNodesWeights.getMemoryPerNumaNode()) {
+            report[std::to_string(item.first)] = item.second;
+        }
+        return report;
+    } else if (name == ov::intel_cpu::dynamic_batching_average_batch) {
+        const auto averageBatch = _batchingStatistics ? _batchingStatistics->averageBatch() : 0.f;
+        return decltype(ov::intel_cpu::dynamic_batching_average_batch)::value_type(averageBatch);
+    } else if (name == ov::intel_cpu::streams_queue_wait_time) {
+        decltype(ov::intel_cpu::streams_queue_wait_time)::value_type report;
+        if (auto streamsExecutor = std::dynamic_pointer_cast<InferenceEngine::CPUStreamsExecutor>(_taskExecutor)) {
+            for (const auto& item : streamsExecutor->GetQueueWaitStatistics()) {
+                if (item.executedTasks)
+                    report[std::to_string(item.streamId)] = item.waitTime.count() / item.executedTasks;
+            }
+        }
+        return report;
+    } else if (name == ov::intel_cpu::deadline_misses) {
+        return decltype(ov::intel_cpu::deadline_misses)::value_type(_deadlineMisses->load());
     }
     /* Internally legacy parameters are used with new API as part of migration procedure.
      * This fallback can be removed as soon as migration completed */
@@ -543,7 +744,25 @@ bool ExecNetwork::CanProcessDynBatch(const InferenceEngine::CNNNetwork &network)
 }
 
 void ExecNetwork::Export(std::ostream& modelStream) {
-    CNNNetworkSerializer serializer(modelStream, extensionManager);
+    std::map<std::string, std::string> primitives;
+    {
+        auto graphLock = GetGraph();
+        for (const auto& node : graphLock._graph.GetNodes()) {
+            if (auto selectedPD = node->getSelectedPrimitiveDescriptor())
+                primitives.emplace(node->getName(), Node::describePrimitiveDescriptor(*selectedPD));
+        }
+    }
+
+    // the compiled model may be narrowed by the shape upper bounds, so the declared shapes are exported separately
+    std::map<std::string, std::string> shapes;
+    for (const auto& input : getInputs()) {
+        shapes.emplace(ngraph::op::util::get_ie_output_name(input->output(0)), input->get_output_partial_shape(0).to_string());
+    }
+    for (const auto& output : getOutputs()) {
+        shapes.emplace(ngraph::op::util::create_ie_output_name(output->input_value(0)), output->get_input_partial_shape(0).to_string());
+    }
+
+    CNNNetworkSerializer serializer(modelStream, extensionManager, std::move(primitives), std::move(shapes));
     serializer <<_network;
 }
 
@@ -9,6 +9,8 @@
 
 #include "graph.h"
 #include "extension_mngr.h"
+#include "cache/shapes_store.h"
+#include "dynamic_batcher.h"
 #include <threading/ie_thread_local.hpp>
 
 #include <vector>
@@ -40,6 +42,10 @@ public:
 
     void setProperty(const std::map<std::string, std::string> &properties);
 
+    void setCompilePeakMemory(uint64_t bytes) {
+        _compilePeakMemory = bytes;
+    }
+
     InferenceEngine::Parameter GetConfig(const std::string &name) const override;
 
     InferenceEngine::Parameter GetMetric(const std::string &name) const override;
@@ -50,6 +56,7 @@ public:
 
 protected:
     friend class InferRequestBase;
+    friend class AsyncInferRequest;
     ExtensionManager::Ptr extensionManager;
     std::vector<InferenceEngine::IVariableStateInternal::Ptr> memoryStates;
     const InferenceEngine::CNNNetwork           _network;
@@ -70,6 +77,18 @@ protected:
     // WARNING: Do not use _graphs directly.
     mutable std::deque<GraphGuard>              _graphs;
     mutable NumaNodesWeights                    _numaNodesWeights;
+    // runtime parameters cache shared by the graphs of all streams (empty if each graph owns its cache)
+    MultiCachePtr                               _rtParamsCache;
+    // storage of the input shapes met by a dynamic model, used to fill the runtime cache after the process restart
+    InputShapesStore::Ptr                       _shapesStore;
+    // growth of the process resident set size at the compilation peak relative to the compilation start, bytes
+    uint64_t                                    _compilePeakMemory = 0;
+    // cross-request batching of a dynamic batch model, the statistics are set only if the batching is enabled
+    std::shared_ptr<DynamicBatcher::Statistics> _batchingStatistics;
+    // the batcher is owned by the infer requests, so it is destroyed with the last one
+    std::weak_ptr<DynamicBatcher>               _batcher;
+    // the number of the infer requests which have missed their deadline, shared with the requests
+    std::shared_ptr<std::atomic<uint64_t>>      _deadlineMisses = std::make_shared<std::atomic<uint64_t>>(0);
 
     /* WARNING: Use GetGraph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -85,6 +104,14 @@ protected:
     InferenceEngine::Parameter GetConfigLegacy(const std::string &name) const;
 
     InferenceEngine::Parameter GetMetricLegacy(const std::string &name, const GraphGuard& graph) const;
+
+    MultiCache::Statistics GetRuntimeCacheStatistics() const;
+    Graph::ShapeInferStatistics GetShapeInferStatistics() const;
+
+    void GrowMemoryToUpperBounds(const std::shared_ptr<const ov::Model>& function);
+    void WarmUpRuntimeCache(const std::shared_ptr<const ov::Model>& function);
+
+    DynamicBatcher::Ptr GetDynamicBatcher();
 };
 
 }   // namespace intel_cpu
@@ -6,6 +6,7 @@
 #include "ngraph_transformations/op/fully_connected.hpp"
 #include "ngraph_transformations/op/interaction.hpp"
 #include "ngraph_transformations/op/leaky_relu.hpp"
+#include "ngraph_transformations/op/masked_select.hpp"
 #include "ngraph_transformations/op/power_static.hpp"
 #include "ngraph_transformations/op/swish_cpu.hpp"
 #include "ngraph_transformations/op/mha.hpp"
@@ -50,6 +51,7 @@ std::map<std::string, ngraph::OpSet> Extension::getOpSets() {
         NGRAPH_OP(PowerStaticNode, ov::intel_cpu)
         NGRAPH_OP(SwishNode, ov::intel_cpu)
         NGRAPH_OP(MHANode, ov::intel_cpu)
+        NGRAPH_OP(MaskedSelectNode, ov::intel_cpu)
         NGRAPH_OP(LoadConvertSaturation, ov::intel_cpu)
         NGRAPH_OP(LoadConvertTruncation, ov::intel_cpu)
         NGRAPH_OP(StoreConvertSaturation, ov::intel_cpu)
@@ -131,10 +133,14 @@ std::map<std::string, ngraph::OpSet> Extension::getOpSets() {
         ngraph::OpSet opset;
 
 #define NGRAPH_OP(NAME, NAMESPACE) opset.insert<NAMESPACE::NAME>();
+        NGRAPH_OP(AccumulateMax, ngraph::snippets::op)
+        NGRAPH_OP(AccumulateSum, ngraph::snippets::op)
         NGRAPH_OP(BroadcastLoad, ngraph::snippets::op)
         NGRAPH_OP(BroadcastMove, ngraph::snippets::op)
         NGRAPH_OP(ConvertSaturation, ngraph::snippets::op)
         NGRAPH_OP(ConvertTruncation, ngraph::snippets::op)
+        NGRAPH_OP(HorizonMax, ngraph::snippets::op)
+        NGRAPH_OP(HorizonSum, ngraph::snippets::op)
         NGRAPH_OP(Kernel, ngraph::snippets::op)
         NGRAPH_OP(Load, ngraph::snippets::op)
         NGRAPH_OP(Nop, ngraph::snippets::op)
@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <string>
 #include <map>
+#include <set>
 #include <vector>
 #include <tuple>
 #include <unordered_set>
@@ -13,6 +14,7 @@
 #include <unordered_map>
 #include <memory>
 #include <utility>
+#include <exception>
 
 #include "graph.h"
 #include "graph_dumper.h"
@@ -29,6 +31,7 @@
 #include "nodes/fullyconnected.h"
 
 #include <ie_algorithm.hpp>
+#include <ie_parallel.hpp>
 #include <blob_factory.hpp>
 #include "nodes/common/cpu_memcpy.h"
 #include "nodes/common/cpu_convert.h"
@@ -75,7 +78,7 @@ Graph::~Graph() {
 
 template<typename NET>
 void Graph::CreateGraph(NET &net, const ExtensionManager::Ptr& extMgr,
-        WeightsSharing::Ptr &w_cache, const std::shared_ptr<std::mutex>& mutex) {
+        WeightsSharing::Ptr &w_cache, const std::shared_ptr<std::mutex>& mutex, const MultiCachePtr& rtCache) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "CreateGraph");
 
     if (IsReady())
@@ -83,7 +86,7 @@ void Graph::CreateGraph(NET &net, const ExtensionManager::Ptr& extMgr,
     // disable weights caching if graph was created only once
     weightsCache = config.streamExecutorConfig._streams != 1 ? w_cache : nullptr;
 
-    rtParamsCache = std::make_shared<MultiCache>(config.rtCacheCapacity);
+    rtParamsCache = rtCache ? rtCache : std::make_shared<MultiCache>(config.rtCacheCapacity);
     sharedMutex = mutex;
     rtScratchPad = std::make_shared<DnnlScratchPad>(getEngine());
 
@@ -126,9 +129,9 @@ void Graph::CreateGraph(const std::vector<NodePtr> &graphNodes,
 }
 
 template void Graph::CreateGraph(const std::shared_ptr<const ngraph::Function>&,
-        const ExtensionManager::Ptr&, WeightsSharing::Ptr&, const std::shared_ptr<std::mutex>& mutex);
+        const ExtensionManager::Ptr&, WeightsSharing::Ptr&, const std::shared_ptr<std::mutex>& mutex, const MultiCachePtr&);
 template void Graph::CreateGraph(const CNNNetwork&,
-        const ExtensionManager::Ptr&, WeightsSharing::Ptr&, const std::shared_ptr<std::mutex>& mutex);
+        const ExtensionManager::Ptr&, WeightsSharing::Ptr&, const std::shared_ptr<std::mutex>& mutex, const MultiCachePtr&);
 
 void Graph::Replicate(const std::shared_ptr<const ov::Model> &subgraph, const ExtensionManager::Ptr& extMgr) {
     this->_name = "subgraph";
@@ -436,6 +439,16 @@ void Graph::InitGraph() {
     // we disalbe io mem reuse for the case of dynamic shapes.
     if (haveDynNodes) {
         this->reuse_io_tensors = false;
+        shapesDefinedByInputs = AreShapesDefinedByInputs();
+    }
+
+    parallelBranches = !haveDynNodes && CanExecuteBranchesInParallel();
+    if (parallelBranches) {
+        // The shared scratchpad would be overwritten by concurrently executed nodes, so each node gets its own one.
+        for (auto& node : graphNodes) {
+            if (!node->isConstant())
+                node->setRuntimeScratchPad(std::make_shared<DnnlScratchPad>(getEngine()));
+        }
     }
 
     Allocate();
@@ -449,6 +462,9 @@ void Graph::InitGraph() {
 #endif
     ExtractConstantAndExecutableNodes();
 
+    if (parallelBranches)
+        BuildParallelPlan();
+
     ExecuteConstantNodesOnly();
     status = haveDynNodes ? Status::ReadyDynamic : Status::ReadyStatic;
 }
@@ -460,8 +476,52 @@ void Graph::InitNodes() {
     }
 }
 
+void Graph::ForEachNode(const std::function<void(const NodePtr&)>& func, bool concurrent) const {
+    if (!concurrent || graphNodes.size() < 2) {
+        for (const auto& node : graphNodes)
+            func(node);
+        return;
+    }
+
+    // the constness is evaluated lazily walking through the neighbouring nodes, so it's resolved beforehand
+    for (const auto& node : graphNodes)
+        node->isConstant();
+
+    // The runtime cache owned by the graph is exclusive, since it's used by the inferences of a single stream. The nodes
+    // processed concurrently look up a thread safe cache of this phase instead, and get back the graph one afterwards.
+    const bool useCompileCache = rtParamsCache->getMode() != MultiCache::Mode::Concurrent;
+    if (useCompileCache) {
+        auto compileCache = std::make_shared<MultiCache>(config.rtCacheCapacity, MultiCache::Mode::Concurrent);
+        for (const auto& node : graphNodes)
+            node->setRuntimeCache(compileCache);
+    }
+
+    // The cost of the nodes differs by orders of magnitude, so the threads pick the nodes one by one instead of the
+    // static split. The exceptions must not leave the worker threads, the one of the first node in the topological
+    // order is rethrown.
+    std::vector<std::exception_ptr> errors(graphNodes.size());
+    std::atomic<size_t> next{0};
+    parallel_nt(0, [&](const int, const int) {
+        for (size_t i = next++; i < graphNodes.size(); i = next++) {
+            try {
+                func(graphNodes[i]);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        }
+    });
+    if (useCompileCache) {
+        for (const auto& node : graphNodes)
+            node->setRuntimeCache(rtParamsCache);
+    }
+    for (const auto& error : errors) {
+        if (error)
+            std::rethrow_exception(error);
+    }
+}
+
 void Graph::InitDescriptors() {
-    OV_ITT_SCOPE_CHAIN(FIRST_INFERENCE, taskChain, itt::domains::intel_cpu_LT, "InitDescriptors", "Prepare");
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::InitDescriptors");
 
     for (auto &node : graphNodes) {
         if (node->getType() == Type::Input && _normalizePreprocMap.find(node->getName()) != _normalizePreprocMap.end()) {
@@ -469,26 +529,38 @@ void Graph::InitDescriptors() {
             if (inputNode)
                 inputNode->withMeanImage();
         }
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.getSupportedDescriptors);
-        node->getSupportedDescriptors();
-
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.initSupportedPrimitiveDescriptors);
-        node->initSupportedPrimitiveDescriptors();
+    }
 
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.filterSupportedPrimitiveDescriptors);
-        node->filterSupportedPrimitiveDescriptors();
+    // The supported descriptors of a node depend only on the node itself and the shapes / precisions of its ports,
+    // so the nodes are processed concurrently. The primitive descriptors iteration dominates the compilation time.
+    ForEachNode([](const NodePtr& node) {
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.getSupportedDescriptors);
+            node->getSupportedDescriptors();
+        }
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.initSupportedPrimitiveDescriptors);
+            node->initSupportedPrimitiveDescriptors();
+        }
+        {
+            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.filterSupportedPrimitiveDescriptors);
+            node->filterSupportedPrimitiveDescriptors();
+        }
+    }, config.parallelCompilation);
 
 #ifdef CPU_DEBUG_CAPS
+    for (auto &node : graphNodes) {
         DEBUG_LOG("==================");
         for (auto & pd : node->getSupportedPrimitiveDescriptors())
             DEBUG_LOG("#", node->getExecIndex(),
                       " ", node->getName(),
                       "  SupportedPrimitiveDescriptor:\n", pd);
-#endif
     }
+#endif
 
+    // the selection depends on the descriptors selected for the parent nodes, so it follows the topological order
     for (auto &node : graphNodes) {
-        OV_ITT_SCOPE_NEXT(FIRST_INFERENCE, taskChain, node->profiling.selectOptimalPrimitiveDescriptor);
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.selectOptimalPrimitiveDescriptor);
         node->selectOptimalPrimitiveDescriptor();
     }
 }
@@ -522,6 +594,87 @@ void Graph::ExtractConstantAndExecutableNodes() {
     }
 }
 
+bool Graph::CanExecuteBranchesInParallel() const {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    if (!config.parallelBranches)
+        return false;
+
+    // nothing to gain unless at least one node feeds several independent consumers
+    for (const auto& node : graphNodes) {
+        if (node->isConstant())
+            continue;
+        std::unordered_set<Node*> consumers;
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            auto child = node->getChildEdgeAt(i)->getChild();
+            if (child->getType() != Type::Output)
+                consumers.insert(child.get());
+        }
+        if (consumers.size() > 1)
+            return true;
+    }
+#endif
+    return false;
+}
+
+void Graph::BuildParallelPlan() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::BuildParallelPlan");
+    const size_t numNodes = executableGraphNodes.size();
+    std::unordered_map<Node*, size_t> execInds;
+    for (size_t i = 0; i < numNodes; i++)
+        execInds[executableGraphNodes[i].get()] = i;
+
+    // Nodes writing to the memory of their inputs or to the variable states rely on the strict execution order,
+    // so they are executed as barriers: after all the preceding nodes and before all the following ones.
+    auto isBarrier = [](const NodePtr& node) {
+        return node->isInPlace() || one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput);
+    };
+
+    std::vector<std::set<size_t>> predecessors(numNodes);
+    size_t lastBarrier = numNodes;
+    for (size_t i = 0; i < numNodes; i++) {
+        const auto& node = executableGraphNodes[i];
+        if (isBarrier(node)) {
+            for (size_t j = (lastBarrier == numNodes ? 0 : lastBarrier); j < i; j++)
+                predecessors[i].insert(j);
+            lastBarrier = i;
+            continue;
+        }
+        if (lastBarrier != numNodes)
+            predecessors[i].insert(lastBarrier);
+
+        // closest executable producers, looking through the optimized out (non executable) nodes
+        std::vector<Node*> toVisit;
+        std::unordered_set<Node*> visited;
+        toVisit.push_back(node.get());
+        while (!toVisit.empty()) {
+            auto current = toVisit.back();
+            toVisit.pop_back();
+            for (size_t k = 0; k < current->getParentEdges().size(); k++) {
+                auto parent = current->getParentEdgeAt(k)->getParent().get();
+                if (parent->isConstant() || !visited.insert(parent).second)
+                    continue;
+                auto itr = execInds.find(parent);
+                if (itr != execInds.end()) {
+                    predecessors[i].insert(itr->second);
+                } else {
+                    toVisit.push_back(parent);
+                }
+            }
+        }
+    }
+
+    parallelPlan.successors.assign(numNodes, {});
+    parallelPlan.numPredecessors.assign(numNodes, 0);
+    parallelPlan.roots.clear();
+    for (size_t i = 0; i < numNodes; i++) {
+        parallelPlan.numPredecessors[i] = predecessors[i].size();
+        for (auto pred : predecessors[i])
+            parallelPlan.successors[pred].push_back(i);
+        if (predecessors[i].empty())
+            parallelPlan.roots.push_back(i);
+    }
+}
+
 void Graph::ExecuteConstantNodesOnly() const {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::ExecuteConstantNodesOnly");
     dnnl::stream stream(eng);
@@ -660,6 +813,54 @@ static inline bool isConstOutput(EdgePtr edge) {
     return edge->getParent()->isConstant() && !edge->getChild()->isConstant();
 }
 
+// For every node finds the range of the execution indices of the nodes which may be executed concurrently with it
+// (the node itself included) when the independent branches are executed in parallel. Only the data dependencies are
+// taken into account, the barrier nodes of the parallel plan may only narrow the real concurrency down.
+static void findConcurrentRanges(const std::vector<NodePtr>& graphNodes, std::vector<int>& first, std::vector<int>& last) {
+    const size_t numNodes = graphNodes.size();
+    const size_t numWords = div_up(numNodes, 64);
+    // the bitset of the nodes reachable from the node, i.e. executed strictly after it
+    std::vector<std::vector<uint64_t>> descendants(numNodes, std::vector<uint64_t>(numWords, 0));
+    auto isDescendant = [&](size_t node, size_t other) {
+        return (descendants[node][other / 64] >> (other % 64)) & 1;
+    };
+
+    for (size_t i = numNodes; i-- > 0;) {
+        const auto& node = graphNodes[i];
+        if (node->isConstant())
+            continue;
+        auto& nodeDescendants = descendants[i];
+        for (size_t k = 0; k < node->getChildEdges().size(); k++) {
+            const size_t child = node->getChildEdgeAt(k)->getChild()->getExecIndex();
+            nodeDescendants[child / 64] |= uint64_t(1) << (child % 64);
+            const auto& childDescendants = descendants[child];
+            for (size_t w = 0; w < numWords; w++)
+                nodeDescendants[w] |= childDescendants[w];
+        }
+    }
+
+    // the constant nodes are executed once on load, so they don't overlap with anything
+    first.resize(numNodes);
+    last.resize(numNodes);
+    for (size_t i = 0; i < numNodes; i++) {
+        first[i] = last[i] = static_cast<int>(i);
+        if (graphNodes[i]->isConstant())
+            continue;
+        for (size_t m = 0; m < i; m++) {
+            if (!graphNodes[m]->isConstant() && !isDescendant(m, i)) {
+                first[i] = static_cast<int>(m);
+                break;
+            }
+        }
+        for (size_t m = numNodes - 1; m > i; m--) {
+            if (!graphNodes[m]->isConstant() && !isDescendant(i, m)) {
+                last[i] = static_cast<int>(m);
+                break;
+            }
+        }
+    }
+}
+
 static edge_clusters_t findEdgeClusters(const std::vector<EdgePtr> & graphEdges) {
     typedef std::unordered_map<EdgePtr, size_t> edge_cluster_idx_map_t;
 
@@ -738,6 +939,13 @@ void Graph::AllocateWithReuse() {
 
     const int64_t alignment = 32;  // 32 bytes
 
+    // Concurrently executed branches break the linear lifetime model the solver relies on, so the lifetime of a tensor
+    // is extended over all the nodes which may run concurrently with its producer and consumers. Thus only the tensors
+    // of the nodes ordered by the data dependencies share memory.
+    std::vector<int> concurrentFirst, concurrentLast;
+    if (parallelBranches)
+        findConcurrentRanges(graphNodes, concurrentFirst, concurrentLast);
+
     std::vector<MemorySolver::Box> definedBoxes;
     std::vector<MemorySolver::Box> undefinedBoxes;
     for (int i = 0; i < edge_clusters.size(); i++) {
@@ -746,6 +954,10 @@ void Graph::AllocateWithReuse() {
         for (auto &edge : edge_clusters[i]) {
             int e_start = edge->getParent()->execIndex;
             int e_finish = edge->getChild()->execIndex;
+            if (parallelBranches) {
+                e_start = concurrentFirst[e_start];
+                e_finish = concurrentLast[e_finish];
+            }
 
             if (boxSize != -1 && edge->getDesc().hasDefinedMaxSize()) {
                 int64_t e_size = edge->getDesc().getMaxMemSize();  // size in bytes (from the beginning of data to the last element)
@@ -905,18 +1117,23 @@ void Graph::Allocate() {
 
 void Graph::CreatePrimitives() {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Graph::CreatePrimitives");
-    for (auto& node : graphNodes) {
+    // The memory of all the edges is allocated by now, so the nodes don't depend on each other while creating the
+    // primitives. The shared state (runtime cache, weights cache, scratchpad) is thread safe in the concurrent mode.
+    ForEachNode([](const NodePtr& node) {
         OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, node->profiling.createPrimitive);
-        DEBUG_LOG(*node);
         node->createPrimitive();
+    }, config.parallelCompilation);
+
 #ifdef CPU_DEBUG_CAPS
+    for (auto& node : graphNodes) {
+        DEBUG_LOG(*node);
         if (node->prim) {
             auto pd_c = (*node->prim).get_primitive_desc();
             auto* pd = reinterpret_cast<const dnnl_primitive_desc*>(pd_c);
             DEBUG_LOG("verbose##", node->getName(), "##", pd->info(), "\n");
         }
-#endif
     }
+#endif
 }
 
 void Graph::PushInputData(const std::string& name, const InferenceEngine::Blob::Ptr &in) {
@@ -1082,6 +1299,56 @@ void Graph::InferStatic(InferRequestBase* request) {
     }
 }
 
+void Graph::InferParallel(InferRequestBase* request) {
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    std::vector<std::atomic<size_t>> pendingCount(executableGraphNodes.size());
+    for (size_t i = 0; i < pendingCount.size(); ++i) {
+        pendingCount[i].store(parallelPlan.numPredecessors[i]);
+    }
+
+    // The nodes are executed as tasks of the current TBB arena, so the nested parallel_for calls of the concurrently
+    // running nodes share the stream threads through work stealing.
+    tbb::task_group tg;
+    std::function<void(size_t)> executeFrom;
+    executeFrom = [&](size_t node_indx) {
+        dnnl::stream stream(eng);
+        while (true) {
+            const auto& node = executableGraphNodes[node_indx];
+            {
+                VERBOSE(node, config.verbose);
+                PERF(node, config.collectPerfCounters);
+
+                if (request)
+                    request->ThrowIfCanceled();
+                ExecuteNode(node, stream);
+            }
+
+            // the first ready successor continues in the current task to keep its inputs in cache
+            size_t next = pendingCount.size();
+            for (auto succ : parallelPlan.successors[node_indx]) {
+                if (--pendingCount[succ] == 0) {
+                    if (next == pendingCount.size()) {
+                        next = succ;
+                    } else {
+                        tg.run([=, &executeFrom](){ executeFrom(succ); });
+                    }
+                }
+            }
+            if (next == pendingCount.size())
+                break;
+            node_indx = next;
+        }
+    };
+
+    for (auto root : parallelPlan.roots) {
+        tg.run([=, &executeFrom](){ executeFrom(root); });
+    }
+    tg.wait();
+#else
+    InferStatic(request);
+#endif
+}
+
 void Graph::InferDynamic(InferRequestBase* request) {
     dnnl::stream stream(eng);
 
@@ -1094,6 +1361,11 @@ void Graph::InferDynamic(InferRequestBase* request) {
     }
     syncIndsWorkSet.insert(executableGraphNodes.size());
 
+    auto inputDims = GetInputDims();
+    const bool shapesRepeated = shapesDefinedByInputs && inputDims == lastInferInputDims;
+    // the nodes state is consistent with the input shapes only after the whole inference is done
+    lastInferInputDims.clear();
+
     std::function<void(size_t)> updateNodes;
 
 #if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
@@ -1156,6 +1428,12 @@ void Graph::InferDynamic(InferRequestBase* request) {
         }
     };
 #endif
+    if (shapesRepeated) {
+        // the shapes and the params of all the nodes have been already updated for these input shapes
+        updateNodes = [](size_t) {};
+        fastPathHits++;
+    }
+
     size_t inferCounter = 0;
 
     for (auto stopIndx : syncIndsWorkSet) {
@@ -1170,6 +1448,57 @@ void Graph::InferDynamic(InferRequestBase* request) {
             ExecuteNode(node, stream);
         }
     }
+
+    lastInferInputDims = std::move(inputDims);
+}
+
+std::vector<VectorDims> Graph::GetInputDims() const {
+    std::vector<VectorDims> inputDims;
+    inputDims.reserve(inputNodesMap.size());
+    for (const auto& input : inputNodesMap) {
+        const auto& node = input.second;
+        inputDims.push_back(node->getChildEdges().empty() ? VectorDims{} : node->getChildEdgeAt(0)->getMemory().getStaticDims());
+    }
+    return inputDims;
+}
+
+bool Graph::AreShapesDefinedByInputs() const {
+    // the values of constants, ShapeOf outputs and the nodes computed only from them are defined by the input shapes,
+    // graphNodes are sorted topologically, so the parents are visited first
+    std::unordered_set<const Node*> shapeDerived;
+    for (const auto& node : graphNodes) {
+        bool derived = node->isConstant() || node->getType() == Type::ShapeOf;
+        if (!derived && !node->getParentEdges().empty() && !one_of(node->getType(), Type::Input, Type::MemoryInput)) {
+            derived = true;
+            for (size_t i = 0; i < node->getParentEdges().size() && derived; i++) {
+                derived = shapeDerived.count(node->getParentEdgeAt(i)->getParent().get()) != 0;
+            }
+        }
+        if (derived)
+            shapeDerived.insert(node.get());
+    }
+
+    // the shapes depending on the input data (e.g. NonZero output or Reshape by a data tensor) may change even if
+    // the input shapes repeat
+    for (const auto& item : syncNodesInds) {
+        const auto node = item.first;
+        const auto portMask = node->shapeInference->get_port_mask();
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            if ((portMask & (1 << i)) && !shapeDerived.count(node->getParentEdgeAt(i)->getParent().get()))
+                return false;
+        }
+    }
+    return true;
+}
+
+Graph::ShapeInferStatistics Graph::getShapeInferStatistics() const {
+    ShapeInferStatistics statistics;
+    for (const auto& node : graphNodes) {
+        statistics.memoHits += node->shapeInferMemoHits;
+        statistics.memoMisses += node->shapeInferMemoMisses;
+    }
+    statistics.fastPathHits = fastPathHits;
+    return statistics;
 }
 
 inline void Graph::ExecuteNode(const NodePtr& node, const dnnl::stream& stream) const {
@@ -1192,7 +1521,11 @@ void Graph::Infer(InferRequestBase* request) {
     if (Status::ReadyDynamic == status) {
         InferDynamic(request);
     } else if (Status::ReadyStatic == status) {
-        InferStatic(request);
+        if (parallelBranches) {
+            InferParallel(request);
+        } else {
+            InferStatic(request);
+        }
     } else {
         IE_THROW() << "Unknown ov::intel_cpu::Graph state: " << static_cast<size_t>(status);
     }
@@ -1200,6 +1533,41 @@ void Graph::Infer(InferRequestBase* request) {
     if (infer_count != -1) infer_count++;
 }
 
+void Graph::WarmUp(const std::map<std::string, VectorDims>& inputShapes) {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "Graph::WarmUp");
+    if (Status::ReadyDynamic != status || HasDataDependentShapes())
+        return;
+
+    // the execution must not change the variable states
+    for (const auto& node : graphNodes) {
+        if (one_of(node->getType(), Type::MemoryInput, Type::MemoryOutput))
+            return;
+    }
+
+    for (const auto& input : inputNodesMap) {
+        auto itr = inputShapes.find(input.first);
+        if (itr == inputShapes.end() && inputNodesMap.size() == 1)
+            itr = inputShapes.find("");
+        if (itr == inputShapes.end())
+            IE_THROW() << "Warm up shapes don't contain the input: " << input.first;
+
+        const auto& node = input.second;
+        if (node->isDynamicNode())
+            node->redefineOutputMemory({itr->second});
+        for (size_t i = 0; i < node->getChildEdges().size(); i++) {
+            node->getChildEdgeAt(i)->getMemoryPtr()->FillZero();
+        }
+    }
+
+    InferDynamic(nullptr);
+}
+
+bool Graph::HasDataDependentShapes() const {
+    return std::any_of(graphNodes.begin(), graphNodes.end(), [](const NodePtr& node) {
+        return node->isDynamicNode() && node->outputShapeDataDependency();
+    });
+}
+
 void Graph::VisitNode(NodePtr node, std::vector<NodePtr>& sortedNodes) {
     if (node->temporary) {
         return;
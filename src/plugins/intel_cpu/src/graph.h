@@ -17,6 +17,7 @@
 #include <vector>
 #include <memory>
 #include <atomic>
+#include <functional>
 
 namespace ov {
 namespace intel_cpu {
@@ -48,11 +49,15 @@ public:
     void setProperty(const std::map<std::string, std::string> &properties);
     Config getProperty() const;
 
+    /**
+     * @param rtCache the runtime parameters cache shared with other graphs. If it is empty, the graph creates its own cache.
+     */
     template<typename NET>
     void CreateGraph(NET &network,
                      const ExtensionManager::Ptr& extMgr,
                      WeightsSharing::Ptr &w_cache,
-                     const std::shared_ptr<std::mutex>& mutex);
+                     const std::shared_ptr<std::mutex>& mutex,
+                     const MultiCachePtr& rtCache = nullptr);
 
     void CreateGraph(const std::vector<NodePtr> &graphNodes,
                      const std::vector<EdgePtr> &graphEdges,
@@ -68,6 +73,18 @@ public:
 
     void Infer(InferRequestBase* request = nullptr);
 
+    /**
+     * @brief Executes the dynamic graph once with zero filled inputs of the given shapes, so the runtime cache is filled
+     * with the primitives for these shapes. An empty input name matches the only input of the graph.
+     */
+    void WarmUp(const std::map<std::string, VectorDims>& inputShapes);
+
+    /**
+     * @brief Whether the output shapes of some nodes depend on the input data (NonZero, Reshape to a computed shape,
+     * etc.), so the shapes met by the warm up execution with zero filled inputs are meaningless.
+     */
+    bool HasDataDependentShapes() const;
+
     const std::vector<NodePtr>& GetNodes() const {
         return graphNodes;
     }
@@ -114,6 +131,18 @@ public:
         return eng;
     }
 
+    MultiCachePtr getRuntimeCache() const {
+        return rtParamsCache;
+    }
+
+    struct ShapeInferStatistics {
+        uint64_t memoHits = 0;
+        uint64_t memoMisses = 0;
+        uint64_t fastPathHits = 0;
+    };
+
+    ShapeInferStatistics getShapeInferStatistics() const;
+
     void GetPerfData(std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> &perfMap) const;
 
     void RemoveDroppedNodes();
@@ -208,6 +237,10 @@ protected:
         graphEdges.clear();
         _normalizePreprocMap.clear();
         syncNodesInds.clear();
+        parallelBranches = false;
+        parallelPlan = {};
+        shapesDefinedByInputs = false;
+        lastInferInputDims.clear();
     }
     Status status { Status::NotReady };
     Config config;
@@ -235,6 +268,8 @@ protected:
     void Replicate(const std::shared_ptr<const ov::Model> &subgraph, const ExtensionManager::Ptr& extMgr);
     void InitGraph();
     void InitNodes();
+    // Calls func for each node of the graph, concurrently for the different nodes if requested
+    void ForEachNode(const std::function<void(const NodePtr&)>& func, bool concurrent) const;
     void InitDescriptors();
     void InitOptimalPrimitiveDescriptors();
     void InitEdges();
@@ -246,6 +281,11 @@ protected:
     void ExecuteConstantNodesOnly() const;
     void InferStatic(InferRequestBase* request);
     void InferDynamic(InferRequestBase* request);
+    void InferParallel(InferRequestBase* request);
+    bool CanExecuteBranchesInParallel() const;
+    void BuildParallelPlan();
+    bool AreShapesDefinedByInputs() const;
+    std::vector<VectorDims> GetInputDims() const;
 
     friend class LegacyInferRequest;
     friend class intel_cpu::InferRequest;
@@ -268,6 +308,23 @@ private:
     DnnlScratchPadPtr rtScratchPad;
     std::unordered_map<Node*, size_t> syncNodesInds;
 
+    // Dependency DAG over executableGraphNodes, used when independent branches are executed concurrently.
+    // Indices refer to positions in executableGraphNodes.
+    struct ParallelPlan {
+        std::vector<std::vector<size_t>> successors;
+        std::vector<size_t> numPredecessors;
+        std::vector<size_t> roots;
+    };
+    bool parallelBranches = false;
+    ParallelPlan parallelPlan;
+
+    // the output shapes of all the nodes depend only on the graph input shapes, so the shapes inference and the params
+    // preparation may be skipped when the input shapes of the previous dynamic inference repeat
+    bool shapesDefinedByInputs = false;
+    // the graph input shapes of the last successfully completed dynamic inference
+    std::vector<VectorDims> lastInferInputDims;
+    uint64_t fastPathHits = 0;
+
     void EnforceBF16();
     void setMinSparseRate(float minSparseRate);
 };
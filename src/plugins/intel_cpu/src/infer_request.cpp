@@ -7,6 +7,7 @@
 #include <vector>
 #include <string>
 #include <map>
+#include <numeric>
 #include <blob_factory.hpp>
 #include "nodes/concat.h"
 #include "nodes/split.h"
@@ -138,6 +139,8 @@ void InferRequestBase::PullStates() {
 
 void InferRequestBase::redefineMemoryForInputNodes() {
     const auto cpuInputNodes = graph->GetInputNodesMap();
+    const auto& shapesStore = execNetwork->_shapesStore;
+    InputShapesStore::ShapesSet inputShapes;
 
     for (const auto &blob : _inputs) {
         const auto inputNode = cpuInputNodes.find(blob.first);
@@ -146,6 +149,14 @@ void InferRequestBase::redefineMemoryForInputNodes() {
         if (inputNode->second->isDynamicNode()) {
             inputNode->second->redefineOutputMemory({blob.second->getTensorDesc().getDims()});
         }
+        if (shapesStore)
+            inputShapes[blob.first] = blob.second->getTensorDesc().getDims();
+    }
+
+    // the store is created only if the persistent runtime cache is enabled, and the steady shapes skip its lock
+    if (shapesStore && inputShapes != lastRecordedShapes) {
+        shapesStore->record(inputShapes);
+        lastRecordedShapes = std::move(inputShapes);
     }
 }
 
@@ -185,9 +196,35 @@ void InferRequestBase::InferImpl() {
 
     ThrowIfCanceled();
 
+    placeBoundedOutputs();
     graph->PullOutputData(_outputs);
 }
 
+void InferRequestBase::placeBoundedOutputs() {
+    for (const auto& output : boundedOutputs) {
+        const auto& outputNode = graph->getOutputNodeByName(output.first);
+        placeBoundedOutput(output.first, outputNode->getParentEdgesAtPort(0)[0]->getMemory().getStaticDims());
+    }
+}
+
+bool InferRequestBase::placeBoundedOutput(const std::string& name, const InferenceEngine::SizeVector& dims) {
+    const auto buffer = boundedOutputs.find(name);
+    if (buffer == boundedOutputs.end())
+        return false;
+    auto& blob = _outputs[name];
+    if (blob->getTensorDesc().getDims() == dims)
+        return true;
+
+    // the output is placed into the same buffer, so it is never reallocated while the shapes stay within the bounds
+    const auto& desc = buffer->second->getTensorDesc();
+    const auto size = std::accumulate(dims.begin(), dims.end(), static_cast<size_t>(1), std::multiplies<size_t>());
+    if (size > buffer->second->size())
+        IE_THROW() << "The output " << name << " shape " << vec2str(dims) << " exceeds its upper bound " << vec2str(desc.getDims());
+    blob = make_blob_with_precision(InferenceEngine::TensorDesc(desc.getPrecision(), dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size())),
+                                    buffer->second->buffer());
+    return true;
+}
+
 std::map<std::string, InferenceEngine::InferenceEngineProfileInfo> InferRequestBase::GetPerformanceCounts() const {
     if (!graph || !graph->IsReady())
         IE_THROW() << "Graph is not ready!";
@@ -323,6 +360,30 @@ void InferRequestBase::ThrowIfCanceled() const {
     }
 }
 
+bool InferRequestBase::CanBeBatched() const {
+    return _preProcData.empty() && _batched_inputs.empty();
+}
+
+void InferRequestBase::PullBatchedOutput(const std::string& name, const void* data, const InferenceEngine::SizeVector& dims) {
+    ThrowIfCanceled();
+
+    auto output = GetBlob(name);
+    const auto precision = output->getTensorDesc().getPrecision();
+    if (output->getTensorDesc().getDims() != dims) {
+        if (placeBoundedOutput(name, dims)) {
+            output = _outputs[name];
+        } else {
+            // throws for the user blobs created on top of the preallocated memory which is not enough for the new shape
+            output->setShape(dims);
+        }
+    }
+    const auto byteSize = std::accumulate(dims.begin(), dims.end(), precision.size(), std::multiplies<size_t>());
+    if (output->byteSize() != byteSize)
+        IE_THROW() << "Output blob byte size is not equal network output byte size ("
+                   << output->byteSize() << "!=" << byteSize << ").";
+    cpu_memcpy(output->buffer().as<uint8_t*>(), data, byteSize);
+}
+
 InferenceEngine::Precision
 InferRequestBase::normToInputSupportedPrec(const std::pair<const std::string, InferenceEngine::Blob::Ptr>& input) const {
     const auto& inputTensorDesc = input.second->getTensorDesc();
@@ -735,6 +796,7 @@ void InferRequest::SetBlob(const std::string& name, const InferenceEngine::Blob:
                        << " and blob size = " << data->size() << " are different.";
         }
 
+        boundedOutputs.erase(name);
         const auto &desc = graph->getOutputNodeByName(name)->getParentEdgesAtPort(0)[0]->getMemory().getDesc();
         if (!isDynamic && blobDesc == MemoryDescUtils::convertToTensorDesc(desc) && !graph->getProperty().batchLimit) {
             externalPtr[name] = data->buffer();
@@ -814,8 +876,18 @@ InferenceEngine::Blob::Ptr InferRequest::GetBlob(const std::string& name) {
                     InferenceEngine::TensorDesc desc(InferenceEngine::details::convertPrecision(outputNode->second->get_input_element_type(0)),
                                                      dims, InferenceEngine::TensorDesc::getLayoutByRank(dims.size()));
 
-                    data = make_blob_with_precision(desc);
-                    data->allocate();
+                    const auto& maxDims = output->second->getInputShapeAtPort(0).getMaxDims();
+                    const auto config = graph->getProperty();
+                    if (isDynamic && (config.staticMemoryPlan || !config.shapeUpperBounds.empty()) &&
+                        std::none_of(maxDims.begin(), maxDims.end(), [](Dim dim) { return dim == Shape::UNDEFINED_DIM; })) {
+                        InferenceEngine::TensorDesc boundedDesc(desc.getPrecision(), maxDims, InferenceEngine::TensorDesc::getLayoutByRank(maxDims.size()));
+                        boundedOutputs[name] = make_blob_with_precision(boundedDesc);
+                        boundedOutputs[name]->allocate();
+                        data = make_blob_with_precision(desc, boundedOutputs[name]->buffer());
+                    } else {
+                        data = make_blob_with_precision(desc);
+                        data->allocate();
+                    }
                 } else {
                     const auto& blobDims = data->getTensorDesc().getDims();
                     // in static shape case is enough information that shapes are incompatible to throw exception
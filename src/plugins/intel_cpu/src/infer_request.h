@@ -37,6 +37,21 @@ public:
      */
     void ThrowIfCanceled() const;
 
+    /**
+     * @brief Checks that the request inputs can be passed to a combined inference as is, i.e. the request neither
+     * has the preprocessing nor the batched input tensors which InferImpl would handle
+     */
+    bool CanBeBatched() const;
+
+    /**
+     * @brief Writes the request part of a combined inference output into the request output blob following the same
+     * rules as the graph does for its own outputs
+     * @param name the output name
+     * @param data the request rows of the combined output
+     * @param dims the request output dims
+     */
+    void PullBatchedOutput(const std::string& name, const void* data, const InferenceEngine::SizeVector& dims);
+
 protected:
     InferRequestBase(InferenceEngine::InputsDataMap networkInputs,
                      InferenceEngine::OutputsDataMap networkOutputs,
@@ -57,17 +72,23 @@ protected:
 
     Graph* graph = nullptr;
     std::unordered_map<std::string, void*> externalPtr;
+    // the buffers of the plugin allocated outputs sized for the shape upper bounds, the output blobs are views on them
+    std::unordered_map<std::string, InferenceEngine::Blob::Ptr> boundedOutputs;
 
 private:
     void PushStates();
     void PullStates();
     void redefineMemoryForInputNodes();
+    void placeBoundedOutputs();
+    bool placeBoundedOutput(const std::string& name, const InferenceEngine::SizeVector& dims);
 
     void changeDefaultPtr();
     std::shared_ptr<ExecNetwork>        execNetwork;
     openvino::itt::handle_t             profilingTask;
     std::vector<std::shared_ptr<InferenceEngine::IVariableStateInternal>> memoryStates;
     AsyncInferRequest*                  _asyncRequest = nullptr;
+    // the input shapes last passed to the persistent shapes store, the repeating shapes aren't passed again
+    std::map<std::string, VectorDims>   lastRecordedShapes;
 };
 
 class LegacyInferRequest : public InferRequestBase {
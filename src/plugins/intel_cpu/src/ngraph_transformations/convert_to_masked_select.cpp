@@ -0,0 +1,65 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "convert_to_masked_select.hpp"
+
+#include <openvino/core/rt_info.hpp>
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset3.hpp>
+#include <openvino/opsets/opset5.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <openvino/pass/pattern/op/wrap_type.hpp>
+
+#include "itt.hpp"
+#include "op/masked_select.hpp"
+#include "utils/general_utils.h"
+
+ov::intel_cpu::ConvertToMaskedSelect::ConvertToMaskedSelect() {
+    MATCHER_SCOPE(ConvertToMaskedSelect);
+    using namespace ov::pass::pattern;
+    auto mask_m = any_input(has_static_rank());
+    auto non_zero_m = wrap_type<ov::opset3::NonZero>({mask_m}, consumers_count(1));
+    auto order_m = wrap_type<ov::opset1::Constant>();
+    auto transpose_m = wrap_type<ov::opset1::Transpose>({non_zero_m, order_m}, consumers_count(1));
+    auto data_m = any_input(has_static_rank());
+    auto gather_nd_m = wrap_type<ov::opset5::GatherND, ov::opset8::GatherND>({data_m, transpose_m});
+
+    matcher_pass_callback callback = [=](Matcher& m) {
+        const auto& pattern_map = m.get_pattern_value_map();
+        const auto gather_nd = m.get_match_root();
+        if (transformation_callback(gather_nd))
+            return false;
+
+        const auto gather_nd_base = std::dynamic_pointer_cast<ov::op::util::GatherNDBase>(gather_nd);
+        if (!gather_nd_base || gather_nd_base->get_batch_dims() != 0)
+            return false;
+
+        const auto order = std::dynamic_pointer_cast<ov::opset1::Constant>(pattern_map.at(order_m).get_node_shared_ptr());
+        if (order->cast_vector<int64_t>() != std::vector<int64_t>{1, 0})
+            return false;
+
+        const auto& mask = pattern_map.at(mask_m);
+        const auto& data = pattern_map.at(data_m);
+        const auto mask_rank = mask.get_partial_shape().rank().get_length();
+        if (mask_rank == 0 || mask_rank > data.get_partial_shape().rank().get_length())
+            return false;
+
+        const auto mask_type = mask.get_element_type();
+        if (!one_of(mask_type, ov::element::f32, ov::element::bf16, ov::element::i32,
+                    ov::element::u32, ov::element::i8, ov::element::u8, ov::element::boolean))
+            return false;
+
+        auto masked_select = std::make_shared<MaskedSelectNode>(data, mask);
+        masked_select->set_friendly_name(gather_nd->get_friendly_name());
+        ov::copy_runtime_info({pattern_map.at(non_zero_m).get_node_shared_ptr(),
+                               pattern_map.at(transpose_m).get_node_shared_ptr(),
+                               gather_nd},
+                              masked_select);
+        ov::replace_node(gather_nd, masked_select);
+        return true;
+    };
+
+    auto m = std::make_shared<Matcher>(gather_nd_m, matcher_name);
+    this->register_matcher(m, callback);
+}
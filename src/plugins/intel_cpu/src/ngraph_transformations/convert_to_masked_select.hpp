@@ -0,0 +1,25 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/pass/graph_rewrite.hpp>
+
+/*
+ * Description:
+ *     ConvertToMaskedSelect fuses GatherND(data, Transpose(NonZero(mask), {1, 0})) into MaskedSelect,
+ *     so the indices of the non-zero mask elements are never written to memory
+ */
+
+namespace ov {
+namespace intel_cpu {
+
+class ConvertToMaskedSelect: public ngraph::pass::MatcherPass {
+public:
+    OPENVINO_RTTI("ConvertToMaskedSelect", "0");
+    ConvertToMaskedSelect();
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
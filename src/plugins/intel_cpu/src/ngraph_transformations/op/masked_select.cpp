@@ -0,0 +1,35 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "masked_select.hpp"
+#include "../itt.hpp"
+
+ov::intel_cpu::MaskedSelectNode::MaskedSelectNode(const ngraph::Output<ngraph::Node>& data, const ngraph::Output<ngraph::Node>& mask)
+    : Op({data, mask}) {
+    validate_and_infer_types();
+}
+
+std::shared_ptr<ngraph::Node> ov::intel_cpu::MaskedSelectNode::clone_with_new_inputs(const ngraph::OutputVector& new_args) const {
+    INTERNAL_OP_SCOPE(MaskedSelectNode_clone_with_new_inputs);
+    check_new_args_count(this, new_args);
+    return std::make_shared<ov::intel_cpu::MaskedSelectNode>(new_args.at(0), new_args.at(1));
+}
+
+void ov::intel_cpu::MaskedSelectNode::validate_and_infer_types() {
+    INTERNAL_OP_SCOPE(MaskedSelectNode_validate_and_infer_types);
+    const auto& data_pshape = get_input_partial_shape(0);
+    const auto& mask_pshape = get_input_partial_shape(1);
+    NODE_VALIDATION_CHECK(this,
+        data_pshape.rank().is_static() && mask_pshape.rank().is_static(),
+        "data and mask must have static ranks");
+    const auto mask_rank = mask_pshape.rank().get_length();
+    NODE_VALIDATION_CHECK(this,
+        mask_rank > 0 && mask_rank <= data_pshape.rank().get_length(),
+        "mask rank must be in range [1, data rank]");
+
+    ov::PartialShape output_shape{ov::Dimension::dynamic()};
+    for (auto i = mask_rank; i < data_pshape.rank().get_length(); i++)
+        output_shape.push_back(data_pshape[i]);
+    set_output_type(0, get_input_element_type(0), output_shape);
+}
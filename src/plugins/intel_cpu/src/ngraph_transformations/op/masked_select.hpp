@@ -0,0 +1,34 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ngraph/node.hpp>
+#include <ngraph/op/op.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * Selects the slices of data at the positions of the non-zero mask elements, i.e. GatherND(data, Transpose(NonZero(mask)))
+ * without the indices tensor. Mask covers the leading dimensions of data, so the output shape is
+ * [number of non-zero mask elements, data dimensions after the mask ones].
+ */
+class MaskedSelectNode : public ngraph::op::Op {
+public:
+    OPENVINO_OP("MaskedSelect", "cpu_plugin_opset");
+
+    MaskedSelectNode() = default;
+
+    MaskedSelectNode(const ngraph::Output<ngraph::Node>& data, const ngraph::Output<ngraph::Node>& mask);
+
+    bool visit_attributes(ngraph::AttributeVisitor &visitor) override { return true; }
+
+    void validate_and_infer_types() override;
+
+    std::shared_ptr<Node> clone_with_new_inputs(const ngraph::OutputVector& new_args) const override;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -3,6 +3,7 @@
 //
 
 #include "node.h"
+#include "utils/rt_info/exported_primitive_attribute.hpp"
 #include "edge.h"
 #include "extension_mngr.h"
 #include "itt.h"
@@ -56,6 +57,7 @@
 #include <ie_ngraph_utils.hpp>
 #include "utils/general_utils.h"
 #include "utils/cpu_utils.hpp"
+#include <common/primitive_hashing_utils.hpp>
 #include "utils/verbose.h"
 #include "nodes/common/cpu_convert.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
@@ -164,6 +166,11 @@ Node::Node(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, Wei
         }
     }
 
+    const auto exportedIt = rtInfo.find(ExportedPrimitiveAttr);
+    if (exportedIt != rtInfo.end()) {
+        exportedPrimitive = exportedIt->second.as<std::string>();
+    }
+
     const auto it = rtInfo.find("enforceBF16evenForGraphTail");
     if (it != rtInfo.end()) {
         enforceBF16evenForGraphTail = it->second.as<bool>();
@@ -635,6 +642,8 @@ void Node::initSupportedPrimitiveDescriptors() {
             impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
 
             supportedPrimitiveDescriptors.emplace_back(config, impl_type);
+            if (isExportedPrimitive(supportedPrimitiveDescriptors.back()))
+                return;
             if (!itpd.next_impl())
                 break;
         }
@@ -673,6 +682,31 @@ void Node::filterSupportedPrimitiveDescriptors() {
             }
         }
     }
+
+    // The exported primitive descriptor may be not supported on this machine, then the selection is done as usual
+    auto exported = std::find_if(supportedPrimitiveDescriptors.begin(), supportedPrimitiveDescriptors.end(),
+                                 [this](const NodeDesc& desc) { return isExportedPrimitive(desc); });
+    if (exported != supportedPrimitiveDescriptors.end()) {
+        supportedPrimitiveDescriptors.erase(exported + 1, supportedPrimitiveDescriptors.end());
+        supportedPrimitiveDescriptors.erase(supportedPrimitiveDescriptors.begin(), exported);
+    } else if (!exportedPrimitive.empty()) {
+        DEBUG_LOG(getName(), " doesn't support the exported primitive descriptor ", exportedPrimitive);
+    }
+}
+
+std::string Node::describePrimitiveDescriptor(const NodeDesc& desc) {
+    auto describePort = [](std::stringstream& result, const PortConfig& port) {
+        result << " " << port.getMemDesc()->getPrecision().name() << ":" << port.getMemDesc()->serializeFormat();
+    };
+
+    std::stringstream result;
+    result << impl_type_to_string(desc.getImplementationType());
+    for (const auto& inConf : desc.getConfig().inConfs)
+        describePort(result, inConf);
+    result << " ->";
+    for (const auto& outConf : desc.getConfig().outConfs)
+        describePort(result, outConf);
+    return result.str();
 }
 
 void Node::initDescriptor(const NodeConfig& config) {
@@ -1506,6 +1540,17 @@ std::vector<VectorDims> Node::shapeInferGeneric(const std::vector<Shape>& shapes
     }
 }
 
+size_t Node::ShapeInferKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    for (const auto& dims : inputDims) {
+        seed = get_vector_hash(seed, dims);
+    }
+    return seed;
+}
+
 std::vector<VectorDims> Node::shapeInfer() const {
     try {
         std::vector<std::reference_wrapper<const VectorDims>> input_shapes;
@@ -1515,6 +1560,19 @@ std::vector<VectorDims> Node::shapeInfer() const {
         for (size_t port = 0; port < inputShapes.size(); ++port)
             input_shapes.emplace_back(std::ref(getParentEdgesAtPort(port)[0]->getMemory().getStaticDims()));
 
+        // the output shapes depend only on the input shapes unless some input values come from non constant nodes
+        const bool memoizable = shapeInferMemoizable && !outputShapeDataDependency();
+        ShapeInferKey key;
+        if (memoizable) {
+            key.inputDims.assign(input_shapes.begin(), input_shapes.end());
+            auto memoized = shapeInferMemo.get(key);
+            if (!memoized.empty()) {
+                shapeInferMemoHits++;
+                return memoized;
+            }
+            shapeInferMemoMisses++;
+        }
+
         std::unordered_map<size_t, MemoryPtr> input_values;
         if (input_value_port_mask) {
             for (size_t port = 0; port < inputShapes.size(); ++port) {
@@ -1524,7 +1582,15 @@ std::vector<VectorDims> Node::shapeInfer() const {
             }
         }
 
-        return shapeInference->infer(input_shapes, input_values);
+        auto result = shapeInference->infer(input_shapes, input_values);
+        if (memoizable) {
+            if (shapeInference->get_pads_begin().empty() && shapeInference->get_pads_end().empty()) {
+                shapeInferMemo.put(key, result);
+            } else {
+                shapeInferMemoizable = false;
+            }
+        }
+        return result;
     }
     catch (const std::runtime_error& exp) {
         IE_THROW() << "Shape inference of " << getTypeStr()  << " node with name " << getName() << " failed: " << exp.what();
@@ -32,6 +32,7 @@
 #include "config.h"
 #include "nodes/node_config.h"
 #include "cache/multi_cache.h"
+#include "cache/lru_cache.h"
 
 #include <utils/shape_inference/shape_inference_cpu.hpp>
 #include "utils/debug_capabilities.h"
@@ -345,10 +346,17 @@ public:
 
     /**
      * @brief Filters supportedPrimitiveDescriptors according to the input layouts specified in inputMemoryFormatsFilter
-     * and output layouts specified in outputMemoryFormatsFilter
+     * and output layouts specified in outputMemoryFormatsFilter. If the primitive descriptor selected on the export of the
+     * model is supported, only this one is kept.
      */
     virtual void filterSupportedPrimitiveDescriptors();
 
+    /**
+     * @brief Describes the primitive descriptor by its implementation type and the precisions and formats of the ports.
+     * The descriptions of the selected primitive descriptors are stored in the compiled blob.
+     */
+    static std::string describePrimitiveDescriptor(const NodeDesc& desc);
+
     virtual void createPrimitive();
 
     virtual void selectOptimalPrimitiveDescriptor();
@@ -615,9 +623,15 @@ protected:
     std::vector <dnnl::memory::format_tag> inputMemoryFormatsFilter;
     std::vector <dnnl::memory::format_tag> outputMemoryFormatsFilter;
     bool enforceBF16evenForGraphTail = false;
+    std::string exportedPrimitive;  // description of the primitive descriptor selected on the export of the model
 
     std::string originalLayers;  // contains names of the original layers separated by comma
 
+    // The primitive descriptor selected on the export is found, so the creation of the rest ones may be skipped
+    bool isExportedPrimitive(const NodeDesc& desc) const {
+        return !exportedPrimitive.empty() && describePrimitiveDescriptor(desc) == exportedPrimitive;
+    }
+
     Node(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &w_cache, const ShapeInferFactory& shapeInferFactory);
     Node(const std::string& type, const std::string& name, const dnnl::engine& eng, WeightsSharing::Ptr &w_cache);
 
@@ -733,6 +747,10 @@ protected:
 
     std::shared_ptr<IShapeInfer> shapeInference;
 
+    // the number of the shapeInfer() calls served from the memo and the ones which ran the shape inference
+    mutable uint64_t shapeInferMemoHits = 0;
+    mutable uint64_t shapeInferMemoMisses = 0;
+
     std::shared_ptr<std::mutex> sharedMutex = nullptr;
 
 private:
@@ -760,6 +778,22 @@ private:
     DnnlScratchPadPtr rtScratchPad;
     MemoryPtr scratchpadMem;
 
+    struct ShapeInferKey {
+        std::vector<VectorDims> inputDims;
+
+        size_t hash() const;
+        bool operator==(const ShapeInferKey& rhs) const {
+            return inputDims == rhs.inputDims;
+        }
+    };
+
+    // a few sequence length buckets are usual for NLP models, so keeping several output shapes per node is enough
+    static constexpr size_t shapeInferMemoCapacity = 16;
+    // the output shapes of the data independent shape inference, keyed by the input shapes
+    mutable LruCache<ShapeInferKey, std::vector<VectorDims>> shapeInferMemo{shapeInferMemoCapacity};
+    // the shape inference producing paddings can't be memoized, since the paddings are read after the inference
+    mutable bool shapeInferMemoizable = true;
+
     bool isEdgesEmpty(const std::vector<EdgeWeakPtr>& edges) const;
 
     template <class PD, class D, typename FPD>
@@ -201,7 +201,6 @@ void AdaptivePooling::execute(dnnl::stream strm) {
         indexDst = reinterpret_cast<int *>(getChildEdgeAt(1)->getMemoryPtr()->GetPtr());
     }
 
-    auto isPlainFmt = srcMemory0.getDesc().hasLayoutType(LayoutType::ncsp);
     auto isTailCFmt = srcMemory0.getDesc().hasLayoutType(LayoutType::nspc);
     auto isBlkFmt = srcMemory0.getDesc().hasLayoutType(LayoutType::nCsp16c) || srcMemory0.getDesc().hasLayoutType(LayoutType::nCsp8c);
 
@@ -254,70 +253,81 @@ void AdaptivePooling::execute(dnnl::stream strm) {
             (spatialDimsCount >= 2 ? dstStrides[spatialDimsCount + tailDimsOffset] : 0),
             dstStrides[spatialDimsCount + 1 + tailDimsOffset] };
 
-    std::function<void(const float *, float *, int, int, int, size_t)> pool;
-    auto poolMax = [&] (const float *srcData, float *dstData, int od, int oh, int ow, size_t spatIndOff) {
-        size_t dStart, dEnd, hStart, hEnd, wStart, wEnd;
-        setBinBorders(&dStart, &dEnd, od, ID, OD);
-        setBinBorders(&hStart, &hEnd, oh, IH, OH);
-        setBinBorders(&wStart, &wEnd, ow, IW, OW);
-        float res = srcData[dStart * inStrides[2] + hStart * inStrides[3] + wStart * inStrides[4]];  // initial max value
-        int resIndex = dStart * iHW + hStart * IW + wStart;  // initial max index
-        for (size_t pixD = dStart; pixD < dEnd; pixD++) {
-            for (size_t pixH = hStart; pixH < hEnd; pixH++) {
-                for (size_t pixW = wStart; pixW < wEnd; pixW++) {
-                    float curr = srcData[pixD * inStrides[2] + pixH * inStrides[3] + pixW * inStrides[4]];
-                    resIndex = (res < curr ? pixD * iHW + pixH * IW + pixW : resIndex);
-                    res = std::max(res, curr);
-                }
-            }
-        }
-        *dstData = res;
-        indexDst[spatIndOff * oDHW + od * oHW + oh * OW + ow] = resIndex;
-    };
-    auto poolAvg = [&] (const float *srcData, float *dstData, int od, int oh, int ow, size_t spatIndOff) {
-        size_t dStart, dEnd, hStart, hEnd, wStart, wEnd;
-        setBinBorders(&dStart, &dEnd, od, ID, OD);
-        setBinBorders(&hStart, &hEnd, oh, IH, OH);
-        setBinBorders(&wStart, &wEnd, ow, IW, OW);
-        auto binSize = (dEnd - dStart) * (hEnd - hStart) * (wEnd - wStart);
-        if (binSize == 0)
-            IE_THROW() << errorPrefix << "has empty bin";
-        float sum = 0;
-        for (size_t pixD = dStart; pixD < dEnd; pixD++) {
-            for (size_t pixH = hStart; pixH < hEnd; pixH++) {
-                for (size_t pixW = wStart; pixW < wEnd; pixW++) {
-                    float curr = srcData[pixD * inStrides[2] + pixH * inStrides[3] + pixW * inStrides[4]];
-                    sum = sum + curr;
-                }
-            }
-        }
-        *dstData = sum / binSize;
+    // Bins are the same for all the channels, so their borders are computed once
+    auto getBinBorders = [&](size_t inputLength, size_t outputLength) {
+        std::vector<size_t> borders(outputLength * 2);
+        for (size_t i = 0; i < outputLength; i++)
+            setBinBorders(&borders[2 * i], &borders[2 * i + 1], i, inputLength, outputLength);
+        return borders;
     };
+    const auto bordersD = getBinBorders(ID, OD);
+    const auto bordersH = getBinBorders(IH, OH);
+    const auto bordersW = getBinBorders(IW, OW);
 
-    if (algorithm == Algorithm::AdaptivePoolingMax) {
-        pool = poolMax;
-    } else {
-        pool = poolAvg;
-    }
+    // Channels of the nspc and blocked layouts are adjacent in memory, so they are the innermost loop. They are processed
+    // by the chunks to keep the accumulators on the stack.
+    constexpr int channelsChunk = 16;
+    const bool isMaxPool = algorithm == Algorithm::AdaptivePoolingMax;
 
     parallel_for5d(N, blockCount, OD, OH, OW,
         [&](int n, int blkIdx, int od, int oh, int ow) {
         auto srcData = src + n * inStrides[0] + blkIdx * inStrides[1];
         auto dstData = dst + n * outStrides[0] + blkIdx * outStrides[1] +
                        od * outStrides[2] + oh * outStrides[3] + ow * outStrides[4];
-        int cStart = 0, cEnd = C, inResidual = 0, outResidual = 0;
+        int cStart = 0, cEnd = C;
         if (!isTailCFmt) {
             cStart = blkIdx * blockSize;
             cEnd = (blkIdx == blockCount - 1 ? C : cStart + blockSize);
         }
-        for (int c = cStart; c < cEnd; c++) {
-            if (isTailCFmt) {
-                inResidual = c * inStrides[1];
-                outResidual = c * outStrides[1];
-            } else if (!isPlainFmt) {
-                inResidual = outResidual = c % blockSize;
+        const size_t dStart = bordersD[2 * od], dEnd = bordersD[2 * od + 1];
+        const size_t hStart = bordersH[2 * oh], hEnd = bordersH[2 * oh + 1];
+        const size_t wStart = bordersW[2 * ow], wEnd = bordersW[2 * ow + 1];
+        const auto binSize = (dEnd - dStart) * (hEnd - hStart) * (wEnd - wStart);
+        if (!isMaxPool && binSize == 0)
+            IE_THROW() << errorPrefix << "has empty bin";
+
+        float res[channelsChunk];
+        int resIndex[channelsChunk];
+        for (int c0 = cStart; c0 < cEnd; c0 += channelsChunk) {
+            // the channel offset is zero for the planar layout, as each channel is processed separately
+            const int cLen = std::min(channelsChunk, cEnd - c0);
+            const int cOffset = c0 - cStart;
+            if (isMaxPool) {
+                const float* initData = srcData + dStart * inStrides[2] + hStart * inStrides[3] + wStart * inStrides[4] + cOffset;
+                for (int c = 0; c < cLen; c++) {
+                    res[c] = initData[c];  // initial max value
+                    resIndex[c] = dStart * iHW + hStart * IW + wStart;  // initial max index
+                }
+            } else {
+                std::fill(res, res + cLen, 0.f);
+            }
+
+            for (size_t pixD = dStart; pixD < dEnd; pixD++) {
+                for (size_t pixH = hStart; pixH < hEnd; pixH++) {
+                    for (size_t pixW = wStart; pixW < wEnd; pixW++) {
+                        const float* pixData = srcData + pixD * inStrides[2] + pixH * inStrides[3] + pixW * inStrides[4] + cOffset;
+                        if (isMaxPool) {
+                            const int pixIndex = pixD * iHW + pixH * IW + pixW;
+                            for (int c = 0; c < cLen; c++) {
+                                resIndex[c] = (res[c] < pixData[c] ? pixIndex : resIndex[c]);
+                                res[c] = std::max(res[c], pixData[c]);
+                            }
+                        } else {
+                            for (int c = 0; c < cLen; c++)
+                                res[c] = res[c] + pixData[c];
+                        }
+                    }
+                }
+            }
+
+            for (int c = 0; c < cLen; c++) {
+                if (isMaxPool) {
+                    dstData[cOffset + c] = res[c];
+                    indexDst[(n * C + c0 + c) * oDHW + od * oHW + oh * OW + ow] = resIndex[c];
+                } else {
+                    dstData[cOffset + c] = res[c] / binSize;
+                }
             }
-            pool(srcData + inResidual, dstData + outResidual, od, oh, ow, n * C + c);
         }});
 }
 
@@ -4,6 +4,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <cstring>
 #include "ie_api.h"
 
@@ -51,5 +52,19 @@ inline int cpu_memcpy_s(void* dst, size_t dst_size, const void* src, size_t coun
     return 0;
 }
 
+/**
+ * @brief Copies the data slice of the runtime size. The slices of a single element are frequent for the scatter and
+ * gather like nodes, so the copies of the common element sizes are inlined instead of calling memcpy.
+ */
+inline void cpu_memcpy_slice(uint8_t* dst, const uint8_t* src, size_t size) {
+    switch (size) {
+        case 1: *dst = *src; break;
+        case 2: std::memcpy(dst, src, 2); break;
+        case 4: std::memcpy(dst, src, 4); break;
+        case 8: std::memcpy(dst, src, 8); break;
+        default: cpu_memcpy(dst, src, size);
+    }
+}
+
 }   // namespace intel_cpu
 }   // namespace ov
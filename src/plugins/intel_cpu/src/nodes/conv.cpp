@@ -773,6 +773,8 @@ void Convolution::initSupportedPrimitiveDescriptors() {
                     containJitImpl = true;
 
                 supportedPrimitiveDescriptors.emplace_back(config, impl_type);
+                if (isExportedPrimitive(supportedPrimitiveDescriptors.back()))
+                    return;
                 if (!itpd.next_impl())
                     break;
             }
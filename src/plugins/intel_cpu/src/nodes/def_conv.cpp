@@ -882,6 +882,7 @@ void DeformableConvolution::initSupportedPrimitiveDescriptors() {
 }
 
 void DeformableConvolution::DefConvExecutor::prepareSamplingWeights(
+        int *pSampledCoordsVector, float *pInterpWeightsVector,
         const float* offsets, const float* modulation, bool enforceRef) {
     const int MB = jcp.mb;
     const int OH = jcp.oh;
@@ -1017,8 +1018,6 @@ DeformableConvolution::DefConvExecutor::DefConvExecutor(const DefConvAttr &defCo
     offStrides = descVector[OFF_ID]->getStrides();
     weiStrides = descVector[WEI_ID]->getStrides();
     dstStrides = std::vector<size_t>(dstDesc->getStrides().size());
-    pSampledCoordsVector = nullptr;
-    pInterpWeightsVector = nullptr;
     for (int i = 0; i < srcDesc->getStrides().size(); i++) {
         srcStrides[srcDesc->getOrder()[i]] = srcDesc->getStrides()[i];
     }
@@ -1104,9 +1103,7 @@ DeformableConvolution::DefConvJitExecutor::DefConvJitExecutor(const DefConvAttr
 void DeformableConvolution::DefConvRefExecutor::exec(const float* src, const float* offsets,
         const float* weights, const float* modulation, float* dst,
         int *pSampledCoordsVector, float *pInterpWeightsVector) {
-    this->pSampledCoordsVector = pSampledCoordsVector;
-    this->pInterpWeightsVector = pInterpWeightsVector;
-    prepareSamplingWeights(offsets, modulation, true);
+    prepareSamplingWeights(pSampledCoordsVector, pInterpWeightsVector, offsets, modulation, true);
     const int G = jcp.ngroups;
     const int MB = jcp.mb;
     const int OH = jcp.oh;
@@ -1242,9 +1239,7 @@ void DeformableConvolution::executeDynamicImpl(dnnl::stream strm) {
 void DeformableConvolution::DefConvJitExecutor::exec(const float* src, const float* offsets,
         const float* weights, const float* modulation, float* dst,
         int *pSampledCoordsVector, float *pInterpWeightsVector) {
-    this->pSampledCoordsVector = pSampledCoordsVector;
-    this->pInterpWeightsVector = pInterpWeightsVector;
-    prepareSamplingWeights(offsets, modulation, false);
+    prepareSamplingWeights(pSampledCoordsVector, pInterpWeightsVector, offsets, modulation, false);
     size_t buffer_size = (size_t)jcp.nthr * jcp.ur_w * jcp.kh * jcp.kw * jcp.ic * jcp.typesize_in;
     std::vector<float> input_buffer(buffer_size, 0);
     float* input_buffer_ptr = input_buffer.data();
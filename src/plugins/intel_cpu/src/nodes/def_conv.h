@@ -119,15 +119,15 @@ private:
             virtual ~DefConvExecutor() = default;
 
         protected:
-            void prepareSamplingWeights(const float* offsets, const float* modulation = nullptr, bool enforceRef = false);
+            // the sampling buffers belong to the node, the executor itself has no per call state, so it may be shared
+            void prepareSamplingWeights(int *pSampledCoordsVector, float *pInterpWeightsVector,
+                                        const float* offsets, const float* modulation = nullptr, bool enforceRef = false);
             jit_def_conv_params jcp = {};
             VectorDims srcStrides;
             VectorDims offStrides;
             VectorDims weiStrides;
             VectorDims modStrides;
             VectorDims dstStrides;
-            int *pSampledCoordsVector;
-            float *pInterpWeightsVector;
     };
 
     class DefConvRefExecutor : public DefConvExecutor {
@@ -10,8 +10,11 @@
 #include "embedding_bag_sum.h"
 #include <ngraph/opsets/opset1.hpp>
 #include "common/cpu_memcpy.h"
+#include <utils/general_utils.h>
+#include <ie_ngraph_utils.hpp>
 
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu::x64;
 
 namespace ov {
 namespace intel_cpu {
@@ -37,6 +40,24 @@ EmbeddingBagSum::EmbeddingBagSum(
         if (op->get_input_shape(PER_SAMPLE_WEIGHTS_IDX) != op->get_input_shape(INDICES_IDX))
              IE_THROW() << logPrefix << "must have equal shapes for indices and per_sample_weights inputs.";
     }
+
+    // bf16 tables are processed in fp32 as well, see initSupportedPrimitiveDescriptors of the nodes
+    auto tablePrecision = details::convertPrecision(op->get_input_element_type(EMB_TABLE_IDX));
+    if (tablePrecision == Precision::BF16)
+        tablePrecision = Precision::FP32;
+    if (one_of(tablePrecision, Precision::FP32, Precision::I8, Precision::U8)) {
+        jit_emb_bag_config_params jcp;
+        jcp.src_prc = tablePrecision;
+        if (mayiuse(avx512_core)) {
+            _kernel.reset(new jit_uni_embedding_bag_sum_kernel_impl<avx512_core>(jcp));
+        } else if (mayiuse(avx2)) {
+            _kernel.reset(new jit_uni_embedding_bag_sum_kernel_impl<avx2>(jcp));
+        } else if (mayiuse(sse41)) {
+            _kernel.reset(new jit_uni_embedding_bag_sum_kernel_impl<sse41>(jcp));
+        }
+        if (_kernel)
+            _kernel->create_ker();
+    }
 }
 
 void EmbeddingBagSum::prepareParams(const VectorDims& indexStaticShape) {
@@ -119,18 +140,71 @@ void EmbeddingBagSum::processData(const T* srcData, const T* weightsData,
     parallel_nt(0, threadBody);
 }
 
+template<typename T>
+void EmbeddingBagSum::processDataJit(const T* srcData, const T* weightsData,
+                                     const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory) {
+    std::string msgPrefix = std::string("Node EmbeddingBagSum with name '") + _layerName + "' ";
+
+    initFromInputs();
+
+    const size_t outputBagsNum = outMemory->GetShape().getStaticDims()[0];
+    auto *dstData = reinterpret_cast<T *>(outMemory->GetPtr());
+
+    auto threadBody = [&](const int ithr, const int nthr) {
+        size_t start(0lu), end(0lu);
+        splitter(outputBagsNum, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        size_t indicesSize = 0lu;
+        const int* indices = nullptr;
+        int weightsIdx = 0lu;
+        bool withWeights = _withWeights;
+
+        jit_args_emb_bag args;
+        args.src = srcData;
+        args.emb_depth = _embDepth;
+        for (size_t obi = start; obi < end; obi++) {
+            getIndices(obi, indices, indicesSize, weightsIdx, withWeights);
+            withWeights = withWeights & _withWeights;
+
+            args.dst = dstData + obi * _embDepth;
+            args.indices = indices;
+            args.indices_num = indices != nullptr ? indicesSize : 0lu;
+            args.weights = withWeights ? weightsData + weightsIdx : nullptr;
+            for (size_t inIdx = 0lu; inIdx < args.indices_num; inIdx++) {
+                if (indices[inIdx] >= inDataDims[0]) {
+                    IE_THROW() << msgPrefix + "' has invalid embedding bag index: " + std::to_string(indices[inIdx]);
+                }
+            }
+
+            (*_kernel)(&args);
+        }
+    };
+
+    parallel_nt(0, threadBody);
+}
+
 void EmbeddingBagSum::execute(const uint8_t* srcData, const uint8_t* weightsData, const InferenceEngine::Precision &srcPrc,
                               const InferenceEngine::SizeVector& inDims, const MemoryPtr& outMemory) {
     switch (srcPrc) {
         case Precision::FP32: {
+            if (_kernel)
+                return processDataJit(reinterpret_cast<const float*>(srcData), reinterpret_cast<const float*>(weightsData),
+                                      inDims, outMemory);
             return processData<PrecisionTrait<Precision::FP32>::value_type>(reinterpret_cast<const float*>(srcData),
                     reinterpret_cast<const float*>(weightsData), inDims, outMemory);
         }
         case Precision::I8: {
+            if (_kernel)
+                return processDataJit(reinterpret_cast<const int8_t*>(srcData), reinterpret_cast<const int8_t*>(weightsData),
+                                      inDims, outMemory);
             return processData<PrecisionTrait<Precision::I8>::value_type>(reinterpret_cast<const int8_t*>(srcData),
                     reinterpret_cast<const int8_t*>(weightsData), inDims, outMemory);
         }
         case Precision::U8: {
+            if (_kernel)
+                return processDataJit(srcData, weightsData, inDims, outMemory);
             return processData<PrecisionTrait<Precision::U8>::value_type>(srcData, weightsData, inDims, outMemory);
         }
         case Precision::I32: {
@@ -9,6 +9,7 @@
 #include <string>
 #include <memory>
 #include <vector>
+#include "kernels/embedding_bag_sum_kernel.hpp"
 
 namespace ov {
 namespace intel_cpu {
@@ -42,6 +43,9 @@ protected:
     template<typename T>
     void processData(const T* srcData, const T* weightsData,
                      const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
+    template<typename T>
+    void processDataJit(const T* srcData, const T* weightsData,
+                        const InferenceEngine::SizeVector& inDataDims, const MemoryPtr& outMemory);
 
     const size_t EMB_TABLE_IDX = 0lu;
     const size_t INDICES_IDX;
@@ -51,6 +55,8 @@ protected:
     bool _withWeights = false;
     size_t _embDepth = 0;
     std::string _layerName;
+    // Gather-accumulate kernel for fp32 and int8 tables, the i32 ones are processed by the reference code
+    std::shared_ptr<jit_uni_embedding_bag_sum_kernel> _kernel = nullptr;
 };
 
 }   // namespace node
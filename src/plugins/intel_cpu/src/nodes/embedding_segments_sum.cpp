@@ -88,6 +88,17 @@ void EmbeddingSegmentsSum::initFromInputs() {
     segmentIds_ = reinterpret_cast<const int *>(getParentEdgeAt(SEGMENT_ID_IDX)->getMemoryPtr()->GetPtr());
     lastNumSegments_ = getNumSegments();
 
+    // The bags are located once per inference, so getIndices doesn't scan all the segment ids for every bag
+    segmentsBegin_.assign(lastNumSegments_, 0);
+    segmentsSize_.assign(lastNumSegments_, 0lu);
+    for (size_t si = 0; si < indicesSize_; si++) {
+        const auto segmentId = segmentIds_[si];
+        if (segmentId < 0 || segmentId >= lastNumSegments_)
+            continue;
+        if (segmentsSize_[segmentId]++ == 0lu)
+            segmentsBegin_[segmentId] = si;
+    }
+
     if (getParentEdges().size() > DEFAULT_INDEX_IDX) {
         defaultIndices_ = reinterpret_cast<const int *>(getParentEdgeAt(DEFAULT_INDEX_IDX)->getMemoryPtr()->GetPtr());
     }
@@ -98,17 +109,12 @@ void EmbeddingSegmentsSum::getIndices(int embIndex, const int*& indices, size_t&
         IE_THROW() << "Invalid embedding bag index.";
 
     indices = nullptr;
-    size = 0;
+    size = segmentsSize_[embIndex];
     withWeight = true;
 
-    for (int si = 0; si < indicesSize_; si++) {
-        if (segmentIds_[si] == embIndex) {
-            size++;
-            if (indices == nullptr) {
-                indices = indices_ + si;
-                weightsIdx = si;
-            }
-        }
+    if (size != 0) {
+        indices = indices_ + segmentsBegin_[embIndex];
+        weightsIdx = segmentsBegin_[embIndex];
     }
 
     // Empty bag
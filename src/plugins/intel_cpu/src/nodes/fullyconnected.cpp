@@ -673,6 +673,8 @@ void FullyConnected::initSupportedPrimitiveDescriptors() {
             impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
 
             supportedPrimitiveDescriptors.emplace_back(config, impl_type);
+            if (isExportedPrimitive(supportedPrimitiveDescriptors.back()))
+                return;
             if (!itpd.next_impl())
                 break;
         }
@@ -0,0 +1,222 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "embedding_bag_sum_kernel.hpp"
+
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::cpu::x64;
+
+#define GET_OFF(field) offsetof(jit_args_emb_bag, field)
+
+namespace ov {
+namespace intel_cpu {
+
+template <cpu::x64::cpu_isa_t isa>
+jit_uni_embedding_bag_sum_kernel_impl<isa>::jit_uni_embedding_bag_sum_kernel_impl(const jit_emb_bag_config_params& jcp)
+    : jit_uni_embedding_bag_sum_kernel(jcp),
+      jit_generator(jit_name()),
+      is_int8(jcp.src_prc != InferenceEngine::Precision::FP32),
+      data_size(jcp.src_prc.size()) {}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_embedding_bag_sum_kernel_impl<isa>::create_ker() {
+    jit_generator::create_kernel();
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_embedding_bag_sum_kernel_impl<isa>::generate() {
+    this->preamble();
+
+    mov(reg_indices, ptr[reg_params + GET_OFF(indices)]);
+    mov(reg_weights, ptr[reg_params + GET_OFF(weights)]);
+    mov(reg_indices_num, ptr[reg_params + GET_OFF(indices_num)]);
+
+    mov(reg_prefetch_end, reg_indices_num);
+    sub(reg_prefetch_end, prefetch_distance);
+
+    if (is_int8 && isa != avx512_core) {
+        uni_vpcmpeqd(vmm_byte_mask, vmm_byte_mask, vmm_byte_mask);
+        uni_vpsrld(vmm_byte_mask, vmm_byte_mask, 24);
+    }
+
+    Xbyak::Label no_weights_label;
+    Xbyak::Label end_label;
+
+    test(reg_weights, reg_weights);
+    jz(no_weights_label, T_NEAR);
+    emit_bag(true);
+    jmp(end_label, T_NEAR);
+    L(no_weights_label);
+    emit_bag(false);
+    L(end_label);
+
+    this->postamble();
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_embedding_bag_sum_kernel_impl<isa>::emit_bag(bool with_weights) {
+    mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+    mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+    mov(reg_work_amount, ptr[reg_params + GET_OFF(emb_depth)]);
+    mov(reg_row_stride, reg_work_amount);
+    if (!is_int8)
+        shl(reg_row_stride, 2);
+
+    // The row is split into blocks, and each block is accumulated over all the indices of the bag in the registers
+    emit_blocks(unroll, false, with_weights);
+    emit_blocks(1, false, with_weights);
+    emit_blocks(1, true, with_weights);
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_embedding_bag_sum_kernel_impl<isa>::emit_blocks(int regs_num, bool is_scalar, bool with_weights) {
+    const size_t block_len = is_scalar ? 1 : regs_num * simd_w;
+
+    Xbyak::Label loop_label;
+    Xbyak::Label loop_end_label;
+
+    L(loop_label);
+    {
+        cmp(reg_work_amount, block_len);
+        jl(loop_end_label, T_NEAR);
+
+        accumulate_block(regs_num, is_scalar, with_weights);
+
+        add(reg_src, block_len * data_size);
+        add(reg_dst, block_len * data_size);
+        sub(reg_work_amount, block_len);
+        jmp(loop_label, T_NEAR);
+    }
+    L(loop_end_label);
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_embedding_bag_sum_kernel_impl<isa>::load_int8(const Xbyak::Reg32& reg, const Xbyak::Address& addr) {
+    if (jcp_.src_prc == InferenceEngine::Precision::I8)
+        movsx(reg, addr);
+    else
+        movzx(reg, addr);
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_embedding_bag_sum_kernel_impl<isa>::store_int8(const Vmm& vmm, const Xbyak::Address& addr) {
+    // The reference accumulates in the table type, so the int32 sums are truncated rather than saturated:
+    // the low byte of the sum is the same as of the sum wrapped in each step
+    if (isa == avx512_core) {
+        vpmovdb(addr, vmm);
+        return;
+    }
+    uni_vpand(vmm, vmm, vmm_byte_mask);
+    uni_vpackssdw(vmm, vmm, vmm);
+    if (isa == avx2) {
+        vpermq(Xbyak::Ymm(vmm.getIdx()), Xbyak::Ymm(vmm.getIdx()), 0x08);
+        uni_vpackuswb(vmm, vmm, vmm);
+        uni_vmovq(addr, Xbyak::Xmm(vmm.getIdx()));
+    } else {
+        uni_vpackuswb(vmm, vmm, vmm);
+        uni_vmovd(addr, Xbyak::Xmm(vmm.getIdx()));
+    }
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_embedding_bag_sum_kernel_impl<isa>::accumulate_block(int regs_num, bool is_scalar, bool with_weights) {
+    const size_t block_size = (is_scalar ? 1 : regs_num * simd_w) * data_size;
+
+    for (int r = 0; r < regs_num; r++)
+        uni_vpxor(Vmm(r), Vmm(r), Vmm(r));
+
+    Xbyak::Label index_loop_label;
+    Xbyak::Label index_loop_end_label;
+    Xbyak::Label skip_prefetch_label;
+
+    xor_(reg_index_pos, reg_index_pos);
+    L(index_loop_label);
+    {
+        cmp(reg_index_pos, reg_indices_num);
+        jge(index_loop_end_label, T_NEAR);
+
+        cmp(reg_index_pos, reg_prefetch_end);
+        jge(skip_prefetch_label, T_NEAR);
+        movsxd(reg_prefetch_offset, dword[reg_indices + reg_index_pos * sizeof(int) + prefetch_distance * sizeof(int)]);
+        imul(reg_prefetch_offset, reg_row_stride);
+        for (size_t offset = 0; offset < block_size; offset += cache_line_size)
+            prefetcht0(ptr[reg_src + reg_prefetch_offset + offset]);
+        L(skip_prefetch_label);
+
+        movsxd(reg_row_offset, dword[reg_indices + reg_index_pos * sizeof(int)]);
+        imul(reg_row_offset, reg_row_stride);
+
+        if (is_int8 && is_scalar) {
+            load_int8(reg_aux.cvt32(), byte[reg_src + reg_row_offset]);
+            uni_vmovd(xmm_data, reg_aux.cvt32());
+            if (with_weights) {
+                load_int8(reg_aux.cvt32(), byte[reg_weights + reg_index_pos]);
+                uni_vmovd(xmm_weight, reg_aux.cvt32());
+                uni_vpmulld(xmm_data, xmm_data, xmm_weight);
+            }
+            uni_vpaddd(Xbyak::Xmm(0), Xbyak::Xmm(0), xmm_data);
+        } else if (is_int8) {
+            if (with_weights) {
+                load_int8(reg_aux.cvt32(), byte[reg_weights + reg_index_pos]);
+                uni_vmovd(xmm_weight, reg_aux.cvt32());
+                uni_vpbroadcastd(vmm_weight, xmm_weight);
+            }
+            for (int r = 0; r < regs_num; r++) {
+                const auto addr = ptr[reg_src + reg_row_offset + r * simd_w];
+                if (jcp_.src_prc == InferenceEngine::Precision::I8)
+                    uni_vpmovsxbd(vmm_data, addr);
+                else
+                    uni_vpmovzxbd(vmm_data, addr);
+                if (with_weights)
+                    uni_vpmulld(vmm_data, vmm_data, vmm_weight);
+                uni_vpaddd(Vmm(r), Vmm(r), vmm_data);
+            }
+        } else if (is_scalar) {
+            uni_vmovss(xmm_data, ptr[reg_src + reg_row_offset]);
+            if (with_weights) {
+                uni_vmovss(xmm_weight, ptr[reg_weights + reg_index_pos * sizeof(float)]);
+                uni_vmulss(xmm_data, xmm_data, xmm_weight);
+            }
+            uni_vaddss(Xbyak::Xmm(0), Xbyak::Xmm(0), xmm_data);
+        } else {
+            if (with_weights)
+                uni_vbroadcastss(vmm_weight, ptr[reg_weights + reg_index_pos * sizeof(float)]);
+            for (int r = 0; r < regs_num; r++) {
+                // the rows aren't aligned, so they are loaded before the accumulation
+                uni_vmovups(vmm_data, ptr[reg_src + reg_row_offset + r * vlen]);
+                if (with_weights)
+                    uni_vfmadd231ps(Vmm(r), vmm_data, vmm_weight);
+                else
+                    uni_vaddps(Vmm(r), Vmm(r), vmm_data);
+            }
+        }
+
+        add(reg_index_pos, 1);
+        jmp(index_loop_label, T_NEAR);
+    }
+    L(index_loop_end_label);
+
+    if (is_int8 && is_scalar) {
+        uni_vmovd(reg_aux.cvt32(), Xbyak::Xmm(0));
+        mov(byte[reg_dst], reg_aux.cvt8());
+    } else if (is_int8) {
+        for (int r = 0; r < regs_num; r++)
+            store_int8(Vmm(r), ptr[reg_dst + r * simd_w]);
+    } else if (is_scalar) {
+        uni_vmovss(ptr[reg_dst], Xbyak::Xmm(0));
+    } else {
+        for (int r = 0; r < regs_num; r++)
+            uni_vmovups(ptr[reg_dst + r * vlen], Vmm(r));
+    }
+}
+
+template struct jit_uni_embedding_bag_sum_kernel_impl<cpu::x64::sse41>;
+template struct jit_uni_embedding_bag_sum_kernel_impl<cpu::x64::avx2>;
+template struct jit_uni_embedding_bag_sum_kernel_impl<cpu::x64::avx512_core>;
+
+}   // namespace intel_cpu
+}   // namespace ov
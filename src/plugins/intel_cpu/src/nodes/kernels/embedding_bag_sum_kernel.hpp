@@ -0,0 +1,102 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_precision.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cpu/x64/jit_generator.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+struct jit_emb_bag_config_params {
+    // FP32, I8 or U8, the per sample weights have the same precision as the table
+    InferenceEngine::Precision src_prc;
+};
+
+struct jit_args_emb_bag {
+    const void* src;        // embedding table
+    const int* indices;     // indices of the bag, validated by the caller
+    const void* weights;    // per sample weights of the bag or nullptr
+    void* dst;
+
+    size_t indices_num;     // the bag is filled with zeros if it's empty
+    size_t emb_depth;
+};
+
+struct jit_uni_embedding_bag_sum_kernel {
+    void (*ker_)(const jit_args_emb_bag*);
+
+    void operator()(const jit_args_emb_bag* args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    explicit jit_uni_embedding_bag_sum_kernel(const jit_emb_bag_config_params& jcp) : ker_(nullptr), jcp_(jcp) {}
+    virtual ~jit_uni_embedding_bag_sum_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_emb_bag_config_params jcp_;
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_uni_embedding_bag_sum_kernel_impl : public jit_uni_embedding_bag_sum_kernel, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_embedding_bag_sum_kernel_impl)
+
+    explicit jit_uni_embedding_bag_sum_kernel_impl(const jit_emb_bag_config_params& jcp);
+
+    void create_ker() override;
+    void generate() override;
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional3<isa == dnnl::impl::cpu::x64::sse41,
+                                                         Xbyak::Xmm,
+                                                         isa == dnnl::impl::cpu::x64::avx2,
+                                                         Xbyak::Ymm,
+                                                         Xbyak::Zmm>::type;
+    const size_t vlen = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen;
+    // The integer tables are accumulated in int32 lanes, so the number of the elements per vector is the same
+    const size_t simd_w = vlen / sizeof(float);
+    // Number of the vector accumulators, i.e. the width of the row block accumulated over the whole bag
+    static constexpr int unroll = 4;
+    // The rows are gathered randomly, so the row of the index located this far ahead is prefetched
+    static constexpr int prefetch_distance = 4;
+    static constexpr size_t cache_line_size = 64;
+
+    const bool is_int8;
+    const size_t data_size;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_indices = r9;
+    Xbyak::Reg64 reg_weights = r10;
+    Xbyak::Reg64 reg_dst = r11;
+    Xbyak::Reg64 reg_indices_num = r12;
+    Xbyak::Reg64 reg_work_amount = r13;
+    Xbyak::Reg64 reg_row_stride = r14;
+    Xbyak::Reg64 reg_index_pos = r15;
+    Xbyak::Reg64 reg_row_offset = rax;
+    Xbyak::Reg64 reg_prefetch_offset = rbx;
+    Xbyak::Reg64 reg_prefetch_end = rdx;
+    Xbyak::Reg64 reg_aux = rsi;
+    Xbyak::Reg64 reg_params = Xbyak::Reg64(dnnl::impl::cpu::x64::abi_param_regs[0]);
+
+    // Vmm(0) ... Vmm(unroll - 1) are the accumulators
+    Vmm vmm_data = Vmm(unroll);
+    Vmm vmm_weight = Vmm(unroll + 1);
+    // 0xFF in each int32 lane, truncates the int8 sums before packing them without saturation
+    Vmm vmm_byte_mask = Vmm(unroll + 2);
+    Xbyak::Xmm xmm_data = Xbyak::Xmm(unroll);
+    Xbyak::Xmm xmm_weight = Xbyak::Xmm(unroll + 1);
+
+    void emit_bag(bool with_weights);
+    void emit_blocks(int regs_num, bool is_scalar, bool with_weights);
+    void accumulate_block(int regs_num, bool is_scalar, bool with_weights);
+    void load_int8(const Xbyak::Reg32& reg, const Xbyak::Address& addr);
+    void store_int8(const Vmm& vmm, const Xbyak::Address& addr);
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
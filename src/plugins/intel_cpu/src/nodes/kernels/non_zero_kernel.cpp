@@ -0,0 +1,157 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "non_zero_kernel.hpp"
+
+
+using namespace dnnl::impl;
+using namespace dnnl::impl::utils;
+using namespace dnnl::impl::cpu::x64;
+
+#define GET_OFF(field) offsetof(jit_args_non_zero, field)
+
+namespace ov {
+namespace intel_cpu {
+
+template <cpu::x64::cpu_isa_t isa>
+jit_uni_non_zero_kernel_impl<isa>::jit_uni_non_zero_kernel_impl(const jit_non_zero_config_params& jcp)
+    : jit_uni_non_zero_kernel(jcp, simd_w),
+      jit_generator(jit_name()),
+      data_size(jcp.src_prc.size()) {}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_non_zero_kernel_impl<isa>::create_ker() {
+    jit_generator::create_kernel();
+    ker_ = (decltype(ker_))jit_ker();
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_non_zero_kernel_impl<isa>::generate() {
+    this->preamble();
+
+    mov(reg_src, ptr[reg_params + GET_OFF(src)]);
+    mov(reg_dst, ptr[reg_params + GET_OFF(dst)]);
+    mov(reg_work_amount, ptr[reg_params + GET_OFF(work_amount)]);
+    xor_(reg_dst_num, reg_dst_num);
+
+    // vmm_idx keeps the indices of the current vector elements
+    mov(reg_aux.cvt32(), dword[reg_params + GET_OFF(start)]);
+    uni_vmovd(xmm_aux, reg_aux.cvt32());
+    uni_vpbroadcastd(vmm_idx, xmm_aux);
+    mov(reg_table, lane_offsets_label);
+    uni_vpaddd(vmm_idx, vmm_idx, ptr[reg_table]);
+    mov(reg_aux.cvt32(), static_cast<int>(simd_w));
+    uni_vmovd(xmm_aux, reg_aux.cvt32());
+    uni_vpbroadcastd(vmm_step, xmm_aux);
+    uni_vpxor(vmm_zero, vmm_zero, vmm_zero);
+    if (isa == avx2)
+        mov(reg_table, permutations_label);
+
+    Xbyak::Label loop_label;
+    Xbyak::Label loop_end_label;
+
+    L(loop_label);
+    {
+        cmp(reg_work_amount, simd_w);
+        jl(loop_end_label, T_NEAR);
+
+        load_mask();
+        compress();
+
+        add(reg_src, simd_w * data_size);
+        uni_vpaddd(vmm_idx, vmm_idx, vmm_step);
+        sub(reg_work_amount, simd_w);
+        jmp(loop_label, T_NEAR);
+    }
+    L(loop_end_label);
+
+    mov(reg_aux, ptr[reg_params + GET_OFF(dst_num)]);
+    mov(ptr[reg_aux], reg_dst_num);
+
+    this->postamble();
+
+    prepare_table();
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_non_zero_kernel_impl<isa>::load_mask() {
+    // The floating point values are compared as the reference does, so -0 is zero and NaN is not
+    const bool is_float = one_of(jcp_.src_prc, InferenceEngine::Precision::FP32, InferenceEngine::Precision::BF16);
+    switch (jcp_.src_prc) {
+    case InferenceEngine::Precision::BF16:
+        vpmovzxwd(vmm_src, ptr[reg_src]);
+        uni_vpslld(vmm_src, vmm_src, 16);
+        break;
+    case InferenceEngine::Precision::I8:
+    case InferenceEngine::Precision::U8:
+        // the sign doesn't matter for the comparison with zero
+        vpmovzxbd(vmm_src, ptr[reg_src]);
+        break;
+    default:
+        uni_vmovdqu(vmm_src, ptr[reg_src]);
+        break;
+    }
+
+    if (isa == avx512_core) {
+        if (is_float)
+            vcmpps(k_mask, vmm_src, vmm_zero, _cmp_neq_uq);
+        else
+            vptestmd(k_mask, vmm_src, vmm_src);
+        kmovw(reg_mask.cvt32(), k_mask);
+    } else if (is_float) {
+        vcmpps(vmm_src, vmm_src, vmm_zero, _cmp_neq_uq);
+        vmovmskps(reg_mask.cvt32(), vmm_src);
+    } else {
+        vpcmpeqd(vmm_src, vmm_src, vmm_zero);
+        vmovmskps(reg_mask.cvt32(), vmm_src);
+        xor_(reg_mask.cvt32(), (1 << simd_w) - 1);
+    }
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_non_zero_kernel_impl<isa>::compress() {
+    // The whole vector is stored, the indices after the compressed ones are overwritten by the next vector
+    if (isa == avx512_core) {
+        vpcompressd(vmm_compressed | k_mask | T_z, vmm_idx);
+    } else {
+        // AVX2 has no compress, so the indices are permuted by the table row selected by the mask
+        mov(reg_aux, reg_mask);
+        shl(reg_aux, 5);
+        vmovdqu(vmm_perm, ptr[reg_table + reg_aux]);
+        vpermd(vmm_compressed, vmm_perm, vmm_idx);
+    }
+    uni_vmovdqu(ptr[reg_dst + reg_dst_num * sizeof(int)], vmm_compressed);
+    popcnt(reg_mask.cvt32(), reg_mask.cvt32());
+    add(reg_dst_num, reg_mask);
+}
+
+template <cpu::x64::cpu_isa_t isa>
+void jit_uni_non_zero_kernel_impl<isa>::prepare_table() {
+    align(64);
+    L(lane_offsets_label);
+    for (size_t i = 0; i < simd_w; i++)
+        dd(static_cast<uint32_t>(i));
+
+    if (isa != avx2)
+        return;
+    // 256 rows of the 8 lane numbers: the lanes of the set mask bits go first
+    L(permutations_label);
+    for (uint32_t mask = 0; mask < (1u << simd_w); mask++) {
+        uint32_t lanes = 0;
+        for (uint32_t lane = 0; lane < simd_w; lane++) {
+            if (mask & (1u << lane)) {
+                dd(lane);
+                lanes++;
+            }
+        }
+        for (; lanes < simd_w; lanes++)
+            dd(0);
+    }
+}
+
+template struct jit_uni_non_zero_kernel_impl<cpu::x64::avx2>;
+template struct jit_uni_non_zero_kernel_impl<cpu::x64::avx512_core>;
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,114 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <ie_precision.hpp>
+#include <cpu/x64/cpu_isa_traits.hpp>
+#include <cpu/x64/jit_generator.hpp>
+
+namespace ov {
+namespace intel_cpu {
+
+struct jit_non_zero_config_params {
+    // FP32, BF16, I32, U32, I8 or U8, the boolean masks are compressed as U8
+    InferenceEngine::Precision src_prc;
+};
+
+struct jit_args_non_zero {
+    const void* src;
+    int* dst;               // indices of the non-zero elements, the whole vectors are stored
+    size_t* dst_num;        // number of the written indices
+
+    size_t work_amount;     // only the whole vectors are processed, the tail is left to the caller
+    int start;              // index of the first element
+};
+
+struct jit_uni_non_zero_kernel {
+    void (*ker_)(const jit_args_non_zero*);
+
+    void operator()(const jit_args_non_zero* args) {
+        assert(ker_);
+        ker_(args);
+    }
+
+    jit_uni_non_zero_kernel(const jit_non_zero_config_params& jcp, size_t step) : ker_(nullptr), jcp_(jcp), step_(step) {}
+    virtual ~jit_uni_non_zero_kernel() {}
+
+    virtual void create_ker() = 0;
+
+    jit_non_zero_config_params jcp_;
+    // number of the elements compressed at once
+    const size_t step_;
+};
+
+template <dnnl::impl::cpu::x64::cpu_isa_t isa>
+struct jit_uni_non_zero_kernel_impl : public jit_uni_non_zero_kernel, public dnnl::impl::cpu::x64::jit_generator {
+    DECLARE_CPU_JIT_AUX_FUNCTIONS(jit_uni_non_zero_kernel_impl)
+
+    explicit jit_uni_non_zero_kernel_impl(const jit_non_zero_config_params& jcp);
+
+    void create_ker() override;
+    void generate() override;
+
+private:
+    using Vmm = typename dnnl::impl::utils::conditional<isa == dnnl::impl::cpu::x64::avx2, Xbyak::Ymm, Xbyak::Zmm>::type;
+    static constexpr size_t simd_w = dnnl::impl::cpu::x64::cpu_isa_traits<isa>::vlen / sizeof(int);
+
+    const size_t data_size;
+
+    Xbyak::Reg64 reg_src = r8;
+    Xbyak::Reg64 reg_dst = r9;
+    Xbyak::Reg64 reg_work_amount = r10;
+    Xbyak::Reg64 reg_dst_num = r11;
+    Xbyak::Reg64 reg_mask = r12;
+    Xbyak::Reg64 reg_table = r13;
+    Xbyak::Reg64 reg_aux = rax;
+    Xbyak::Reg64 reg_params = Xbyak::Reg64(dnnl::impl::cpu::x64::abi_param_regs[0]);
+
+    Vmm vmm_zero = Vmm(0);
+    Vmm vmm_idx = Vmm(1);
+    Vmm vmm_step = Vmm(2);
+    Vmm vmm_src = Vmm(3);
+    Vmm vmm_compressed = Vmm(4);
+    Vmm vmm_perm = Vmm(5);
+    Xbyak::Xmm xmm_aux = Xbyak::Xmm(6);
+    Xbyak::Opmask k_mask = Xbyak::Opmask(1);
+
+    Xbyak::Label lane_offsets_label;
+    Xbyak::Label permutations_label;
+
+    void load_mask();
+    void compress();
+    void prepare_table();
+};
+
+/*
+ * Writes start + i of the non-zero src[i], i < work_amount, to dst and returns their number. The whole vectors are
+ * compressed by the kernel if it's given, and the rest is processed here. dst must fit work_amount indices.
+ */
+template <typename T>
+size_t compress_non_zero(jit_uni_non_zero_kernel* kernel, const T* src, size_t work_amount, int start, int* dst) {
+    const T zero = 0;
+    size_t count = 0;
+    size_t i = 0;
+    if (kernel && work_amount >= kernel->step_) {
+        jit_args_non_zero args;
+        args.src = src;
+        args.dst = dst;
+        args.dst_num = &count;
+        args.work_amount = work_amount;
+        args.start = start;
+        (*kernel)(&args);
+        i = work_amount - work_amount % kernel->step_;
+    }
+    for (; i < work_amount; i++) {
+        dst[count] = start + static_cast<int>(i);
+        count += src[i] != zero;
+    }
+    return count;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,198 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "masked_select.h"
+
+#include <numeric>
+
+#include <nodes/common/cpu_memcpy.h>
+
+#include <ie_parallel.hpp>
+#include <utils/bfloat16.hpp>
+#include <utils/shape_inference/shape_inference_internal_dyn.hpp>
+#include "ngraph_transformations/op/masked_select.hpp"
+
+using namespace InferenceEngine;
+using namespace dnnl::impl::cpu::x64;
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+bool MaskedSelect::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
+    try {
+        if (!ov::is_type<const ov::intel_cpu::MaskedSelectNode>(op)) {
+            errorMessage = "Node is not an instance of MaskedSelect from the CPU plugin operation set.";
+            return false;
+        }
+    } catch (...) {
+        return false;
+    }
+    return true;
+}
+
+MaskedSelect::MaskedSelect(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng,
+                           WeightsSharing::Ptr &cache) : Node(op, eng, cache, InternalDynShapeInferFactory()) {
+    std::string errorMessage;
+    if (isSupportedOperation(op, errorMessage)) {
+        errorPrefix = "MaskedSelect layer with name '" + getName() + "' ";
+    } else {
+        IE_THROW(NotImplemented) << errorMessage;
+    }
+}
+
+void MaskedSelect::initSupportedPrimitiveDescriptors() {
+    if (!supportedPrimitiveDescriptors.empty())
+        return;
+
+    const auto dataPrc = getOriginalInputPrecisionAtPort(DATA_ID);
+    const auto maskPrc = getOriginalInputPrecisionAtPort(MASK_ID);
+    if (!one_of(maskPrc, Precision::FP32, Precision::BF16, Precision::I32, Precision::U32, Precision::I8, Precision::U8, Precision::BOOL)) {
+        IE_THROW() << errorPrefix << "doesn't support " << maskPrc.name() << " precision on 1 port";
+    }
+
+    addSupportedPrimDesc({{LayoutType::ncsp, dataPrc},
+                          {LayoutType::ncsp, maskPrc}},
+                         {{LayoutType::ncsp, dataPrc}},
+                         impl_desc_type::ref);
+}
+
+void MaskedSelect::createPrimitive() {
+    jit_non_zero_config_params jcp;
+    jcp.src_prc = getParentEdgeAt(MASK_ID)->getMemory().getDesc().getPrecision();
+    if (jcp.src_prc == Precision::BOOL)
+        jcp.src_prc = Precision::U8;
+    if (mayiuse(avx512_core)) {
+        nonZeroKernel.reset(new jit_uni_non_zero_kernel_impl<avx512_core>(jcp));
+    } else if (mayiuse(avx2)) {
+        nonZeroKernel.reset(new jit_uni_non_zero_kernel_impl<avx2>(jcp));
+    }
+    if (nonZeroKernel)
+        nonZeroKernel->create_ker();
+
+    Node::createPrimitive();
+}
+
+namespace {
+struct MaskedSelectContext {
+    MaskedSelect &node;
+};
+}
+template<typename T>
+struct MaskedSelect::MaskedSelectExecute {
+    void operator()(MaskedSelectContext & ctx) {
+        ctx.node.executeSpecified<T>();
+    }
+};
+
+void MaskedSelect::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
+}
+
+void MaskedSelect::execute(dnnl::stream strm) {
+    auto maskPrec = getParentEdgesAtPort(MASK_ID)[0]->getMemory().getDesc().getPrecision();
+    MaskedSelectContext ctx = {*this };
+    OV_SWITCH(intel_cpu, MaskedSelectExecute, ctx, maskPrec,
+              OV_CASE(Precision::FP32, float),
+              OV_CASE(Precision::BF16, bfloat16_t),
+              OV_CASE(Precision::I32, int),
+              OV_CASE(Precision::U32, uint32_t),
+              OV_CASE(Precision::I8, int8_t),
+              OV_CASE(Precision::U8, uint8_t),
+              OV_CASE(Precision::BOOL, uint8_t))
+}
+
+// The slices are selected in two passes over the mask: the first one counts the non-zero elements of each thread part,
+// the second one compresses the positions of the non-zero elements block by block and copies the slices to the offsets
+// given by the counts. The coordinates of the non-zero elements, which GatherND would read as indices, are never stored.
+template <typename maskType>
+void MaskedSelect::executeSpecified() {
+    const maskType zero = 0;
+    const auto& dataMem = getParentEdgeAt(DATA_ID)->getMemory();
+    const auto& maskMem = getParentEdgeAt(MASK_ID)->getMemory();
+    const auto& dataDims = dataMem.getStaticDims();
+    const auto& maskDims = maskMem.getStaticDims();
+    const auto* data = reinterpret_cast<const uint8_t*>(dataMem.GetPtr());
+    const auto* mask = reinterpret_cast<const maskType*>(maskMem.GetPtr());
+
+    const size_t maskRank = maskDims.size();
+    if (maskRank > dataDims.size())
+        IE_THROW() << errorPrefix << "has mask rank greater than data rank";
+    bool isMaskDense = true;
+    for (size_t i = 0; i < maskRank; i++) {
+        if (maskDims[i] > dataDims[i])
+            IE_THROW() << errorPrefix << "has mask dimension " << i << " greater than the data one";
+        isMaskDense = isMaskDense && maskDims[i] == dataDims[i];
+    }
+
+    const size_t maskSize = std::accumulate(maskDims.begin(), maskDims.end(), size_t(1), std::multiplies<size_t>());
+    const size_t sliceSize = std::accumulate(dataDims.begin() + maskRank, dataDims.end(), dataMem.getDesc().getPrecision().size(),
+                                             std::multiplies<size_t>());
+
+    int threadsNum = parallel_get_max_threads();
+    if (maskSize < PARALLEL_MIN_LEN * threadsNum)
+        threadsNum = std::max(1, static_cast<int>(maskSize / PARALLEL_MIN_LEN));
+
+    std::vector<size_t> outOffsets(threadsNum + 1, 0);
+    parallel_nt(threadsNum, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(maskSize, nthr, ithr, start, end);
+        // The comparison result is accumulated without the branch, so the loop is vectorized by the compiler
+        size_t count = 0;
+        for (size_t i = start; i < end; i++)
+            count += mask[i] != zero;
+        outOffsets[ithr + 1] = count;
+    });
+    for (int i = 0; i < threadsNum; i++)
+        outOffsets[i + 1] += outOffsets[i];
+
+    VectorDims outDims{outOffsets[threadsNum]};
+    outDims.insert(outDims.end(), dataDims.begin() + maskRank, dataDims.end());
+    redefineOutputMemory({outDims});
+    auto* dst = reinterpret_cast<uint8_t*>(getChildEdgeAt(0)->getMemoryPtr()->GetPtr());
+    if (outOffsets[threadsNum] == 0 || sliceSize == 0)
+        return;
+
+    // Strides of the leading data dimensions in the slices
+    std::vector<size_t> dataStrides(maskRank, 1);
+    for (int i = static_cast<int>(maskRank) - 2; i >= 0; i--)
+        dataStrides[i] = dataStrides[i + 1] * dataDims[i + 1];
+
+    // The dense mask is processed as a single row
+    const size_t rowLen = isMaskDense ? maskSize : maskDims.back();
+    parallel_nt(threadsNum, [&](const int ithr, const int nthr) {
+        size_t start = 0, end = 0;
+        splitter(maskSize, nthr, ithr, start, end);
+        uint8_t* out = dst + outOffsets[ithr] * sliceSize;
+
+        int indices[KERNEL_BLOCK_LEN];
+        for (size_t i = start; i < end;) {
+            const size_t row = i / rowLen;
+            const size_t rowPos = i % rowLen;
+            const size_t len = std::min(std::min(end - i, rowLen - rowPos), KERNEL_BLOCK_LEN);
+            // The innermost mask dimension is contiguous in the data too, so only the row offset follows the mask coordinates
+            size_t dataOffset = rowPos;
+            if (!isMaskDense) {
+                size_t rest = row;
+                for (size_t j = maskRank - 1; j-- > 0; rest /= maskDims[j])
+                    dataOffset += rest % maskDims[j] * dataStrides[j];
+            }
+
+            const size_t count = compress_non_zero(nonZeroKernel.get(), mask + i, len, 0, indices);
+            for (size_t k = 0; k < count; k++) {
+                cpu_memcpy_slice(out, data + (dataOffset + indices[k]) * sliceSize, sliceSize);
+                out += sliceSize;
+            }
+            i += len;
+        }
+    });
+}
+
+bool MaskedSelect::created() const {
+    return getType() == Type::MaskedSelect;
+}
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
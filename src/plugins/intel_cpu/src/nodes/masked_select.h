@@ -0,0 +1,53 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <node.h>
+#include <string>
+#include <memory>
+#include <vector>
+#include "kernels/non_zero_kernel.hpp"
+
+namespace ov {
+namespace intel_cpu {
+namespace node {
+
+class MaskedSelect : public Node {
+public:
+    MaskedSelect(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache);
+
+    void getSupportedDescriptors() override {};
+    void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
+    void execute(dnnl::stream strm) override;
+    bool created() const override;
+    bool needShapeInfer() const override {return false;};
+    bool needPrepareParams() const override {return false;};
+    void executeDynamicImpl(dnnl::stream strm) override;
+    static bool isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept;
+
+    bool isExecutable() const override { return true; }
+
+private:
+    template <typename maskType>
+    void executeSpecified();
+    template<typename T>
+    struct MaskedSelectExecute;
+
+    static constexpr size_t DATA_ID = 0;
+    static constexpr size_t MASK_ID = 1;
+    // Minimal number of the mask elements processed by a thread
+    static constexpr size_t PARALLEL_MIN_LEN = 1lu << 12;
+    // Number of the mask elements compressed by one kernel call
+    static constexpr size_t KERNEL_BLOCK_LEN = 1lu << 10;
+
+    std::shared_ptr<jit_uni_non_zero_kernel> nonZeroKernel;
+
+    std::string errorPrefix;
+};
+
+}   // namespace node
+}   // namespace intel_cpu
+}   // namespace ov
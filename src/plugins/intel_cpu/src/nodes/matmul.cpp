@@ -451,6 +451,8 @@ void MatMul::initSupportedPrimitiveDescriptors() {
             impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
 
             supportedPrimitiveDescriptors.emplace_back(config, impl_type);
+            if (isExportedPrimitive(supportedPrimitiveDescriptors.back()))
+                return;
             if (!itpd.next_impl())
                 break;
         }
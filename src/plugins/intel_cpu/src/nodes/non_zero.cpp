@@ -12,6 +12,7 @@
 #include <utils/shape_inference/shape_inference_internal_dyn.hpp>
 
 using namespace InferenceEngine;
+using namespace dnnl::impl::cpu::x64;
 
 namespace ov {
 namespace intel_cpu {
@@ -19,6 +20,10 @@ namespace node {
 
 static constexpr int blockSize = dnnl::impl::cpu::platform::get_cache_line_size() * 2;
 static constexpr int elementsStride = blockSize / sizeof(int);
+// Number of the elements compressed by one kernel call
+static constexpr size_t kernelBlockSize = 1024;
+// The outer coordinates are computed once per row, so the kernel isn't used for the short rows
+static constexpr size_t kernelMinRowSize = 64;
 
 bool NonZero::isSupportedOperation(const std::shared_ptr<const ngraph::Node>& op, std::string& errorMessage) noexcept {
     try {
@@ -69,6 +74,20 @@ void NonZero::initSupportedPrimitiveDescriptors() {
                          impl_desc_type::ref);
 }
 
+void NonZero::createPrimitive() {
+    jit_non_zero_config_params jcp;
+    jcp.src_prc = getParentEdgeAt(0)->getMemory().getDesc().getPrecision();
+    if (mayiuse(avx512_core)) {
+        nonZeroKernel.reset(new jit_uni_non_zero_kernel_impl<avx512_core>(jcp));
+    } else if (mayiuse(avx2)) {
+        nonZeroKernel.reset(new jit_uni_non_zero_kernel_impl<avx2>(jcp));
+    }
+    if (nonZeroKernel)
+        nonZeroKernel->create_ker();
+
+    Node::createPrimitive();
+}
+
 template <typename T>
 std::vector<size_t> NonZero::getNonZeroElementsCount(const T* src, const Shape& inShape) {
     T zero = 0;
@@ -82,16 +101,6 @@ std::vector<size_t> NonZero::getNonZeroElementsCount(const T* src, const Shape&
         counts.push_back(count);
         break;
     }
-    case 1: {
-        size_t count = 0;
-        for (size_t i = 0; i < inSize; i++) {
-            if (src[i] != zero) {
-                count++;
-            }
-        }
-        counts.push_back(count);
-        break;
-    }
     default: {
         threadsCount = parallel_get_num_threads();
         if (inSize < blockSize * threadsCount)
@@ -99,12 +108,12 @@ std::vector<size_t> NonZero::getNonZeroElementsCount(const T* src, const Shape&
 
         counts.resize(threadsCount);
         parallel_nt(threadsCount, [&](int ithr, int nthr) {
+            size_t start = 0, end = 0;
+            splitter(inSize, nthr, ithr, start, end);
+            // The comparison result is accumulated without the branch, so the loop is vectorized by the compiler
             size_t count = 0;
-            for_1d(ithr, nthr, inSize, [&](size_t i) {
-                if (src[i] != zero) {
-                    count++;
-                }
-            });
+            for (size_t i = start; i < end; i++)
+                count += src[i] != zero;
 
             counts[ithr] = count;
         });
@@ -169,18 +178,63 @@ void NonZero::executeSpecified() {
         return static_cast<int>(x);
     });
 
+    if (nonZeroKernel && inRank > 0 && static_cast<size_t>(srcDims.back()) >= kernelMinRowSize) {
+        const size_t inSize = inShape.getElementsCount();
+        const size_t rowSize = srcDims.back();
+        parallel_nt(threadsCount, [&](int ithr, int nthr) {
+            size_t start = 0, end = 0;
+            splitter(inSize, nthr, ithr, start, end);
+
+            int cache[kernelBlockSize];
+            size_t outputIndex = destIndices[ithr];
+            // The part of the row is compressed to the innermost indices, the outer coordinates are the same for all of them
+            for (size_t i = start; i < end;) {
+                const size_t row = i / rowSize;
+                const size_t rowPos = i % rowSize;
+                const size_t len = std::min(std::min(end - i, rowSize - rowPos), kernelBlockSize);
+                const size_t count = compress_non_zero(nonZeroKernel.get(), src + i, len, static_cast<int>(rowPos), cache);
+
+                size_t rest = row;
+                for (size_t j = inRank - 1; j-- > 0; rest /= srcDims[j])
+                    std::fill_n(&dst[j * totalNonZeroCount + outputIndex], count, static_cast<int>(rest % srcDims[j]));
+                cpu_memcpy(&dst[(inRank - 1) * totalNonZeroCount + outputIndex], cache, count * sizeof(int));
+
+                outputIndex += count;
+                i += len;
+            }
+        });
+        return;
+    }
+
     switch (inRank) {
     case 0:
         dst[0] = 0;
         break;
     case 1: {
-        size_t outputIndex = 0;
-        for (int i = 0; i < srcDims[0]; ++i) {
-            if (src[i] != zero) {
-                dst[outputIndex] = i;
-                outputIndex++;
+        parallel_nt(threadsCount, [&](int ithr, int nthr) {
+            size_t start = 0, end = 0;
+            splitter(static_cast<size_t>(srcDims[0]), nthr, ithr, start, end);
+
+            int cache[elementsStride];
+            int counter = 0;
+            size_t& outputIndex = destIndices[ithr];
+
+            // The index is always written to the cache and kept only for the non-zero element, so the only branch of the
+            // loop is the rarely taken cache flush
+            for (size_t i = start; i < end; i++) {
+                cache[counter] = static_cast<int>(i);
+                counter += src[i] != zero;
+
+                if (counter >= elementsStride) {
+                    cpu_memcpy(&dst[outputIndex], cache, blockSize);
+                    outputIndex += elementsStride;
+                    counter = 0;
+                }
             }
-        }
+
+            if (counter != 0)
+                cpu_memcpy(&dst[outputIndex], cache, counter * sizeof(int));
+        });
         break;
     }
     case 2: {
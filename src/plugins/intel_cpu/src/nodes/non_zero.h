@@ -9,6 +9,7 @@
 #include <memory>
 #include <vector>
 #include <dnnl_extension_utils.h>
+#include "kernels/non_zero_kernel.hpp"
 
 #include <cpu/platform.hpp>
 
@@ -22,6 +23,7 @@ public:
 
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
+    void createPrimitive() override;
     void execute(dnnl::stream strm) override;
     bool created() const override;
     bool needShapeInfer() const override {return false;};
@@ -34,6 +36,7 @@ public:
 private:
     int threadsCount = 1;
     std::string errorPrefix;
+    std::shared_ptr<jit_uni_non_zero_kernel> nonZeroKernel;
     template <typename inputType>
     void executeSpecified();
     template<typename T>
@@ -7,6 +7,9 @@
 #include "fake_quantize.h"
 #include "conv.h"
 #include "concat.h"
+#include <algorithm>
+#include <limits>
+#include <numeric>
 #include <string>
 #include <vector>
 #include <onednn/dnnl.h>
@@ -15,6 +18,8 @@
 #include <memory_desc/cpu_memory_desc_utils.h>
 #include "memory_desc/dnnl_blocked_memory_desc.h"
 #include <common/primitive_hashing_utils.hpp>
+#include <ie_parallel.hpp>
+#include <utils/bfloat16.hpp>
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -78,6 +83,38 @@ struct PoolingKey {
     }
 };
 
+struct MaxPoolKey {
+    VectorDims inDims;
+    VectorDims outDims;
+    std::vector<ptrdiff_t> kernel;
+    std::vector<ptrdiff_t> stride;
+    std::vector<ptrdiff_t> dilation;
+    std::vector<ptrdiff_t> padBegin;
+    size_t channelsBlock;
+    size_t indicesModulo;
+
+    size_t hash() const {
+        using namespace dnnl::impl;
+        using namespace dnnl::impl::primitive_hashing;
+        size_t seed = 0;
+        seed = get_vector_hash(seed, inDims);
+        seed = get_vector_hash(seed, outDims);
+        seed = get_vector_hash(seed, kernel);
+        seed = get_vector_hash(seed, stride);
+        seed = get_vector_hash(seed, dilation);
+        seed = get_vector_hash(seed, padBegin);
+        seed = hash_combine(seed, channelsBlock);
+        seed = hash_combine(seed, indicesModulo);
+        return seed;
+    }
+
+    bool operator==(const MaxPoolKey& rhs) const {
+        return inDims == rhs.inDims && outDims == rhs.outDims && kernel == rhs.kernel && stride == rhs.stride &&
+               dilation == rhs.dilation && padBegin == rhs.padBegin && channelsBlock == rhs.channelsBlock &&
+               indicesModulo == rhs.indicesModulo;
+    }
+};
+
 std::shared_ptr<pooling_v2_forward::desc> createDescriptorHelper(const dnnl::memory::desc& in_candidate,
                                                                  const dnnl::memory::desc& out_candidate,
                                                                  const dnnl::algorithm alg,
@@ -124,12 +161,8 @@ std::shared_ptr<pooling_v2_forward::desc> createDescriptorHelper(const dnnl::mem
 
 bool Pooling::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
-        if (ov::is_type<const ov::op::v8::MaxPool>(op)) {
-            if (!op->get_output_target_inputs(1).empty()) {
-                errorMessage = "MaxPool from opset8 is supported only with one output";
-                return false;
-            }
-        } else if (!ov::is_type<const ov::op::v1::MaxPool>(op) && !ov::is_type<const ov::op::v1::AvgPool>(op)) {
+        if (!ov::is_type<const ov::op::v8::MaxPool>(op) && !ov::is_type<const ov::op::v1::MaxPool>(op) &&
+            !ov::is_type<const ov::op::v1::AvgPool>(op)) {
             errorMessage = "MaxPool and AvgPool from opset1 and MaxPool from opset8 are supported";
             return false;
         }
@@ -163,6 +196,11 @@ Pooling::Pooling(const std::shared_ptr<ov::Node>& op, const dnnl::engine& eng, W
         get_attributes(data_pad_begin, maxPoolOp_v8->get_pads_begin());
         get_attributes(data_pad_end, maxPoolOp_v8->get_pads_end());
 
+        withIndices = !op->get_output_target_inputs(1).empty();
+        indicesAxis = maxPoolOp_v8->get_axis();
+        if (indicesAxis < 0)
+            indicesAxis += op->get_input_partial_shape(0).rank().get_length();
+
         auto_pad = (maxPoolOp_v8->get_auto_pad() == ov::op::PadType::SAME_LOWER || maxPoolOp_v8->get_auto_pad() == ov::op::PadType::SAME_UPPER);
     } else if (auto maxPoolOp_v1 = ov::as_type_ptr<const ov::op::v1::MaxPool>(op)) {
         algorithm = Algorithm::PoolingMax;
@@ -187,6 +225,10 @@ Pooling::Pooling(const std::shared_ptr<ov::Node>& op, const dnnl::engine& eng, W
 
         auto_pad = (avgPoolOp->get_auto_pad() == ov::op::PadType::SAME_LOWER || avgPoolOp->get_auto_pad() == ov::op::PadType::SAME_UPPER);
     }
+
+    // oneDNN has only the reference implementation of the dilated max pooling and doesn't return the indices
+    useNativeMaxPool = algorithm == Algorithm::PoolingMax &&
+                       (withIndices || std::any_of(dilation.begin(), dilation.end(), [](ptrdiff_t d) { return d > 1; }));
 }
 
 std::vector<memory::format_tag> Pooling::getAvailableFormatsForDims(const Shape &dims) const {
@@ -265,6 +307,9 @@ void Pooling::getSupportedDescriptors() {
     if ((inputRank < 3) || (inputRank > 5))
         IE_THROW() << "Pooling layer. Unsupported mode. Only 3D, 4D and 5D blobs are supported as input.";
 
+    if (useNativeMaxPool)
+        return;
+
     inShape = MemoryDescUtils::makeDummyShape(parentShape);
     if (isDynamicNode()) {
         const auto& origDims = parentShape.getDims();
@@ -318,6 +363,11 @@ void Pooling::prepareParams() {
     if (selected_pd == nullptr)
         IE_THROW()  << "Pooling node with name '" << getName() << "' did not set preferable primitive descriptor";
 
+    if (useNativeMaxPool) {
+        prepareMaxPoolExecutor();
+        return;
+    }
+
     AttrPtr attr;
     if (isDynamicNode()) {
         if (!pAttr) {
@@ -396,10 +446,188 @@ void Pooling::prepareParams() {
     Node::appendPostOpArgs(*attr, primArgs, postOpsArgs);
 }
 
+void Pooling::prepareMaxPoolExecutor() {
+    const auto& srcMemory = getParentEdgesAtPort(0)[0]->getMemory();
+    const auto& dstMemory = getChildEdgesAtPort(0)[0]->getMemory();
+    if (isDynamicNode() && auto_pad) {
+        data_pad_begin = shapeInference->get_pads_begin();
+        data_pad_end = shapeInference->get_pads_end();
+    }
+
+    const auto& inDims = srcMemory.getStaticDims();
+    size_t channelsBlock = 1;
+    if (srcMemory.getDesc().hasLayoutType(LayoutType::nspc)) {
+        channelsBlock = inDims[1];
+    } else if (srcMemory.getDesc().hasLayoutType(LayoutType::nCsp16c)) {
+        channelsBlock = 16;
+    } else if (srcMemory.getDesc().hasLayoutType(LayoutType::nCsp8c)) {
+        channelsBlock = 8;
+    }
+    const size_t indicesModulo = std::accumulate(inDims.begin() + indicesAxis, inDims.end(), size_t(1), std::multiplies<size_t>());
+
+    MaxPoolKey key = {inDims, dstMemory.getStaticDims(), kernel, stride, dilation, data_pad_begin, channelsBlock, indicesModulo};
+    auto builder = [](const MaxPoolKey& key) -> std::shared_ptr<MaxPoolExecutor> {
+        return std::make_shared<MaxPoolExecutor>(key.inDims,
+                                                 key.outDims,
+                                                 key.kernel,
+                                                 key.stride,
+                                                 key.dilation,
+                                                 key.padBegin,
+                                                 key.channelsBlock,
+                                                 key.indicesModulo);
+    };
+
+    auto cache = getRuntimeCache();
+    auto result = cache->getOrCreate(key, builder);
+    maxPoolExecPtr = result.first;
+}
+
+void Pooling::execute(dnnl::stream strm) {
+    if (useNativeMaxPool) {
+        if (!maxPoolExecPtr)
+            IE_THROW() << "Pooling node with name '" << getName() << "' doesn't have an initialized executor";
+        const auto& srcMemory = getParentEdgesAtPort(0)[0]->getMemory();
+        const auto* src = srcMemory.GetPtr();
+        auto* dst = getChildEdgesAtPort(0)[0]->getMemoryPtr()->GetPtr();
+        auto* indices = withIndices ? reinterpret_cast<int*>(getChildEdgesAtPort(1)[0]->getMemoryPtr()->GetPtr()) : nullptr;
+        switch (srcMemory.getDesc().getPrecision()) {
+        case Precision::FP32:
+            maxPoolExecPtr->exec(reinterpret_cast<const float*>(src), reinterpret_cast<float*>(dst), indices);
+            break;
+        case Precision::BF16:
+            maxPoolExecPtr->exec(reinterpret_cast<const bfloat16_t*>(src), reinterpret_cast<bfloat16_t*>(dst), indices);
+            break;
+        case Precision::I8:
+            maxPoolExecPtr->exec(reinterpret_cast<const int8_t*>(src), reinterpret_cast<int8_t*>(dst), indices);
+            break;
+        case Precision::U8:
+            maxPoolExecPtr->exec(reinterpret_cast<const uint8_t*>(src), reinterpret_cast<uint8_t*>(dst), indices);
+            break;
+        default:
+            IE_THROW() << "Pooling node with name '" << getName() << "' doesn't support "
+                       << srcMemory.getDesc().getPrecision().name() << " precision";
+        }
+        return;
+    }
+    Node::execute(strm);
+}
+
 void Pooling::executeDynamicImpl(dnnl::stream strm) {
     execute(strm);
 }
 
+constexpr size_t Pooling::MaxPoolExecutor::channelsChunk;
+
+Pooling::MaxPoolExecutor::MaxPoolExecutor(const VectorDims& inDims,
+                                          const VectorDims& outDims,
+                                          const std::vector<ptrdiff_t>& kernel,
+                                          const std::vector<ptrdiff_t>& stride,
+                                          const std::vector<ptrdiff_t>& dilation,
+                                          const std::vector<ptrdiff_t>& padBegin,
+                                          size_t channelsBlock,
+                                          size_t indicesModulo) : indicesModulo(indicesModulo) {
+    const size_t spatialRank = inDims.size() - 2;
+    // The missing spatial dimensions are the unit ones with the unit kernel
+    auto getParam = [&](const std::vector<ptrdiff_t>& param, size_t dimIdx, ptrdiff_t defaultValue) {
+        return dimIdx + spatialRank < 3 ? defaultValue : param[dimIdx + spatialRank - 3];
+    };
+    auto getDim = [&](const VectorDims& dims, size_t dimIdx) -> size_t {
+        return dimIdx + spatialRank < 3 ? 1 : dims[dimIdx + spatialRank - 1];
+    };
+    auto initRanges = [&](size_t dimIdx) {
+        const auto inLen = static_cast<ptrdiff_t>(getDim(inDims, dimIdx));
+        const size_t outLen = getDim(outDims, dimIdx);
+        const ptrdiff_t k = getParam(kernel, dimIdx, 1);
+        const ptrdiff_t s = getParam(stride, dimIdx, 1);
+        const ptrdiff_t d = getParam(dilation, dimIdx, 1);
+        const ptrdiff_t p = getParam(padBegin, dimIdx, 0);
+
+        std::vector<KernelRange> ranges(outLen);
+        for (size_t o = 0; o < outLen; o++) {
+            const ptrdiff_t start = static_cast<ptrdiff_t>(o) * s - p;
+            const ptrdiff_t kBegin = start < 0 ? div_up(-start, d) : 0;
+            const ptrdiff_t kEnd = start < inLen ? std::min(k, div_up(inLen - start, d)) : 0;
+            ranges[o] = {start, static_cast<size_t>(kBegin), static_cast<size_t>(std::max(kBegin, kEnd))};
+        }
+        return ranges;
+    };
+
+    rangesD = initRanges(0);
+    rangesH = initRanges(1);
+    rangesW = initRanges(2);
+    dilationD = getParam(dilation, 0, 1);
+    dilationH = getParam(dilation, 1, 1);
+    dilationW = getParam(dilation, 2, 1);
+
+    N = inDims[0];
+    C = inDims[1];
+    blk = channelsBlock;
+    CB = div_up(C, blk);
+    ID = getDim(inDims, 0);
+    IH = getDim(inDims, 1);
+    IW = getDim(inDims, 2);
+    OD = getDim(outDims, 0);
+    OH = getDim(outDims, 1);
+    OW = getDim(outDims, 2);
+}
+
+template <typename T>
+void Pooling::MaxPoolExecutor::exec(const T* src, T* dst, int* indices) const {
+    const size_t IS = ID * IH * IW;
+    const size_t OS = OD * OH * OW;
+
+    parallel_for4d(N, CB, OD, OH, [&](size_t n, size_t cb, size_t od, size_t oh) {
+        // The memory is [N][CB][spatial][blk] for all the layouts: blk is 1 for ncsp and C for nspc
+        const T* srcBlk = src + (n * CB + cb) * IS * blk;
+        T* dstBlk = dst + (n * CB + cb) * OS * blk;
+        const auto& rd = rangesD[od];
+        const auto& rh = rangesH[oh];
+
+        float maxVals[channelsChunk];
+        int maxIdx[channelsChunk];
+        for (size_t ow = 0; ow < OW; ow++) {
+            const auto& rw = rangesW[ow];
+            const size_t os = (od * OH + oh) * OW + ow;
+            for (size_t c0 = 0; c0 < blk; c0 += channelsChunk) {
+                const size_t cLen = std::min(channelsChunk, blk - c0);
+                // Padding is ignored, the first element wins in case of the equal values as in the reference
+                std::fill(maxVals, maxVals + cLen, static_cast<float>(std::numeric_limits<T>::lowest()));
+                std::fill(maxIdx, maxIdx + cLen, 0);
+
+                for (size_t kd = rd.kBegin; kd < rd.kEnd; kd++) {
+                    const size_t id = rd.start + kd * dilationD;
+                    for (size_t kh = rh.kBegin; kh < rh.kEnd; kh++) {
+                        const size_t ih = rh.start + kh * dilationH;
+                        for (size_t kw = rw.kBegin; kw < rw.kEnd; kw++) {
+                            const size_t is = (id * IH + ih) * IW + rw.start + kw * dilationW;
+                            const T* srcPtr = srcBlk + is * blk + c0;
+                            for (size_t c = 0; c < cLen; c++) {
+                                const float value = static_cast<float>(srcPtr[c]);
+                                const bool isGreater = value > maxVals[c];
+                                maxVals[c] = isGreater ? value : maxVals[c];
+                                maxIdx[c] = isGreater ? static_cast<int>(is) : maxIdx[c];
+                            }
+                        }
+                    }
+                }
+
+                T* dstPtr = dstBlk + os * blk + c0;
+                for (size_t c = 0; c < cLen; c++)
+                    dstPtr[c] = static_cast<T>(maxVals[c]);
+                if (indices) {
+                    // Indices are flat over the whole ncsp input, reduced to the dimensions starting from the axis
+                    const size_t cBegin = cb * blk + c0;
+                    const size_t cEnd = std::min(C, cBegin + cLen);
+                    for (size_t c = cBegin; c < cEnd; c++) {
+                        const size_t flatIdx = (n * C + c) * IS + maxIdx[c - cBegin];
+                        indices[(n * C + c) * OS + os] = static_cast<int>(flatIdx % indicesModulo);
+                    }
+                }
+            }
+        }
+    });
+}
+
 bool Pooling::created() const {
     return getType() == Type::Pooling;
 }
@@ -448,6 +676,9 @@ std::shared_ptr<pooling_v2_forward::desc> Pooling::createDescriptorInternal(
 
 void Pooling::createDescriptor(const std::vector<MemoryDescPtr> &inputDesc,
                                          const std::vector<MemoryDescPtr> &outputDesc) {
+    if (useNativeMaxPool)
+        return;
+
     auto inDesc = inputDesc[0]->isDefined() ? inputDesc[0] : inputDesc[0]->cloneWithNewDims(inShape.getStaticDims());
     auto dnnlInDesc = MemoryDescUtils::convertToDnnlMemoryDesc(inDesc);
     auto in_candidate = dnnlInDesc->getDnnlDesc();
@@ -473,6 +704,26 @@ void Pooling::initSupportedPrimitiveDescriptors() {
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
+    if (useNativeMaxPool) {
+        std::vector<LayoutType> dataFormats{LayoutType::ncsp};
+        if (getInputShapeAtPort(0).getDims()[1] != 1) {
+            dataFormats.push_back(LayoutType::nspc);
+            dataFormats.push_back(LayoutType::nCsp16c);
+            dataFormats.push_back(LayoutType::nCsp8c);
+        }
+        // The data is kept in its precision, so no Converts are inserted around the node
+        auto dataPrecision = getOriginalInputPrecisionAtPort(0);
+        if (!one_of(dataPrecision, Precision::FP32, Precision::BF16, Precision::I8, Precision::U8))
+            dataPrecision = Precision::FP32;
+        for (const auto& df : dataFormats) {
+            std::vector<PortConfigurator> outConfs{{df, dataPrecision}};
+            if (isMaxPool8)
+                outConfs.emplace_back(LayoutType::ncsp, Precision::I32);
+            addSupportedPrimDesc({{df, dataPrecision}}, outConfs, impl_desc_type::ref_any);
+        }
+        return;
+    }
+
     dnnl::primitive_attr attr;
     setPostOps(attr);
 
@@ -514,6 +765,8 @@ void Pooling::initSupportedPrimitiveDescriptors() {
             impl_desc_type impl_type = parse_impl_name(itpd.impl_info_str());
 
             supportedPrimitiveDescriptors.emplace_back(config, impl_type);
+            if (isExportedPrimitive(supportedPrimitiveDescriptors.back()))
+                return;
             if (!itpd.next_impl())
                 break;
         }
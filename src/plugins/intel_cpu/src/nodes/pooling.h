@@ -30,6 +30,7 @@ public:
     }
 
     void prepareParams() override;
+    void execute(dnnl::stream strm) override;
     void executeDynamicImpl(dnnl::stream strm) override;
 
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
@@ -41,6 +42,7 @@ private:
     void setPostOps(dnnl::primitive_attr &attr);
 
     void initEffectiveAttributes(const Shape &inDims, const Shape &outDims);
+    void prepareMaxPoolExecutor();
     dnnl::algorithm getPoolingAlgorithm() const;
     std::shared_ptr<dnnl::pooling_v2_forward::desc> createDescriptorInternal(const dnnl::memory::desc& in_candidate,
                                                                                const dnnl::memory::desc& out_candidate,
@@ -50,6 +52,43 @@ private:
 
     Shape inShape;
 
+    /// Max pooling implemented in the plugin. It's used for the cases oneDNN has only the reference implementation
+    /// for (dilated kernels) or doesn't support at all (indices output of MaxPool-8). Channels are the innermost loop
+    /// for nspc and blocked layouts, so they are processed with vector instructions. The data is FP32, BF16, I8 or U8,
+    /// the values are compared as floats, which is exact for all of them.
+    struct MaxPoolExecutor {
+        MaxPoolExecutor(const VectorDims& inDims,
+                        const VectorDims& outDims,
+                        const std::vector<ptrdiff_t>& kernel,
+                        const std::vector<ptrdiff_t>& stride,
+                        const std::vector<ptrdiff_t>& dilation,
+                        const std::vector<ptrdiff_t>& padBegin,
+                        size_t channelsBlock,
+                        size_t indicesModulo);
+        template <typename T>
+        void exec(const T* src, T* dst, int* indices) const;
+
+    private:
+        /// The kernel elements [kBegin, kEnd) of the output point lie inside of the input, the rest ones are padding
+        struct KernelRange {
+            ptrdiff_t start;
+            size_t kBegin;
+            size_t kEnd;
+        };
+        static constexpr size_t channelsChunk = 64;
+
+        std::vector<KernelRange> rangesD, rangesH, rangesW;
+        size_t dilationD, dilationH, dilationW;
+        size_t N, C, CB, blk;
+        size_t ID, IH, IW, OD, OH, OW;
+        size_t indicesModulo;
+    };
+    std::shared_ptr<MaxPoolExecutor> maxPoolExecPtr = nullptr;
+
+    bool useNativeMaxPool = false;
+    bool withIndices = false;
+    int64_t indicesAxis = 0;
+
     bool isMaxPool8 = false;
     bool auto_pad = false;
     bool exclude_pad = false;
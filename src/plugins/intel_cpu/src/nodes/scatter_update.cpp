@@ -9,7 +9,9 @@
 #include <dnnl_extension_utils.h>
 #include "ie_parallel.hpp"
 #include <algorithm>
+#include <cstring>
 #include "common/cpu_memcpy.h"
+#include <utils/general_utils.h>
 
 #include <ngraph/opsets/opset3.hpp>
 #include <ngraph/opsets/opset4.hpp>
@@ -254,6 +256,46 @@ static std::vector<size_t> getBlockND(const VectorDims& shape) {
     return blockND;
 }
 
+// Distributes the updates between the parts by the ranges of their destinations, so each destination is written by one part
+// only. The stable distribution keeps the order of the updates within the part, so the last update of the destination wins
+// as in the sequential execution. The updates of part p are order[partBegin[p]] ... order[partBegin[p + 1] - 1].
+static void partitionByDestination(const std::vector<size_t>& dstIdx, size_t dstNum, size_t partsNum,
+                                   std::vector<size_t>& order, std::vector<size_t>& partBegin) {
+    const size_t updatesNum = dstIdx.size();
+    auto getPart = [&](size_t idx) {
+        return idx * partsNum / dstNum;
+    };
+
+    std::vector<size_t> offsets(partsNum * partsNum, 0);
+    parallel_for(partsNum, [&](size_t c) {
+        size_t start = 0, end = 0;
+        splitter(updatesNum, partsNum, c, start, end);
+        auto chunkOffsets = offsets.data() + c * partsNum;
+        for (size_t i = start; i < end; i++)
+            chunkOffsets[getPart(dstIdx[i])]++;
+    });
+    partBegin.resize(partsNum + 1);
+    size_t offset = 0;
+    for (size_t p = 0; p < partsNum; p++) {
+        partBegin[p] = offset;
+        for (size_t c = 0; c < partsNum; c++) {
+            const auto count = offsets[c * partsNum + p];
+            offsets[c * partsNum + p] = offset;
+            offset += count;
+        }
+    }
+    partBegin[partsNum] = offset;
+
+    order.resize(updatesNum);
+    parallel_for(partsNum, [&](size_t c) {
+        size_t start = 0, end = 0;
+        splitter(updatesNum, partsNum, c, start, end);
+        auto chunkOffsets = offsets.data() + c * partsNum;
+        for (size_t i = start; i < end; i++)
+            order[chunkOffsets[getPart(dstIdx[i])]++] = i;
+    });
+}
+
 void ScatterUpdate::execute(dnnl::stream strm) {
     auto &srcMemPtr = getParentEdgeAt(DATA_ID)->getMemoryPtr();
     auto &dstMemPtr = getChildEdgeAt(0)->getMemoryPtr();
@@ -390,11 +432,23 @@ void ScatterUpdate::scatterUpdate(uint8_t *indices, uint8_t *update, int axis, u
     size_t blockToUpdate = srcBlockND[axis + 1];
     size_t blockToUpdateSize = blockToUpdate * dataSize;
 
-    parallel_for2d(batchToUpdate, idxLength, [&](size_t b, size_t idx) {
-        int64_t idxValue = getIndicesValue(indices, idx);
-        uint8_t *dstEntry = dstData + (b * srcBlockND[axis] + idxValue * blockToUpdate) * dataSize;
-        uint8_t *updateEntry = update + (b * updateBlockND[axis] + idx * blockToUpdate) * dataSize;
-        cpu_memcpy(dstEntry, updateEntry, blockToUpdateSize);
+    // The batches never overlap, and the indices are partitioned by their values, so the duplicated indices are processed
+    // by the same thread in their order
+    std::vector<size_t> dstIdx(idxLength);
+    parallel_for(idxLength, [&](size_t idx) {
+        dstIdx[idx] = getIndicesValue(indices, idx);
+    });
+    const size_t partsNum = std::min(static_cast<size_t>(parallel_get_max_threads()), idxLength);
+    std::vector<size_t> order, partBegin;
+    partitionByDestination(dstIdx, srcDataDim[axis], partsNum, order, partBegin);
+
+    parallel_for2d(batchToUpdate, partsNum, [&](size_t b, size_t p) {
+        for (size_t k = partBegin[p]; k < partBegin[p + 1]; k++) {
+            const size_t idx = order[k];
+            uint8_t *dstEntry = dstData + (b * srcBlockND[axis] + dstIdx[idx] * blockToUpdate) * dataSize;
+            uint8_t *updateEntry = update + (b * updateBlockND[axis] + idx * blockToUpdate) * dataSize;
+            cpu_memcpy_slice(dstEntry, updateEntry, blockToUpdateSize);
+        }
     });
 }
 
@@ -415,16 +469,30 @@ void ScatterUpdate::scatterNDUpdate(uint8_t *indices, uint8_t *update, uint8_t *
     }
 
     size_t sizeToUpdate = srcBlockND[k] * dataSize;
+    // Tuples are partitioned by the updated slices, so the duplicated tuples are processed by the same thread in their order
+    std::vector<size_t> dstIdx(idxTupleNum);
     parallel_for(idxTupleNum, [&](size_t tupleIdx) {
         size_t indicesOffset = tupleIdx * k;
         size_t dstOffset = 0;
         for (int i = 0; i < k; i++) {
             size_t idxValue = getIndicesValue(indices, indicesOffset + i);
+            if (idxValue >= srcDataDim[i]) {
+                IE_THROW() << errorPrefix
+                << " have indices value that points to non-existing output tensor element";
+            }
             dstOffset += idxValue * srcBlockND[i + 1];
         }
-        dstOffset *= dataSize;
-        size_t updateOffset = tupleIdx * sizeToUpdate;
-        cpu_memcpy(dstData + dstOffset, update + updateOffset, sizeToUpdate);
+        dstIdx[tupleIdx] = dstOffset / srcBlockND[k];
+    });
+    const size_t partsNum = std::min(static_cast<size_t>(parallel_get_max_threads()), idxTupleNum);
+    std::vector<size_t> order, partBegin;
+    partitionByDestination(dstIdx, srcBlockND[0] / srcBlockND[k], partsNum, order, partBegin);
+
+    parallel_for(partsNum, [&](size_t p) {
+        for (size_t i = partBegin[p]; i < partBegin[p + 1]; i++) {
+            const size_t tupleIdx = order[i];
+            cpu_memcpy_slice(dstData + dstIdx[tupleIdx] * sizeToUpdate, update + tupleIdx * sizeToUpdate, sizeToUpdate);
+        }
     });
 }
 
@@ -437,45 +505,59 @@ void ScatterUpdate::scatterElementsUpdate(uint8_t *indices, uint8_t *update, int
     size_t updateRank = updateDim.size();
 
     std::vector<size_t> srcBlockND = getBlockND(srcDataDim);
-    std::vector<size_t> updateBlockND = getBlockND(updateDim);
 
-    parallel_nt(0, [&](const int ithr, const int nthr) {
-        int j;
-        size_t i, dst_idx = 0, start = 0, end = 0;
-        SizeVector tensorItr(updateRank, 0);
-        splitter(updateBlockND[0], nthr, ithr, start, end);
-        for (j = updateRank - 1, i = start; j >= 0; j--) {
-            tensorItr[j] = i % updateDim[j];
-            i /= updateDim[j];
+    // The updates differing in the coordinates other than axis never write the same element, so the work is split over them,
+    // and each thread goes along the axis sequentially, i.e. the last update of the element wins, if they load all the threads.
+    // The destination offsets of the outer and inner coordinates are computed once, since updates may be smaller than data.
+    auto getDstOffsets = [&](size_t beginDim, size_t endDim) {
+        std::vector<size_t> offsets(1, 0);
+        for (size_t d = beginDim; d < endDim; d++) {
+            std::vector<size_t> dimOffsets;
+            dimOffsets.reserve(offsets.size() * updateDim[d]);
+            for (const auto offset : offsets) {
+                for (size_t i = 0; i < updateDim[d]; i++)
+                    dimOffsets.push_back(offset + i * srcBlockND[d + 1]);
+            }
+            offsets.swap(dimOffsets);
         }
-
-        for (i = 0; i < static_cast<size_t>(axis); ++i)
-            dst_idx += tensorItr[i] * srcBlockND[i + 1];
-        for (i++; i < updateRank; ++i)
-            dst_idx += tensorItr[i] * srcBlockND[i + 1];
-
-        for (size_t iwork = start; iwork < end; iwork++) {
-            int64_t idxValue = getIndicesValue(indices, iwork);
-            if (idxValue < srcDataDim[axis])
-                cpu_memcpy(dstData + dataSize * (dst_idx + idxValue * srcBlockND[axis + 1]),
-                            update + iwork * dataSize, dataSize);
-
-            for (j = updateRank - 1; j >= 0; j--) {
-                tensorItr[j]++;
-                if (tensorItr[j] < updateDim[j]) {
-                    if (j != static_cast<size_t>(axis))
-                        dst_idx += srcBlockND[j + 1];
-                    break;
-                } else {
-                    tensorItr[j] = 0;
-                    for (dst_idx = 0, i = 0; i < static_cast<size_t>(axis); ++i)
-                        dst_idx += tensorItr[i] * srcBlockND[i + 1];
-                    for (i++; i < updateRank; ++i)
-                        dst_idx += tensorItr[i] * srcBlockND[i + 1];
-                }
+        return offsets;
+    };
+    const std::vector<size_t> outerDstOffsets = getDstOffsets(0, axis);
+    const std::vector<size_t> innerDstOffsets = getDstOffsets(axis + 1, updateRank);
+    const size_t outerLen = outerDstOffsets.size();
+    const size_t innerLen = innerDstOffsets.size();
+    const size_t axisLen = updateDim[axis];
+    const size_t dstAxisLen = srcDataDim[axis];
+    const size_t dstAxisStride = srcBlockND[axis + 1];
+
+    // inner blocks keep the accesses along the innermost dimension contiguous
+    const size_t innerBlock = 256;
+    const size_t innerBlocksNum = div_up(innerLen, innerBlock);
+    auto updateRows = [&](size_t o, size_t axisStart, size_t axisEnd, size_t ib) {
+        const size_t innerStart = ib * innerBlock;
+        const size_t innerEnd = std::min(innerStart + innerBlock, innerLen);
+        for (size_t a = axisStart; a < axisEnd; a++) {
+            const size_t updateOffset = (o * axisLen + a) * innerLen;
+            for (size_t i = innerStart; i < innerEnd; i++) {
+                int64_t idxValue = getIndicesValue(indices, updateOffset + i);
+                if (idxValue < dstAxisLen)
+                    cpu_memcpy_slice(dstData + dataSize * (outerDstOffsets[o] + idxValue * dstAxisStride + innerDstOffsets[i]),
+                              update + dataSize * (updateOffset + i), dataSize);
             }
         }
-    });
+    };
+
+    if (outerLen * innerBlocksNum >= static_cast<size_t>(parallel_get_max_threads())) {
+        parallel_for2d(outerLen, innerBlocksNum, [&](size_t o, size_t ib) {
+            updateRows(o, 0, axisLen, ib);
+        });
+    } else {
+        // There are too few blocks to load all the threads (e.g. 1D data), so the update rows along the axis are split
+        // as well. The duplicated indices are written in an unspecified order then, which the specification allows.
+        parallel_for3d(outerLen, axisLen, innerBlocksNum, [&](size_t o, size_t a, size_t ib) {
+            updateRows(o, a, a + 1, ib);
+        });
+    }
 }
 
 bool ScatterUpdate::created() const {
@@ -24,6 +24,7 @@
 #include "emitters/cpu_generator.hpp"
 #include "snippets_transformations/fuse_load_store_and_convert.hpp"
 #include "ngraph_transformations/convert_to_swish_cpu.hpp"
+#include <common/primitive_hashing_utils.hpp>
 
 using namespace InferenceEngine;
 using namespace dnnl::impl::utils;
@@ -34,7 +35,41 @@ using namespace Xbyak;
 namespace ov {
 namespace intel_cpu {
 namespace node {
+namespace {
+
+struct SnippetKey {
+    // The subgraph lives as long as the node, so the body doesn't have to be hashed
+    const ngraph::snippets::op::Subgraph* snippet;
+    // The shape-agnostic kernel reads the work amounts and the offsets from the call args, so the emitted code depends
+    // only on the schedule ranks and on which body inputs and outputs have the unit innermost dimension
+    // (BroadcastMove and scalar loads/stores are inserted for them, and their pointers are not advanced by the Tiles)
+    size_t harness_rank;
+    size_t tile_rank;
+    std::vector<bool> unit_innermost_dims;
+
+    size_t hash() const;
+    bool operator==(const SnippetKey& rhs) const;
+};
+
+size_t SnippetKey::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    seed = hash_combine(seed, snippet);
+    seed = hash_combine(seed, harness_rank);
+    seed = hash_combine(seed, tile_rank);
+    for (const auto unit : unit_innermost_dims)
+        seed = hash_combine(seed, unit);
+
+    return seed;
+}
 
+bool SnippetKey::operator==(const SnippetKey& rhs) const {
+    return snippet == rhs.snippet && harness_rank == rhs.harness_rank && tile_rank == rhs.tile_rank &&
+           unit_innermost_dims == rhs.unit_innermost_dims;
+}
+} // namespace
 
 Snippet::Snippet(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& eng, WeightsSharing::Ptr &cache)
         : Node(op, eng, cache, NgraphShapeInferFactory(op, EMPTY_PORT_MASK)) {
@@ -46,7 +81,7 @@ Snippet::Snippet(const std::shared_ptr<ngraph::Node>& op, const dnnl::engine& en
     }
 }
 
-void Snippet::copy_snippet() {
+std::shared_ptr<ngraph::snippets::op::Subgraph> Snippet::copy_snippet() const {
     ngraph::OutputVector subgraph_node_inputs;
     for (const auto &input : original_snippet->input_values()) {
         auto new_input = std::make_shared<ngraph::opset1::Parameter>(input.get_element_type(), input.get_partial_shape());
@@ -63,14 +98,14 @@ void Snippet::copy_snippet() {
     } else {
         new_body = ov::clone_model(*original_snippet->body_ptr());
     }
-    snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
-    ngraph::copy_runtime_info(original_snippet, snippet);
-    snippet->set_friendly_name(original_snippet->get_friendly_name());
-    snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
+    auto new_snippet = std::make_shared<ngraph::snippets::op::Subgraph>(subgraph_node_inputs, new_body);
+    ngraph::copy_runtime_info(original_snippet, new_snippet);
+    new_snippet->set_friendly_name(original_snippet->get_friendly_name());
+    return new_snippet;
 }
 
 void Snippet::initSupportedPrimitiveDescriptors() {
-    copy_snippet();
+    snippet = copy_snippet();
     if (!supportedPrimitiveDescriptors.empty())
         return;
 
@@ -85,11 +120,13 @@ void Snippet::initSupportedPrimitiveDescriptors() {
     }
 
     const size_t ndims = outputShapes[0].getRank();
-    const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 3, 4, 5) && dimRanksAreEqual;
+    // Reductions are performed over the innermost dimension of the original layout, so only planar layout is applicable
+    const bool hasReductions = snippet->has_reductions();
+    const bool isChannelsFirstApplicable = dnnl::impl::utils::one_of(ndims, 1, 2, 3, 4, 5) && dimRanksAreEqual && !hasReductions;
     // Todo: Snippets currently don't support per-channel broadcasting of Blocked descriptors because
     //  canonicalization can't distinguish between <N, C, H, W, c> and <N, C, D, H, W> cases.
     //  See snippets::op::Subgraph::canonicalize for details.
-    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual;
+    const bool isBlockedApplicable = dnnl::impl::utils::one_of(ndims,  4, 5) && dimRanksAreEqual && !hasReductions;
     enum LayoutType {
         Planar,
         ChannelsFirst,
@@ -148,7 +185,8 @@ void Snippet::initSupportedPrimitiveDescriptors() {
 
             BlockedMemoryDesc::CmpMask inputMask = BLOCKED_DESC_SKIP_OFFSET_MASK;
             PortConfig portConfig;
-            portConfig.inPlace((!i && canBeInPlace() && equalPrecisions) ? 0 : -1);
+            // the sweeps re-read the inputs after the outputs could be stored, so reductions can't be computed in place
+            portConfig.inPlace((!i && canBeInPlace() && equalPrecisions && !hasReductions) ? 0 : -1);
             portConfig.constant(false);
             if (inputShapes[i].getDims()[0] == 1) {
                 inputMask.reset(0); // accepts any stride on batch axis
@@ -193,7 +231,29 @@ void Snippet::selectOptimalPrimitiveDescriptor() {
     selectPreferPrimitiveDescriptor(getPrimitivesPriority(), true);
 }
 
+template <typename T>
+void Snippet::fill_schedule_args(T& args) const {
+    std::copy(sch_dims.begin(), sch_dims.end(), args.scheduler_dims);
+    std::copy(sch_offsets_in.begin(), sch_offsets_in.end(), args.scheduler_offsets);
+    std::copy(sch_offsets_out.begin(), sch_offsets_out.end(), &args.scheduler_offsets[sch_offsets_in.size()]);
+    const size_t harness_num_dims = std::min(exec_domain.size() - 1, static_cast<size_t>(SNIPPETS_MAX_HARNESS_DIMS));
+    for (size_t i = 0; i < offsets_in.size(); i++) {
+        auto b = offsets_in[i].begin();
+        std::copy(b, b + harness_num_dims, &args.data_offsets[i * harness_num_dims]);
+    }
+    for (size_t i = 0; i < offsets_out.size(); i++) {
+        auto b = offsets_out[i].begin();
+        std::copy(b, b + harness_num_dims, &args.data_offsets[(offsets_in.size() + i) * harness_num_dims]);
+    }
+}
+
 void Snippet::createPrimitive() {
+    if (isDynamicNode()) {
+        // the kernel is generated in prepareParams() when the input shapes are known
+        Node::createPrimitive();
+        return;
+    }
+    snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
     // schedule definition part
     // it defines offsets, strides and sizes for snippet kernel scheduling
     define_schedule();
@@ -203,7 +263,39 @@ void Snippet::createPrimitive() {
     // but in future some interface should be defined in order to communicate schedule for a kernel
     // or generate schedule for a kernel.
     // Here kernel is generated for most warying dimension by default.
-    generate();
+    generate(snippet);
+}
+
+void Snippet::prepareParams() {
+    // The body keeps the original operations, so it's canonicalized in place for the new shapes to define the schedule.
+    // The shapes and the offsets are passed to the kernel in the call args, so the body is cloned and converted to
+    // the snippets dialect only for the new broadcasting pattern
+    define_schedule();
+
+    SnippetKey key = {original_snippet.get(), exec_domain.size(), tileRank, {}};
+    const auto& body = snippet->body();
+    key.unit_innermost_dims.push_back(master_shape.back() == 1);
+    for (const auto& p : body.get_parameters())
+        key.unit_innermost_dims.push_back(p->get_shape().back() == 1);
+    for (size_t i = 0; i < body.get_output_size(); i++)
+        key.unit_innermost_dims.push_back(body.get_output_shape(i).back() == 1);
+
+    auto builder = [this](const SnippetKey& key) -> std::shared_ptr<SnippetKernel> {
+        auto kernel_snippet = copy_snippet();
+        kernel_snippet->canonicalize(output_blocked_shapes, input_blocked_shapes);
+        kernel_snippet->set_generator(std::make_shared<CPUGenerator>(host_isa));
+        generate(kernel_snippet);
+        return std::make_shared<SnippetKernel>(SnippetKernel{kernel_snippet, schedule});
+    };
+
+    auto cache = getRuntimeCache();
+    auto result = cache->getOrCreate(key, builder);
+    dynamic_kernel = result.first;
+    schedule = dynamic_kernel->schedule;
+}
+
+void Snippet::executeDynamicImpl(dnnl::stream strm) {
+    execute(strm);
 }
 
 void Snippet::execute(dnnl::stream strm) {
@@ -217,6 +309,10 @@ void Snippet::execute(dnnl::stream strm) {
     for (size_t i = 0; i < dstMemPtrs.size(); i++)
         call_args.dst_ptrs[i] = reinterpret_cast<uint8_t*>(dstMemPtrs[i]->GetData()) + start_offset_out[i];
 
+    // shape-agnostic kernel reads the schedule of the current shapes from the call args
+    if (isDynamicNode())
+        fill_schedule_args(call_args);
+
     if (tensorRank == rank6D) {
         schedule_6d(call_args);
     } else {
@@ -241,6 +337,11 @@ InferenceEngine::Precision Snippet::getRuntimePrecision() const {
 }
 
 bool Snippet::canBeInPlace() const {
+    // the input can be broadcasted to the output for some of the runtime shapes
+    if (isDynamicNode()) {
+        return false;
+    }
+
     if (getParentEdgesAtPort(0)[0]->getParent()->getType() == Type::Input) {
         return false;
     }
@@ -305,15 +406,21 @@ void Snippet::define_schedule() {
         std::copy(dims.begin(), dims.end(), &result[tensorRank - dims.size()]);
         return result;
     };
-    ngraph::snippets::op::Subgraph::BlockedShapeVector input_blocked_shapes;
+    // the schedule is redefined for each new shape of dynamic node
+    dims_in.clear();
+    dims_out.clear();
+    tileRank = 1;
+
+    input_blocked_shapes.clear();
     for (size_t i = 0; i < inputShapes.size(); i++)
         input_blocked_shapes.push_back(edgeToBlockedShape(getParentEdgesAtPort(i)[0]));
 
-    ngraph::snippets::op::Subgraph::BlockedShapeVector output_blocked_shapes;
+    output_blocked_shapes.clear();
     for (size_t i = 0; i < outputShapes.size(); i++)
         output_blocked_shapes.push_back(edgeToBlockedShape(getChildEdgesAtPort(i)[0]));
 
-    exec_domain = snippet->canonicalize(output_blocked_shapes, input_blocked_shapes);
+    master_shape = snippet->canonicalize(output_blocked_shapes, input_blocked_shapes);
+    exec_domain = master_shape;
 
     // initialize by maximum output dimension. Dimensions of outputs should be broadcastable
     tensorRank = std::max(static_cast<size_t>(rank6D), exec_domain.size());
@@ -419,9 +526,9 @@ void Snippet::define_schedule() {
 
     auto initSchedulingInfo = [this, config]() -> void {
         // initialize scheduling information
-        sch_offsets_in.resize(offsets_in.size(), 0);
-        sch_offsets_out.resize(offsets_out.size(), 0);
-        sch_dims.resize(maxTileRank, 1);
+        sch_offsets_in.assign(offsets_in.size(), 0);
+        sch_offsets_out.assign(offsets_out.size(), 0);
+        sch_dims.assign(maxTileRank, 1);
         sch_dims[maxTileRank-1] = exec_domain.back();
         schedulerWorkAmount = fullWorkAmount / exec_domain.back();
         if (tileRank > 1) {
@@ -429,6 +536,22 @@ void Snippet::define_schedule() {
             schedulerWorkAmount /= exec_domain[tensorRank - 2];
             exec_domain[tensorRank - 2] = 1;
 
+            // shape-agnostic kernel always advances the pointers by the whole inner work amount,
+            // except for the ones that are broadcasted over the innermost dimension
+            if (isDynamicNode()) {
+                auto init_dynamic_offsets = [this](std::vector<int64_t>& sch_offsets, const std::vector<std::vector<size_t>>& offsets,
+                                                   const std::vector<std::vector<size_t>>& dims, const std::vector<PortConfig>& confs) {
+                    for (size_t i = 0; i < offsets.size(); i++) {
+                        const int64_t data_size = confs[i].getMemDesc()->getPrecision().size();
+                        const int64_t advance = dims[i].back() != 1 ? exec_domain.back() * data_size : 0;
+                        sch_offsets[i] = static_cast<int64_t>(offsets[i][tensorRank - 2]) - advance;
+                    }
+                };
+                init_dynamic_offsets(sch_offsets_in, offsets_in, dims_in, config.inConfs);
+                init_dynamic_offsets(sch_offsets_out, offsets_out, dims_out, config.outConfs);
+                return;
+            }
+
             // update offsets for tile 2D because loaders and stores have ptr shifts in some cases
             const int64_t vector_size = snippet->get_generator()->get_target_machine()->get_lanes();
             for (size_t i = 0; i < offsets_in.size(); i++) {
@@ -472,31 +595,23 @@ void Snippet::define_schedule() {
 
     batchDimIdx = tensorRank - exec_domain.size();
     // Note that exec_domain can be modified inside find_dims_to_collapse() and/or initSchedulingInfo()
-    find_dims_to_collapse();
+    // The reduced innermost dimension can't be collapsed with the outer ones
+    if (!snippet->has_reductions())
+        find_dims_to_collapse();
 
     initOffsets();
     initSchedulingInfo();
 }
 
-void Snippet::generate() {
+void Snippet::generate(const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph) {
     jit_snippets_compile_args jcp;
     jcp.output_dims = exec_domain;
-    std::copy(sch_dims.begin(), sch_dims.end(), jcp.scheduler_dims);
-    std::copy(sch_offsets_in.begin(), sch_offsets_in.end(), jcp.scheduler_offsets);
-    std::copy(sch_offsets_out.begin(), sch_offsets_out.end(), &jcp.scheduler_offsets[sch_offsets_in.size()]);
-    size_t harness_num_dims = jcp.output_dims.size() - 1;
-    if (harness_num_dims > SNIPPETS_MAX_HARNESS_DIMS) {
+    jcp.is_dynamic = isDynamicNode();
+    if (jcp.output_dims.size() - 1 > SNIPPETS_MAX_HARNESS_DIMS)
         canUseOptimizedImpl = false;
-        harness_num_dims = SNIPPETS_MAX_HARNESS_DIMS;
-    }
-    for (size_t i = 0; i < inputShapes.size(); i++) {
-        auto b = offsets_in[i].begin();
-        std::copy(b, b + harness_num_dims, &jcp.data_offsets[i * harness_num_dims]);
-    }
-    for (size_t i = 0; i < outputShapes.size(); i++) {
-        auto b = offsets_out[i].begin();
-        std::copy(b, b + harness_num_dims, &jcp.data_offsets[(inputShapes.size() + i) * harness_num_dims]);
-    }
+    // the shape-agnostic kernel takes the schedule from the call args only
+    if (!jcp.is_dynamic)
+        fill_schedule_args(jcp);
 
     ov::pass::Manager optManager;
     optManager.register_pass<ov::intel_cpu::pass::FuseLoadConvert>();
@@ -519,7 +634,7 @@ void Snippet::generate() {
                 return true;
             });
 
-    schedule = snippet->generate(optManager, reinterpret_cast<void*>(&jcp));
+    schedule = subgraph->generate(optManager, reinterpret_cast<void*>(&jcp));
 }
 
 void Snippet::schedule_6d(const jit_snippets_call_args& call_args) const {
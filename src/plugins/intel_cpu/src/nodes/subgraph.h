@@ -38,12 +38,15 @@ public:
 
     // Here we convert to canonical for & jit everything
     void createPrimitive() override;
+    // Dynamic shapes: updates the schedule and takes shape-agnostic kernel from the cache or generates it
+    void prepareParams() override;
 
     bool canBeInPlace() const override;
     bool created() const override;
 
     // if generator is set, it would execute generated code otherwise it would fallback to nGraph reference
     void execute(dnnl::stream strm) override;
+    void executeDynamicImpl(dnnl::stream strm) override;
 
 private:
     static const size_t rank6D {6};
@@ -53,11 +56,16 @@ private:
     // Create a deep local copy of the input snippet to perform canonicalization & code generation
     // TODO: Probably better to implement a proper copy constructor
     // NOTE: Before call mutex should be initialized
-    void copy_snippet();
+    std::shared_ptr<ngraph::snippets::op::Subgraph> copy_snippet() const;
 
     void define_schedule();
 
-    void generate();
+    // Converts the canonicalized subgraph to the snippets dialect and emits the code for the current schedule
+    void generate(const std::shared_ptr<ngraph::snippets::op::Subgraph>& subgraph);
+
+    // Fills the fields describing the schedule, they are the same in jit_snippets_compile_args and jit_snippets_call_args
+    template <typename T>
+    void fill_schedule_args(T& args) const;
 
     // Evaluates generated snippet using parallel backend
     void schedule_6d(const jit_snippets_call_args& const_args) const;
@@ -66,17 +74,30 @@ private:
     // Original subgraph node
     std::shared_ptr<ngraph::snippets::op::Subgraph> original_snippet;
     // Local copy of subgraph node for canonization & code generation
+    // For dynamic node it's only canonicalized, the code is generated on the copies of the original subgraph
     std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
 
     // Holds generated snippet with information about how to schedule it
     ngraph::snippets::Schedule schedule;
 
+    // Generated code is owned by the generator of the subgraph, so the cached shape-agnostic kernel
+    // keeps the subgraph alive together with the schedule
+    struct SnippetKernel {
+        std::shared_ptr<ngraph::snippets::op::Subgraph> snippet;
+        ngraph::snippets::Schedule schedule;
+    };
+    std::shared_ptr<SnippetKernel> dynamic_kernel = nullptr;
+
     // Holds ISA version used is codeGeneration target
     dnnl::impl::cpu::x64::cpu_isa_t host_isa;
 
     // Holds index of output used as in execution domain
     // it should be compatible with a schedule's work size
     std::vector<size_t> exec_domain = {};
+    // Canonicalized shape the inputs and outputs are broadcasted to, exec_domain is derived from it
+    std::vector<size_t> master_shape = {};
+    ngraph::snippets::op::Subgraph::BlockedShapeVector input_blocked_shapes = {};
+    ngraph::snippets::op::Subgraph::BlockedShapeVector output_blocked_shapes = {};
 
     /// scheduling info
     size_t batchDimIdx = 0;
@@ -4,6 +4,7 @@
 
 #include "tensoriterator.h"
 
+#include <algorithm>
 #include <string>
 #include <vector>
 #include <dnnl_extension_utils.h>
@@ -14,6 +15,8 @@
 #include "transformations/utils/utils.hpp"
 #include "common/cpu_memcpy.h"
 #include <utils/shape_inference/shape_inference_internal_dyn.hpp>
+#include <openvino/op/util/assign_base.hpp>
+#include <openvino/op/util/read_value_base.hpp>
 
 using namespace dnnl;
 using namespace InferenceEngine;
@@ -145,6 +148,81 @@ private:
     int iter_count;
 };
 
+/**
+ * Instead of copying the iteration chunk, redirects the body memories to the chunk of the outer tensor.
+ * Applicable only if the chunk is a dense part of the outer tensor which has the layout and precision of the body memory.
+ */
+class PortViewHelper : public PortMapHelper {
+public:
+    PortViewHelper(const MemoryPtr &full_mem, const std::vector<MemoryPtr> &part_mems, const PortMap &slice_rule)
+                   : full_mem(full_mem), part_mems(part_mems) {
+        const auto &full_dims = full_mem->getStaticDims();
+        const auto abs_stride = std::abs(slice_rule.stride);
+
+        iter_count = full_dims[slice_rule.axis] / abs_stride;
+
+        chunk_stride_in_byte = std::accumulate(full_dims.begin() + slice_rule.axis + 1, full_dims.end(),
+                                               full_mem->getDesc().getPrecision().size() * abs_stride, std::multiplies<size_t>());
+        chunk_offset_in_byte = slice_rule.stride < 0 ? (iter_count - 1) * chunk_stride_in_byte : 0;
+        chunk_stride_in_byte *= slice_rule.stride < 0 ? -1 : 1;
+    }
+
+    static bool isApplicable(const MemoryPtr &full_mem, const MemoryPtr &part_mem, const PortMap &slice_rule) {
+        const auto &full_dims = full_mem->getStaticDims();
+        if (std::any_of(full_dims.begin(), full_dims.begin() + slice_rule.axis, [](size_t dim) { return dim != 1; }))
+            return false;
+
+        const auto prec = full_mem->getDesc().getPrecision();
+        if (!CpuBlockedMemoryDesc(prec, full_mem->GetShape()).isCompatible(full_mem->getDesc()))
+            return false;
+
+        auto part_dims = full_dims;
+        part_dims[slice_rule.axis] = std::abs(slice_rule.stride);
+        return CpuBlockedMemoryDesc(prec, Shape(part_dims)).isCompatible(part_mem->getDesc());
+    }
+
+    void execute(dnnl::stream strm, int iter) override {
+        IE_ASSERT(iter >= 0 && iter < iter_count);
+
+        auto chunk_ptr = static_cast<uint8_t *>(full_mem->GetPtr()) + chunk_offset_in_byte + chunk_stride_in_byte * iter;
+        for (const auto &mem : part_mems)
+            mem->setDataHandle(chunk_ptr);
+    }
+
+private:
+    ptrdiff_t chunk_stride_in_byte = 0;
+    ptrdiff_t chunk_offset_in_byte = 0;
+
+    MemoryPtr full_mem;
+    std::vector<MemoryPtr> part_mems;
+
+    int iter_count;
+};
+
+// The conditions follow the zero-copy of the user blobs (see InferRequestBase::changeDefaultPtr).
+// The body input memory must not be written by its consumers, since it refers to the outer tensor.
+static bool canReferOuterMemory(const NodePtr &input) {
+    for (const auto &childEdge : input->getChildEdges()) {
+        const auto ce = childEdge.lock();
+        const auto &child = ce->getChild();
+        if (child->isConstant() || child->isInPlace() || one_of(child->getType(), Type::Concatenation, Type::Split))
+            return false;
+
+        for (const auto &edge : child->getChildEdges()) {
+            if (edge.lock()->getMemory().GetData() == ce->getMemory().GetData())
+                return false;
+        }
+    }
+    return true;
+}
+
+// The body output memory must be owned by the node producing it, so that the redirection doesn't affect other tensors.
+static bool canWriteOuterMemory(const NodePtr &output) {
+    const auto &parent = output->getParentEdgeAt(0)->getParent();
+    return parent->getType() != Type::Input && parent->getChildEdges().size() == 1 &&
+           !parent->isConstant() && !parent->isInPlace();
+}
+
 class BackEdgePortHelper : public PortMapHelper {
 public:
     BackEdgePortHelper(const MemoryPtr &from, const MemoryPtr &to, const dnnl::engine& eng) {
@@ -230,88 +308,73 @@ DynamicBuffer::DynamicBuffer(const MemoryPtr &from_, const std::vector<MemoryPtr
 }
 
 void DynamicBuffer::execute(const dnnl::engine& eng, const int iter) {
-    if (iter == 0) {
+    if (iter == 0)
         init(eng);
-        return;
-    }
 
-    auto new_buffer = create_buffer(eng);
-    move_buffer(new_buffer);
-    move_data();
+    const auto abs_stride = std::abs(map_rule.stride);
+    if (from->getStaticDims()[map_rule.axis] != abs_stride)
+        IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
+                   " is expected, but actual: " << from->getStaticDims()[map_rule.axis];
+
+    if (num_execs == max_num_execs)
+        grow(eng);
+    append();
 }
 
 void DynamicBuffer::init(const dnnl::engine& eng) {
-    chunk_offset_in_byte = 0;
-    buffer_offset_in_byte = 0;
-
-    const auto axis = map_rule.axis;
-    const auto stride = map_rule.stride;
-    const auto abs_stride = std::abs(stride);
-
-    auto src_mem = from->GetPrimitive();
-    auto src_desc = src_mem.get_desc();
-    auto dims = src_desc.dims();
-
-    if (dims[axis] != abs_stride)
-        IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
-                   " is expected, but actual: " << dims[axis];
-
+    const auto dims = from->getStaticDims();
     count = std::accumulate(dims.begin(), dims.begin() + map_rule.axis, size_t(1), std::multiplies<size_t>());
     len = std::accumulate(dims.begin() + map_rule.axis + 1, dims.end(), elem_size, std::multiplies<size_t>());
-    mem_holder_buffer.reset(new memory(src_desc, eng));
-    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()), 0, 0, 1, from->GetSize());
-}
+    chunk_size_in_byte = std::abs(map_rule.stride) * len;
 
-std::shared_ptr<dnnl::memory> DynamicBuffer::create_buffer(const dnnl::engine& eng) {
-    const auto axis = map_rule.axis;
-    const auto stride = map_rule.stride;
-    const auto abs_stride = std::abs(stride);
-
-    const auto old_desc = mem_holder_buffer->get_desc();
-    auto dims = old_desc.dims();
+    num_execs = 0;
+    max_num_execs = 0;
+    mem_holder_buffer.reset();
+}
 
-    if (from->getStaticDims()[axis] != abs_stride)
-        IE_THROW() << "TensorIterator (Loop) has incorrect output shape[axis] after iteration for concatenation. " << abs_stride <<
-        " is expected, but actual: " << from->getStaticDims()[axis];
+void DynamicBuffer::grow(const dnnl::engine& eng) {
+    // The capacity is doubled, so each iteration result is moved a constant number of times on average
+    const auto new_max_num_execs = std::max(max_num_execs * 2, size_t(1));
 
-    dims[axis] += abs_stride;
-    dnnl::memory::desc new_buffer_desc(dims, old_desc.data_type(), DnnlExtensionUtils::GetPlainFormatByRank(dims.size()));
+    auto dims = DnnlExtensionUtils::convertToDnnlDims(from->getStaticDims());
+    dims[map_rule.axis] = new_max_num_execs * std::abs(map_rule.stride);
+    dnnl::memory::desc new_buffer_desc(dims, from->GetDataType(), DnnlExtensionUtils::GetPlainFormatByRank(dims.size()));
+    auto new_buffer = std::make_shared<dnnl::memory>(new_buffer_desc, eng);
 
-    if (stride > 0.0f) {
-        chunk_offset_in_byte += new_buffer_desc.data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
-    } else {
-        buffer_offset_in_byte = from->GetPrimitive().get_desc().data.format_desc.blocking.strides[axis] * elem_size * abs_stride;
+    if (mem_holder_buffer) {
+        copy(get_ptr(*mem_holder_buffer.get()), get_ptr(*new_buffer.get()),
+             max_num_execs * chunk_size_in_byte, new_max_num_execs * chunk_size_in_byte, count, num_execs * chunk_size_in_byte);
     }
-
-    return std::make_shared<dnnl::memory>(new_buffer_desc, eng);
-}
-
-void DynamicBuffer::move_buffer(std::shared_ptr<dnnl::memory> new_buffer) {
-    const auto axis = map_rule.axis;
-    const auto src_stride = mem_holder_buffer->get_desc().dims()[axis] * len;
-    const auto dst_stride = new_buffer->get_desc().dims()[axis] * len;
-
-    copy(get_ptr(*mem_holder_buffer.get()), get_ptr(*new_buffer.get()) + buffer_offset_in_byte,
-         src_stride, dst_stride, count, src_stride);
     mem_holder_buffer = new_buffer;
+    max_num_execs = new_max_num_execs;
 }
 
-void DynamicBuffer::move_data() {
-    const auto axis = map_rule.axis;
-    const auto src_stride = abs(map_rule.stride) * len;
-    const auto dst_stride = mem_holder_buffer->get_desc().dims()[axis] * len;
-
-    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()) + chunk_offset_in_byte,
-         src_stride, dst_stride, count, src_stride);
+void DynamicBuffer::append() {
+    copy(reinterpret_cast<const uint8_t*>(from->GetPtr()), get_ptr(*mem_holder_buffer.get()) + num_execs * chunk_size_in_byte,
+         chunk_size_in_byte, max_num_execs * chunk_size_in_byte, count, chunk_size_in_byte);
+    num_execs++;
 }
 
 void DynamicBuffer::transfer(const Node* node) {
     if (mem_holder_buffer) {
-        const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(
-                DnnlExtensionUtils::convertToVectorDims(mem_holder_buffer->get_desc().dims()));
+        auto dims = DnnlExtensionUtils::convertToVectorDims(mem_holder_buffer->get_desc().dims());
+        dims[map_rule.axis] = num_execs * std::abs(map_rule.stride);
+        const auto desc = node->getBaseMemDescAtOutputPort(map_rule.from)->cloneWithNewDims(dims);
         redefineToMemories(to, desc);
 
-        copy(get_ptr(*mem_holder_buffer.get()), reinterpret_cast<uint8_t*>(to.front()->GetPtr()), 0, 0, 1, to.front()->GetSize());
+        const auto src = get_ptr(*mem_holder_buffer.get());
+        const auto dst = reinterpret_cast<uint8_t*>(to.front()->GetPtr());
+        const auto src_stride = max_num_execs * chunk_size_in_byte;
+        const auto dst_stride = num_execs * chunk_size_in_byte;
+        if (map_rule.stride > 0) {
+            copy(src, dst, src_stride, dst_stride, count, dst_stride);
+        } else {
+            // the results of the iterations are concatenated in the reverse order
+            parallel_for2d(count, num_execs, [&](size_t i, size_t j) {
+                cpu_memcpy(dst + i * dst_stride + (num_execs - 1 - j) * chunk_size_in_byte,
+                           src + i * src_stride + j * chunk_size_in_byte, chunk_size_in_byte);
+            });
+        }
     } else {
         VectorDims newDims = to.front()->GetShape().getDims();
         nullifyUndefinedDims(newDims);
@@ -365,23 +428,21 @@ void TensorIterator::getSupportedDescriptors() {
     }
     const std::shared_ptr<const ov::Model> body = tiOp->get_function();
     sub_graph.CreateGraph(body, ext_mng, weightCache, sharedMutex);
-
-    const auto &inMap = sub_graph.GetInputNodesMap();
-    for (const auto &param : tiOp->get_function()->get_parameters()) {
-        auto inNode = inMap.find(param->get_friendly_name());
-        if (inNode != inMap.end()) {
-            input_mems.push_back(getToMemories(inNode->second.get(), 0));
+    collectBodyMemories(sub_graph, input_mems, output_mem);
+
+    if (!isDynamicNode()) {
+        const auto &inMap = sub_graph.GetInputNodesMap();
+        for (const auto &param : body->get_parameters()) {
+            auto inNode = inMap.find(param->get_friendly_name());
+            if (inNode != inMap.end())
+                input_views.push_back(canReferOuterMemory(inNode->second));
         }
-    }
 
-    const auto &outMap = sub_graph.GetOutputNodesMap();
-    for (const auto &out : tiOp->get_function()->get_results()) {
-        const auto prev = out->input_value(0);
-        const auto inputID = ngraph::op::util::create_ie_output_name(prev);
-        auto outNode = outMap.find(inputID);
-        if (outNode != outMap.end()) {
-            auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
-            output_mem.push_back(outMem);
+        const auto &outMap = sub_graph.GetOutputNodesMap();
+        for (const auto &out : body->get_results()) {
+            auto outNode = outMap.find(ngraph::op::util::create_ie_output_name(out->input_value(0)));
+            if (outNode != outMap.end())
+                output_views.push_back(canWriteOuterMemory(outNode->second));
         }
     }
 
@@ -452,6 +513,91 @@ void TensorIterator::getSupportedDescriptors() {
     } else {
         THROW_ERROR << "isn't supported!";
     }
+
+    // Several body outputs can't be written to the same memory
+    for (const auto& map_rule : outputPortMap) {
+        if (map_rule.axis != -1 && map_rule.to < static_cast<int>(output_views.size()) &&
+            std::count_if(outputPortMap.begin(), outputPortMap.end(),
+                          [&](const PortMap& rule) { return rule.axis != -1 && rule.to == map_rule.to; }) > 1)
+            output_views[map_rule.to] = false;
+    }
+
+#if (IE_THREAD == IE_THREAD_TBB || IE_THREAD == IE_THREAD_TBB_AUTO)
+    concurrentIterations = iterationsAreIndependent() && bodyIsWorthReplicating();
+#endif
+}
+
+void TensorIterator::collectBodyMemories(Graph& graph, std::vector<std::vector<MemoryPtr>>& in_mems,
+                                         std::vector<MemoryPtr>& out_mems) const {
+    const auto body = ov::as_type_ptr<const ov::op::util::SubGraphOp>(ngraphOp)->get_function();
+
+    const auto &inMap = graph.GetInputNodesMap();
+    for (const auto &param : body->get_parameters()) {
+        auto inNode = inMap.find(param->get_friendly_name());
+        if (inNode != inMap.end()) {
+            in_mems.push_back(getToMemories(inNode->second.get(), 0));
+        }
+    }
+
+    const auto &outMap = graph.GetOutputNodesMap();
+    for (const auto &out : body->get_results()) {
+        const auto prev = out->input_value(0);
+        const auto inputID = ngraph::op::util::create_ie_output_name(prev);
+        auto outNode = outMap.find(inputID);
+        if (outNode != outMap.end()) {
+            auto outMem = outNode->second->getParentEdgeAt(0)->getMemoryPtr();
+            out_mems.push_back(outMem);
+        }
+    }
+}
+
+bool TensorIterator::iterationsAreIndependent() const {
+    if (isDynamicNode() || !backEdges.empty())
+        return false;
+
+    const auto body = ov::as_type_ptr<const ov::op::util::SubGraphOp>(ngraphOp)->get_function();
+    if (loopBodyConditionOutputIdx != -1) {
+        const auto cond = ov::as_type_ptr<const ov::op::v0::Constant>(
+                body->get_results()[loopBodyConditionOutputIdx]->get_input_node_shared_ptr(0));
+        if (!cond || shape_size(cond->get_shape()) != 1 || !cond->cast_vector<bool>()[0])
+            return false;
+    }
+
+    // The state is shared by all the iterations
+    for (const auto& op : body->get_ordered_ops()) {
+        if (ov::is_type<ov::op::util::ReadValueBase>(op) || ov::is_type<ov::op::util::AssignBase>(op))
+            return false;
+    }
+    return true;
+}
+
+bool TensorIterator::bodyIsWorthReplicating() const {
+    // The body is considered cheap if it writes less than this per iteration, then the task dispatch and the memory
+    // of the replicas aren't paid off
+    constexpr size_t minBodyOutputSize = 64 * 1024;
+
+    size_t bodyOutputSize = 0;
+    for (const auto& node : sub_graph.GetNodes()) {
+        for (size_t i = 0; i < node->getChildEdges().size(); i++)
+            bodyOutputSize += node->getChildEdgeAt(i)->getMemory().GetSize();
+    }
+    return bodyOutputSize >= minBodyOutputSize;
+}
+
+void TensorIterator::createBodyReplicas(int num_iter) {
+    // Each replica holds the whole body memory, so their number is limited. The node belongs to the graph of a single
+    // stream, so the number of the threads available at the execution is the number of the stream threads.
+    constexpr int maxBodyReplicas = 8;
+    const auto numReplicas = static_cast<size_t>(std::min({parallel_get_max_threads(), maxBodyReplicas, num_iter}) - 1);
+
+    const auto body = ov::as_type_ptr<const ov::op::util::SubGraphOp>(ngraphOp)->get_function();
+    while (replicas.size() < numReplicas) {
+        auto replica = std::make_shared<BodyReplica>();
+        replica->graph.CreateGraph(body, ext_mng, weightCache, sharedMutex);
+        collectBodyMemories(replica->graph, replica->input_mems, replica->output_mem);
+        prepareBodyReplica(*replica);
+        replicas.push_back(replica);
+    }
 }
 
 void TensorIterator::initSupportedPrimitiveDescriptors() {
@@ -508,23 +654,54 @@ void TensorIterator::prepareParams() {
     if ((lastUsedCond && lastUsedTripCount != 0) || !isDynamicNode()) {
         reshapeSubgraphInput();
 
-        prepareInputPorts();
+        prepareInputPorts(input_mems, first_mappers, before_mappers);
         prepareContinueCond();
-        prepareLoopBodyCurrentIteration();
+        prepareLoopBodyCurrentIteration(input_mems, before_mappers);
 
         if (!isDynamicNode()) {
-            prepareOutputPorts();
+            last_mappers.clear();
+            after_mappers.clear();
+
+            // the back edges must read the output of the previous iteration before the output is redirected
             prepareBackEdges();
+            prepareOutputPorts(output_mem, last_mappers, before_mappers, after_mappers);
+            prepareBodyReplicas();
         }
     }
 }
 
+void TensorIterator::prepareBodyReplicas() {
+    for (auto& replica : replicas)
+        prepareBodyReplica(*replica);
+}
+
+void TensorIterator::prepareBodyReplica(BodyReplica& replica) {
+    replica.first_mappers.clear();
+    replica.last_mappers.clear();
+    replica.before_mappers.clear();
+    replica.after_mappers.clear();
+
+    prepareInputPorts(replica.input_mems, replica.first_mappers, replica.before_mappers);
+    prepareLoopBodyCurrentIteration(replica.input_mems, replica.before_mappers);
+    prepareOutputPorts(replica.output_mem, replica.last_mappers, replica.before_mappers, replica.after_mappers);
+}
+
 void TensorIterator::execute(dnnl::stream strm) {
     sub_graph.ResetInferCount();
 
     bool continue_cond = initial_cond_check->getStatus();
     int max_num_iter = trip_count_check->getStatus();
 
+    // A few iterations don't pay off the split
+    constexpr int minConcurrentIterations = 4;
+    if (concurrentIterations && continue_cond && max_num_iter >= minConcurrentIterations) {
+        createBodyReplicas(max_num_iter);
+        if (!replicas.empty()) {
+            executeIterationsConcurrently(max_num_iter);
+            return;
+        }
+    }
+
     for (auto &mapper : first_mappers)
         mapper->execute(strm);
 
@@ -548,6 +725,46 @@ void TensorIterator::execute(dnnl::stream strm) {
         mapper->execute(strm);
 }
 
+void TensorIterator::executeIterationsConcurrently(int num_iter) {
+    // The iterations are split into contiguous ranges, and the body graph executes the first one. The replicas created
+    // for a longer loop before are left idle.
+    const int numThreads = std::min(static_cast<int>(replicas.size()) + 1, num_iter);
+    parallel_nt(numThreads, [&](const int ithr, const int nthr) {
+        int start = 0, end = 0;
+        splitter(num_iter, nthr, ithr, start, end);
+        if (start >= end)
+            return;
+
+        auto& graph = ithr == 0 ? sub_graph : replicas[ithr - 1]->graph;
+        const auto& first = ithr == 0 ? first_mappers : replicas[ithr - 1]->first_mappers;
+        const auto& before = ithr == 0 ? before_mappers : replicas[ithr - 1]->before_mappers;
+        const auto& after = ithr == 0 ? after_mappers : replicas[ithr - 1]->after_mappers;
+        const auto& last = ithr == 0 ? last_mappers : replicas[ithr - 1]->last_mappers;
+
+        dnnl::stream strm(getEngine());
+        graph.ResetInferCount();
+
+        for (auto &mapper : first)
+            mapper->execute(strm);
+
+        for (int i = start; i < end; i++) {
+            for (auto &mapper : before)
+                mapper->execute(strm, i);
+
+            graph.Infer();
+
+            for (auto &mapper : after)
+                mapper->execute(strm, i);
+        }
+
+        // the body outputs of the last iteration are the outputs of the node
+        if (end == num_iter) {
+            for (auto &mapper : last)
+                mapper->execute(strm);
+        }
+    });
+}
+
 void TensorIterator::executeDynamicImpl(dnnl::stream strm) {
     const auto &eng = getEngine();
     sub_graph.ResetInferCount();
@@ -583,30 +800,34 @@ void TensorIterator::executeDynamicImpl(dnnl::stream strm) {
 
 /* *==============* Prepare reorders, edges between body and TI *==============* */
 
-void TensorIterator::prepareInputPorts() {
+void TensorIterator::prepareInputPorts(const std::vector<std::vector<MemoryPtr>>& in_mems, MapperList& first, MapperList& before) {
     const auto &eng = getEngine();
     for (auto map_rule : inputPortMap) {
         auto &from_mem = getParentEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
-        auto &to_mem = input_mems[map_rule.to].front();  // first memory is enough to access the shared underlying physical memory
+        auto &to_mem = in_mems[map_rule.to].front();  // first memory is enough to access the shared underlying physical memory
 
         if (map_rule.axis == -1)
-            first_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
+            first.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
+        else if (!isDynamicNode() && input_views[map_rule.to] && PortViewHelper::isApplicable(from_mem, to_mem, map_rule))
+            before.emplace_back(std::make_shared<PortViewHelper>(from_mem, in_mems[map_rule.to], map_rule));
         else
-            before_mappers.emplace_back(
+            before.emplace_back(
                     std::make_shared<PortIteratorHelper>(from_mem, to_mem, true, map_rule, eng));
     }
 }
 
-void TensorIterator::prepareOutputPorts() {
+void TensorIterator::prepareOutputPorts(const std::vector<MemoryPtr>& out_mems, MapperList& last, MapperList& before, MapperList& after) {
     const auto &eng = getEngine();
     for (auto map_rule : outputPortMap) {
         auto &to_mem = getChildEdgesAtPort(map_rule.from)[0]->getMemoryPtr();
-        auto &from_mem = output_mem[map_rule.to];
+        auto &from_mem = out_mems[map_rule.to];
 
         if (map_rule.axis == -1)
-            last_mappers.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
+            last.emplace_back(std::make_shared<BackEdgePortHelper>(from_mem, to_mem, eng));
+        else if (output_views[map_rule.to] && PortViewHelper::isApplicable(to_mem, from_mem, map_rule))
+            before.emplace_back(std::make_shared<PortViewHelper>(to_mem, std::vector<MemoryPtr>{from_mem}, map_rule));
         else
-            after_mappers.emplace_back(std::make_shared<PortIteratorHelper>(from_mem, to_mem, false, map_rule, eng));
+            after.emplace_back(std::make_shared<PortIteratorHelper>(from_mem, to_mem, false, map_rule, eng));
     }
 }
 
@@ -644,11 +865,11 @@ void TensorIterator::prepareDynamicBuffers() {
     }
 }
 
-void TensorIterator::prepareLoopBodyCurrentIteration() {
+void TensorIterator::prepareLoopBodyCurrentIteration(const std::vector<std::vector<MemoryPtr>>& in_mems, MapperList& before) {
     const auto &eng = getEngine();
     for (auto idx : loopBodyCurrentIterationIdx) {
-        auto to_mem = input_mems[idx].front();  // first memory is enough to get common memory ptr
-        before_mappers.emplace_back(std::make_shared<IterCountPortHelper>(to_mem, eng));
+        auto to_mem = in_mems[idx].front();  // first memory is enough to get common memory ptr
+        before.emplace_back(std::make_shared<IterCountPortHelper>(to_mem, eng));
     }
 }
 
@@ -74,9 +74,8 @@ private:
     void init(const dnnl::engine& eng);
 
     /* methods for resize and refill buffer */
-    std::shared_ptr<dnnl::memory> create_buffer(const dnnl::engine& eng);
-    void move_buffer(std::shared_ptr<dnnl::memory> new_buffer);
-    void move_data();
+    void grow(const dnnl::engine& eng);
+    void append();
 
     static void copy(const uint8_t* src, uint8_t* dst, const size_t src_stride, const size_t dst_stride, const size_t count, const size_t len);
     static uint8_t* get_ptr(dnnl::memory& prim);
@@ -84,8 +83,9 @@ private:
     size_t len = 1lu;
     size_t count = 1lu;
     size_t elem_size = 0lu;
-    ptrdiff_t chunk_offset_in_byte = 0;
-    ptrdiff_t buffer_offset_in_byte = 0;
+    size_t chunk_size_in_byte = 0lu;  /**< Size of the iteration result in one outer row of the buffer */
+    size_t num_execs = 0lu;           /**< Number of the iteration results stored in the buffer */
+    size_t max_num_execs = 0lu;       /**< Capacity of the buffer, it's doubled when exhausted */
 
     MemoryPtr from;
     std::vector<MemoryPtr> to;
@@ -118,12 +118,33 @@ protected:
     void executeDynamicImpl(dnnl::stream strm) override;
 
 private:
-    void prepareInputPorts();
-    void prepareOutputPorts();
+    using MapperList = std::vector<std::shared_ptr<PortMapHelper>>;
+
+    /**
+     * Copy of the body graph with its own memory. The independent iterations of a static loop are
+     * distributed among the body graph and its replicas, which are executed concurrently.
+     */
+    struct BodyReplica {
+        Graph graph;
+        std::vector<std::vector<MemoryPtr>> input_mems;
+        std::vector<MemoryPtr> output_mem;
+        MapperList first_mappers, last_mappers, before_mappers, after_mappers;
+    };
+
+    void collectBodyMemories(Graph& graph, std::vector<std::vector<MemoryPtr>>& in_mems, std::vector<MemoryPtr>& out_mems) const;
+    bool iterationsAreIndependent() const;
+    bool bodyIsWorthReplicating() const;
+    void createBodyReplicas(int num_iter);
+    void prepareBodyReplicas();
+    void prepareBodyReplica(BodyReplica& replica);
+    void executeIterationsConcurrently(int num_iter);
+
+    void prepareInputPorts(const std::vector<std::vector<MemoryPtr>>& in_mems, MapperList& first, MapperList& before);
+    void prepareOutputPorts(const std::vector<MemoryPtr>& out_mems, MapperList& last, MapperList& before, MapperList& after);
     void prepareBackEdges();
     void prepareDynamicBackEdges();
     void prepareDynamicBuffers();
-    void prepareLoopBodyCurrentIteration();
+    void prepareLoopBodyCurrentIteration(const std::vector<std::vector<MemoryPtr>>& in_mems, MapperList& before);
     void prepareContinueCond();
     void prepareInitialCond();
     void prepareTripCount();
@@ -153,6 +174,12 @@ private:
 
     std::vector<std::shared_ptr<DynamicBuffer>> buffers;
 
+    std::vector<bool> input_views;   /// < The body input may refer to the slice of the outer tensor instead of its copy
+    std::vector<bool> output_views;  /// < The body output may be written directly to the slice of the outer tensor
+    /// The replicas are created at the first execution, when the number of the stream threads is known
+    std::vector<std::shared_ptr<BodyReplica>> replicas;
+    bool concurrentIterations = false;
+
     std::vector<PortMap> inputPortMap;  //!< Input ports map
     std::vector<PortMap> outputPortMap;  //!< Output ports map
     std::vector<PortMap> backEdges;  //!< Back edges map
@@ -2,9 +2,13 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <algorithm>
+#include <cstring>
+#include <numeric>
 #include <string>
 #include <vector>
 
+#include "ie_parallel.hpp"
 #include "unique.hpp"
 #include <ngraph/opsets/opset1.hpp>
 #include <utils/shape_inference/shape_inference_internal_dyn.hpp>
@@ -15,6 +19,70 @@ using namespace ov::intel_cpu::node;
 
 #define THROW_ERROR IE_THROW() << getTypeStr() << " node with name '" << getName() << "' "
 
+namespace {
+// Hash keys of the values. The integer keys preserve the order of the values, so they are used by the radix sort as well.
+// Both float zeros produce the same key, since they are equal.
+inline uint32_t uniqueKey(float val) {
+    uint32_t bits = 0u;
+    if (val != 0.f) {
+        std::memcpy(&bits, &val, sizeof(bits));
+    }
+    return bits;
+}
+inline uint32_t uniqueKey(int32_t val) {
+    return static_cast<uint32_t>(val) ^ 0x80000000u;
+}
+inline uint32_t uniqueKey(int8_t val) {
+    return static_cast<uint32_t>(static_cast<uint8_t>(val) ^ 0x80u);
+}
+inline uint32_t uniqueKey(uint8_t val) {
+    return val;
+}
+
+// Fibonacci hashing: the high bits select the partition and the table slot is taken from the mixed low bits
+inline uint64_t hashKey(uint32_t key) {
+    return static_cast<uint64_t>(key) * 0x9E3779B97F4A7C15lu;
+}
+
+// Stable LSD radix sort of the indices by the bytes of their keys. Each chunk counts its digits in parallel,
+// and the chunks are scattered in parallel then, since their offsets are known.
+void radixSort(std::vector<int32_t>& order, const std::vector<uint32_t>& keys, size_t keyBytes, size_t chunksNum) {
+    constexpr size_t digitsNum = 256lu;
+    const size_t len = order.size();
+    std::vector<int32_t> sortedOrder(len);
+    std::vector<size_t> offsets(chunksNum * digitsNum);
+    for (size_t b = 0lu; b < keyBytes; b++) {
+        const size_t shift = 8lu * b;
+        std::fill(offsets.begin(), offsets.end(), 0lu);
+        parallel_for(chunksNum, [&](size_t c) {
+            size_t start = 0lu, end = 0lu;
+            splitter(len, chunksNum, c, start, end);
+            auto chunkOffsets = offsets.data() + c * digitsNum;
+            for (size_t i = start; i < end; i++) {
+                chunkOffsets[(keys[order[i]] >> shift) & 0xFFu]++;
+            }
+        });
+        size_t offset = 0lu;
+        for (size_t d = 0lu; d < digitsNum; d++) {
+            for (size_t c = 0lu; c < chunksNum; c++) {
+                const auto count = offsets[c * digitsNum + d];
+                offsets[c * digitsNum + d] = offset;
+                offset += count;
+            }
+        }
+        parallel_for(chunksNum, [&](size_t c) {
+            size_t start = 0lu, end = 0lu;
+            splitter(len, chunksNum, c, start, end);
+            auto chunkOffsets = offsets.data() + c * digitsNum;
+            for (size_t i = start; i < end; i++) {
+                sortedOrder[chunkOffsets[(keys[order[i]] >> shift) & 0xFFu]++] = order[i];
+            }
+        });
+        order.swap(sortedOrder);
+    }
+}
+}   // namespace
+
 bool Unique::isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept {
     try {
         if (!ov::is_type<op::v10::Unique>(op)) {
@@ -114,6 +182,10 @@ void Unique::prepareParams() {
     firstUniTmp.resize(srcLen, 0);
     inToOutTmp.resize(srcLen);
     occurTmp.resize(srcLen);
+    if (flattened) {
+        partIdxTmp.resize(srcLen);
+        firstMaskTmp.resize(srcLen);
+    }
 }
 
 template<typename T>
@@ -131,6 +203,7 @@ struct Unique::slicedExec {
 };
 
 void Unique::execute(dnnl::stream strm) {
+    threadsNum = parallel_get_max_threads();
     if (flattened) {
         OV_SWITCH(intel_cpu, flattenExec, this, dataPrecision,
               OV_CASE(Precision::FP32, float),
@@ -166,105 +239,170 @@ template <typename T>
 void Unique::flattenTensorExec() {
     const T* srcDataPtr = reinterpret_cast<const T*>(getParentEdgeAt(IN_DATA)->getMemoryPtr()->GetPtr());
     const size_t inputLen = getParentEdgeAt(IN_DATA)->getMemoryPtr()->GetSize() / sizeof(T);
-    std::vector<T> uniDataTmp(inputLen);
-    auto uniDataTmpPtr = uniDataTmp.data();
-    int *firstTmpPtr = nullptr, *inToOutTmpPtr = nullptr, *occurTmpPtr = nullptr;
-    if (definedOutputs[FIRST_UNIQUE_IDX]) {
-        firstTmpPtr = firstUniTmp.data();
-    }
-    if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-        inToOutTmpPtr = inToOutTmp.data();
-    }
-    if (definedOutputs[OCCURRENCES_NUM]) {
-        occurTmpPtr = occurTmp.data();
+    // All the temporary outputs are computed, since the unique data is gathered by the first indices
+    int32_t* firstTmpPtr = firstUniTmp.data();
+    int32_t* inToOutTmpPtr = inToOutTmp.data();
+    int32_t* occurTmpPtr = occurTmp.data();
+    int32_t* partIdxPtr = partIdxTmp.data();
+    int32_t* firstMaskPtr = firstMaskTmp.data();
+
+    // The input is split into chunks processed by the threads, and the elements are distributed between the partitions by hash,
+    // so each partition is deduplicated by its own open-addressing table independently from the others.
+    const size_t chunksNum = inputLen < PARALLEL_MIN_LEN ? 1lu : static_cast<size_t>(threadsNum);
+    size_t partBits = 0lu;
+    while (chunksNum > 1lu && (1lu << partBits) < 4lu * chunksNum) {
+        partBits++;
+    }
+    const size_t partsNum = 1lu << partBits;
+    auto getPartition = [partBits](uint64_t hash) {
+        return partBits == 0lu ? 0lu : static_cast<size_t>(hash >> (64lu - partBits));
+    };
+
+    // Partitioning is stable, so the elements of each partition keep the order of the input
+    std::vector<size_t> partOffsets(chunksNum * partsNum, 0lu);
+    parallel_for(chunksNum, [&](size_t c) {
+        size_t start = 0lu, end = 0lu;
+        splitter(inputLen, chunksNum, c, start, end);
+        auto chunkOffsets = partOffsets.data() + c * partsNum;
+        for (size_t i = start; i < end; i++) {
+            chunkOffsets[getPartition(hashKey(uniqueKey(srcDataPtr[i])))]++;
+        }
+        std::fill(firstMaskPtr + start, firstMaskPtr + end, 0);
+    });
+    std::vector<size_t> partBegin(partsNum + 1lu);
+    size_t offset = 0lu;
+    for (size_t p = 0lu; p < partsNum; p++) {
+        partBegin[p] = offset;
+        for (size_t c = 0lu; c < chunksNum; c++) {
+            const auto count = partOffsets[c * partsNum + p];
+            partOffsets[c * partsNum + p] = offset;
+            offset += count;
+        }
     }
-    uniqueLen = inputLen;
-
-    if (sorted) {
-        std::memcpy(uniDataTmpPtr, srcDataPtr, inputLen * sizeof(T));
-        std::sort(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        auto last = std::unique(uniDataTmpPtr, uniDataTmpPtr + inputLen);
-        uniqueLen = last - uniDataTmpPtr;
-
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            T* first = uniDataTmpPtr;
-            for (T* it = first; it < last; it++) {
-                for (int i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == *it) {
-                        *firstTmpPtr++ = i;
-                        first++;
-                        break;
-                    }
-                }
-            }
+    partBegin[partsNum] = offset;
+    parallel_for(chunksNum, [&](size_t c) {
+        size_t start = 0lu, end = 0lu;
+        splitter(inputLen, chunksNum, c, start, end);
+        auto chunkOffsets = partOffsets.data() + c * partsNum;
+        for (size_t i = start; i < end; i++) {
+            partIdxPtr[chunkOffsets[getPartition(hashKey(uniqueKey(srcDataPtr[i])))]++] = static_cast<int32_t>(i);
         }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            for (int i = 0; i < inputLen; i++) {
-                if (i > 0 && srcDataPtr[i] == srcDataPtr[i - 1]) {
-                    inToOutTmpPtr[i] = inToOutTmpPtr[i - 1];
-                    continue;
-                }
-                for (int j = 0; j < uniqueLen; j++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        inToOutTmpPtr[i] = j;
-                        break;
-                    }
-                }
-            }
+    });
+
+    // The local indices of the unique values are stored to inToOutTmp, and the first occurrences are marked in firstMaskTmp
+    std::vector<std::vector<int32_t>> partFirst(partsNum);
+    std::vector<std::vector<int32_t>> partCount(partsNum);
+    parallel_for(partsNum, [&](size_t p) {
+        const auto begin = partBegin[p], end = partBegin[p + 1lu];
+        size_t capacity = 1lu;
+        while (capacity < 2lu * (end - begin)) {
+            capacity <<= 1lu;
         }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + uniqueLen, 0);
-            for (int j = 0; j < uniqueLen; j++) {
-                for (int i = 0; i < inputLen; i++) {
-                    if (srcDataPtr[i] == uniDataTmpPtr[j]) {
-                        occurTmpPtr[j]++;
-                    }
-                }
+        const size_t mask = capacity - 1lu;
+        std::vector<int32_t> table(capacity, -1);
+        auto& firsts = partFirst[p];
+        auto& counts = partCount[p];
+        for (size_t k = begin; k < end; k++) {
+            const auto i = partIdxPtr[k];
+            const T val = srcDataPtr[i];
+            const auto hash = hashKey(uniqueKey(val));
+            size_t slot = static_cast<size_t>(hash ^ (hash >> 32lu)) & mask;
+            // Values are compared as is, so every NaN is unique as in the reference implementation
+            while (table[slot] != -1 && srcDataPtr[firsts[table[slot]]] != val) {
+                slot = (slot + 1lu) & mask;
             }
+            if (table[slot] == -1) {
+                table[slot] = static_cast<int32_t>(firsts.size());
+                firsts.push_back(i);
+                counts.push_back(0);
+                firstMaskPtr[i] = 1;
+            }
+            counts[table[slot]]++;
+            inToOutTmpPtr[i] = table[slot];
         }
-    } else {
-        uniDataTmpPtr[0] = srcDataPtr[0];
-        if (definedOutputs[FIRST_UNIQUE_IDX]) {
-            firstTmpPtr[0] = 0;
+    });
+
+    // Unique values keep the order of the first occurrences, so the index of the unique value is the number of the first
+    // occurrences before it, i.e. the exclusive prefix sum of the mask
+    std::vector<int32_t> chunkUniques(chunksNum, 0);
+    parallel_for(chunksNum, [&](size_t c) {
+        size_t start = 0lu, end = 0lu;
+        splitter(inputLen, chunksNum, c, start, end);
+        chunkUniques[c] = std::accumulate(firstMaskPtr + start, firstMaskPtr + end, 0);
+    });
+    int32_t uniquesBefore = 0;
+    for (size_t c = 0lu; c < chunksNum; c++) {
+        const auto count = chunkUniques[c];
+        chunkUniques[c] = uniquesBefore;
+        uniquesBefore += count;
+    }
+    uniqueLen = static_cast<size_t>(uniquesBefore);
+    parallel_for(chunksNum, [&](size_t c) {
+        size_t start = 0lu, end = 0lu;
+        splitter(inputLen, chunksNum, c, start, end);
+        int32_t idx = chunkUniques[c];
+        for (size_t i = start; i < end; i++) {
+            const auto isFirst = firstMaskPtr[i];
+            firstMaskPtr[i] = idx;
+            idx += isFirst;
         }
-        if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-            inToOutTmpPtr[0] = 0;
+    });
+    parallel_for(partsNum, [&](size_t p) {
+        auto& firsts = partFirst[p];
+        const auto& counts = partCount[p];
+        for (size_t u = 0lu; u < firsts.size(); u++) {
+            const auto idx = firstMaskPtr[firsts[u]];
+            firstTmpPtr[idx] = firsts[u];
+            occurTmpPtr[idx] = counts[u];
+            // firsts are not needed anymore, so they are replaced by the global indices of the unique values
+            firsts[u] = idx;
         }
-        if (definedOutputs[OCCURRENCES_NUM]) {
-            std::fill(occurTmpPtr, occurTmpPtr + inputLen, 1);
+        for (size_t k = partBegin[p]; k < partBegin[p + 1lu]; k++) {
+            const auto i = partIdxPtr[k];
+            inToOutTmpPtr[i] = firsts[inToOutTmpPtr[i]];
         }
-        uniqueLen = 1;
-
-        for (int i = 1; i < inputLen; i++) {
-            bool found = false;
-            int j = 0;
-            for (; j < uniqueLen; j++) {
-                if (uniDataTmpPtr[j] == srcDataPtr[i]) {
-                    found = true;
-                    break;
-                }
-            }
-            if (!found) {
-                uniDataTmpPtr[uniqueLen] = srcDataPtr[i];
-                if (definedOutputs[FIRST_UNIQUE_IDX]) {
-                    firstTmpPtr[uniqueLen] = i;
-                }
-                uniqueLen++;
-            } else {
-                if (definedOutputs[OCCURRENCES_NUM]) {
-                    occurTmpPtr[j]++;
-                }
-            }
-            if (definedOutputs[INPUT_TO_UNIQ_IDX]) {
-                inToOutTmpPtr[i] = j;
-            }
+    });
+
+    if (sorted) {
+        // Only the unique values are sorted, and the indices are permuted then
+        std::vector<int32_t> order(uniqueLen);
+        std::iota(order.begin(), order.end(), 0);
+        if (std::is_same<T, float>::value) {
+            parallel_sort(order.begin(), order.end(), [&](int32_t u1, int32_t u2) {
+                return srcDataPtr[firstTmpPtr[u1]] < srcDataPtr[firstTmpPtr[u2]];
+            });
+        } else {
+            std::vector<uint32_t> keys(uniqueLen);
+            parallel_for(uniqueLen, [&](size_t u) {
+                keys[u] = uniqueKey(srcDataPtr[firstTmpPtr[u]]);
+            });
+            radixSort(order, keys, sizeof(T), uniqueLen < PARALLEL_MIN_LEN ? 1lu : static_cast<size_t>(threadsNum));
         }
+
+        std::vector<int32_t> rank(uniqueLen), sortedFirst(uniqueLen), sortedOccur(uniqueLen);
+        parallel_for(uniqueLen, [&](size_t k) {
+            const auto u = order[k];
+            rank[u] = static_cast<int32_t>(k);
+            sortedFirst[k] = firstTmpPtr[u];
+            sortedOccur[k] = occurTmpPtr[u];
+        });
+        std::copy(sortedFirst.begin(), sortedFirst.end(), firstTmpPtr);
+        std::copy(sortedOccur.begin(), sortedOccur.end(), occurTmpPtr);
+        parallel_for(chunksNum, [&](size_t c) {
+            size_t start = 0lu, end = 0lu;
+            splitter(inputLen, chunksNum, c, start, end);
+            for (size_t i = start; i < end; i++) {
+                inToOutTmpPtr[i] = rank[inToOutTmpPtr[i]];
+            }
+        });
     }
 
     redefineOutputMemory({ {uniqueLen}, {uniqueLen}, {inputLen}, {uniqueLen}});
 
     T* uniDataPtr = reinterpret_cast<T*>(getChildEdgesAtPort(UNIQUE_DATA)[0]->getMemoryPtr()->GetPtr());
-    memcpy(uniDataPtr, uniDataTmpPtr, uniqueLen * sizeof(T));
+    parallel_for(uniqueLen, [&](size_t u) {
+        uniDataPtr[u] = srcDataPtr[firstTmpPtr[u]];
+    });
     if (definedOutputs[FIRST_UNIQUE_IDX]) {
         int *firstPtr = reinterpret_cast<int*>(getChildEdgesAtPort(FIRST_UNIQUE_IDX)[0]->getMemoryPtr()->GetPtr());
         memcpy(firstPtr, firstUniTmp.data(), uniqueLen * sizeof(int));
@@ -44,6 +44,9 @@ private:
     std::vector<int32_t> firstUniTmp;
     std::vector<int32_t> inToOutTmp;
     std::vector<int32_t> occurTmp;
+    // Flattened input only: element indices grouped by the hash partitions and the marks of the first occurrences
+    std::vector<int32_t> partIdxTmp;
+    std::vector<int32_t> firstMaskTmp;
 
     bool sorted    = false;
     bool flattened = true;
@@ -55,6 +58,9 @@ private:
 
     int threadsNum = 1;
 
+    // Smaller inputs are processed by one thread
+    static constexpr size_t PARALLEL_MIN_LEN = 1lu << 15;
+
     static constexpr size_t IN_DATA = 0;
     static constexpr size_t AXIS    = 1;
     static constexpr size_t UNIQUE_DATA       = 0;
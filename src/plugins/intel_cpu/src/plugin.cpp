@@ -9,6 +9,9 @@
 #include "extension.h"
 #include "itt.h"
 #include "serialize.h"
+#include "cache/shapes_store.h"
+#include "utils/memory_usage.h"
+#include "openvino/runtime/intel_cpu/properties.hpp"
 
 #include <threading/ie_executor_manager.hpp>
 #include <memory>
@@ -93,6 +96,7 @@
 #include "ngraph_transformations/snippets_mark_skipped.hpp"
 #include "ngraph_transformations/mha_fusion.hpp"
 #include "ngraph_transformations/convert_to_interaction.hpp"
+#include "ngraph_transformations/convert_to_masked_select.hpp"
 #include "ngraph_transformations/convert_fq_rnn_to_quantized_rnn.hpp"
 #include "ngraph_transformations/move_eltwise_up_data_movement.hpp"
 #include "ngraph_transformations/swap_convert_transpose.hpp"
@@ -100,6 +104,7 @@
 #include <snippets/pass/collapse_subgraph.hpp>
 #include <snippets/pass/common_optimizations.hpp>
 #include <snippets/pass/convert_constants.hpp>
+#include <snippets/utils.hpp>
 
 #include <ngraph/opsets/opset1.hpp>
 #include <ngraph/opsets/opset2.hpp>
@@ -286,7 +291,8 @@ static bool fuse_type_to_convert(const std::shared_ptr<ngraph::Node>& node, ov::
 }
 
 static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function> nGraphFunc, const bool _enableLPT, const bool _enableBF16,
-                                               const bool _enableSnippets, const bool isLegacyApi) {
+                                               const bool _enableSnippets, const bool _enableSnippetsReductions,
+                                               const bool _enableSnippetsDynamicShapes, const bool isLegacyApi) {
     ov::pass::Manager manager;
     manager.set_per_pass_validation(false);
     manager.register_pass<ov::pass::InitNodeInfo>();
@@ -360,6 +366,7 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     manager.register_pass<SwapConvertTranspose>();
     manager.register_pass<ConvertToInteraction>();
     manager.register_pass<ConvertInteractionInt8>();
+    manager.register_pass<ConvertToMaskedSelect>();
 
     auto pass_config = manager.get_pass_config();
 
@@ -669,7 +676,11 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
         snippetsManager.register_pass<ngraph::snippets::pass::EnumerateNodes>();
         snippetsManager.register_pass<ngraph::snippets::pass::TokenizeSnippets>();
         snippetsManager.get_pass_config()->set_callback<ngraph::snippets::pass::TokenizeSnippets>(
-                [](const std::shared_ptr<const ov::Node>& n) -> bool {
+                [_enableSnippetsReductions, _enableSnippetsDynamicShapes](const std::shared_ptr<const ov::Node>& n) -> bool {
+                    if (!_enableSnippetsReductions && ngraph::snippets::utils::is_reduction(n))
+                        return true;
+                    if (!_enableSnippetsDynamicShapes && n->is_dynamic())
+                        return true;
                     // CPU Plugin support Swish in Subgraph via conversion to SwichCPU which assumes second input to be constant
                     if (ov::is_type<const ov::op::v4::Swish>(n)) {
                         if (n->inputs().size() > 1 && !ov::is_type<const ov::op::v0::Constant>(n->get_input_node_shared_ptr(1)))
@@ -684,7 +695,7 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
                                       });
                     // todo: clarify whether we can evaluate snippets on inputs with larger ranks
                     auto rank_is_too_large = [](const ov::descriptor::Tensor& t ) {
-                        // callback is called has_supported_in_out(), so it's safe to assume that the shapes are static
+                        // callback is called has_supported_in_out(), so it's safe to assume that the ranks are static
                         return t.get_partial_shape().rank().get_length() > 6;
                     };
                     const bool bad_input_rank = std::any_of(inputs.begin(), inputs.end(),
@@ -692,7 +703,11 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
                     const auto& outputs = n->outputs();
                     const bool bad_output_rank = std::any_of(outputs.begin(), outputs.end(),
                                                              [&](const ov::Output<const ov::Node>& out) {return  rank_is_too_large(out.get_tensor());});
-                    return has_only_const_inputs || bad_input_rank || bad_output_rank;
+                    // Reductions are executed in several sweeps over the row, so the row has to stay in L1 cache between them
+                    const bool too_large_row = ngraph::snippets::utils::is_reduction(n) &&
+                            n->get_input_shape(0).back() * n->get_input_element_type(0).size() >
+                                static_cast<size_t>(dnnl::utils::get_cache_size(1, true));
+                    return has_only_const_inputs || bad_input_rank || bad_output_rank || too_large_row;
                 });
         snippetsManager.register_pass<ngraph::snippets::pass::CommonOptimizations>();
         snippetsManager.run_passes(nGraphFunc);
@@ -708,6 +723,42 @@ static void TransformationUpToCPUSpecificOpSet(std::shared_ptr<ngraph::Function>
     postSnippetsManager.run_passes(nGraphFunc);
 }
 
+// Narrows the dynamic input dimensions down to the declared upper bounds, so the bounds are propagated through the
+// model and the memory of the bounded tensors is planned statically
+static void ApplyShapeUpperBounds(const std::shared_ptr<ngraph::Function>& nGraphFunc, const std::string& upperBounds) {
+    const auto boundsSets = InputShapesStore::parse(upperBounds);
+    if (boundsSets.empty())
+        return;
+    const auto& bounds = boundsSets.front();
+
+    const auto& parameters = nGraphFunc->get_parameters();
+    for (const auto& parameter : parameters) {
+        auto itr = bounds.find(ngraph::op::util::get_ie_output_name(parameter->output(0)));
+        if (itr == bounds.end() && parameters.size() == 1)
+            itr = bounds.find("");
+        if (itr == bounds.end())
+            continue;
+
+        const auto& shape = parameter->get_partial_shape();
+        const auto& upperDims = itr->second;
+        if (shape.rank().is_static() && static_cast<size_t>(shape.rank().get_length()) != upperDims.size())
+            IE_THROW() << "The upper bound shape of the input " << itr->first << " doesn't match its rank: " << shape;
+
+        ov::PartialShape boundedShape;
+        for (size_t i = 0; i < upperDims.size(); i++) {
+            const auto dim = shape.rank().is_static() ? shape[i] : ov::Dimension::dynamic();
+            const auto upper = static_cast<int64_t>(upperDims[i]);
+            if (dim.is_static() ? dim.get_length() != upper : dim.get_min_length() > upper)
+                IE_THROW() << "The upper bound shape of the input " << itr->first << " doesn't match its shape: " << shape;
+            const auto maxLength = dim.get_max_length();
+            boundedShape.push_back(ov::Dimension(dim.get_min_length(), maxLength < 0 ? upper : std::min(maxLength, upper)));
+        }
+        // only the compiled model copy is narrowed, the model inputs are reported with the declared shapes
+        parameter->set_partial_shape(boundedShape);
+    }
+    nGraphFunc->validate_nodes_and_infer_types();
+}
+
 static bool streamsSet(const std::map<std::string, std::string>& config) {
     return config.count(PluginConfigParams::KEY_CPU_THROUGHPUT_STREAMS) ||
            config.count(ov::num_streams.name());
@@ -853,6 +904,8 @@ InferenceEngine::IExecutableNetworkInternal::Ptr
 Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std::map<std::string, std::string> &orig_config) {
     OV_ITT_SCOPED_TASK(itt::domains::intel_cpu, "Engine::LoadExeNetworkImpl");
     CREATE_DEBUG_TIMER(debugLoadTimer);
+    // started before the transformations, which are the most memory consuming part of the compilation
+    PeakMemoryMeter compileMemoryMeter;
 
     // verification of supported input
     for (const auto &ii : network.getInputsInfo()) {
@@ -901,7 +954,17 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
 
     DEBUG_LOG(PrintableModel(*nGraphFunc, "org_"));
 
-    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableBF16, enableSnippets, isLegacyAPI());
+    const auto& upperBoundsProp = config.find(ov::intel_cpu::shape_upper_bounds.name());
+    ApplyShapeUpperBounds(nGraphFunc, upperBoundsProp != config.end() ? upperBoundsProp->second : engConfig.shapeUpperBounds);
+
+    const auto& snippetsReductionsProp = config.find(ov::intel_cpu::snippets_reductions.name());
+    const bool enableSnippetsReductions = snippetsReductionsProp != config.end() ? snippetsReductionsProp->second == PluginConfigParams::YES
+                                                                               : engConfig.snippetsReductions;
+    const auto& snippetsDynamicShapesProp = config.find(ov::intel_cpu::snippets_dynamic_shapes.name());
+    const bool enableSnippetsDynamicShapes = snippetsDynamicShapesProp != config.end() ? snippetsDynamicShapesProp->second == PluginConfigParams::YES
+                                                                                       : engConfig.snippetsDynamicShapes;
+    TransformationUpToCPUSpecificOpSet(nGraphFunc, enableLPT, enableBF16, enableSnippets, enableSnippetsReductions,
+                                       enableSnippetsDynamicShapes, isLegacyAPI());
 
     // need to check that all outputs have static shapes
     // checking that all inputs have static shapes is performed in the common part
@@ -940,7 +1003,9 @@ Engine::LoadExeNetworkImpl(const InferenceEngine::CNNNetwork &network, const std
         }
     }
 
-    return std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this());
+    auto execNetwork = std::make_shared<ExecNetwork>(clonedNetwork, conf, extensionManager, shared_from_this());
+    execNetwork->setCompilePeakMemory(compileMemoryMeter.peakIncrease());
+    return execNetwork;
 }
 
 void Engine::SetConfig(const std::map<std::string, std::string> &config) {
@@ -1154,7 +1219,8 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
 
     auto supported = GetSupportedNodes(model,
     [&](std::shared_ptr<ov::Model>& model) {
-            TransformationUpToCPUSpecificOpSet(model, enableLPT, conf.enforceBF16, enableSnippets, isLegacyAPI());
+            TransformationUpToCPUSpecificOpSet(model, enableLPT, conf.enforceBF16, enableSnippets, conf.snippetsReductions,
+                                               conf.snippetsDynamicShapes, isLegacyAPI());
             ConvertToCPUSpecificOpset(model);
         },
     [&](const std::shared_ptr<ngraph::Node>& op) {
@@ -1174,9 +1240,55 @@ QueryNetworkResult Engine::QueryNetwork(const CNNNetwork& network, const std::ma
     return res;
 }
 
+// the compiled model may be narrowed by the shape upper bounds, so its inputs and outputs are reported with the shapes
+// declared by the original model
+static void RestoreDeclaredShapes(const std::shared_ptr<ExecNetwork>& execNetwork,
+                                  const std::map<std::string, ov::PartialShape>& shapes) {
+    if (shapes.empty())
+        return;
+
+    std::vector<std::shared_ptr<const ov::Node>> inputs;
+    for (const auto& input : execNetwork->getInputs()) {
+        const auto shape = shapes.find(ngraph::op::util::get_ie_output_name(input->output(0)));
+        if (shape == shapes.end() || shape->second == input->get_output_partial_shape(0)) {
+            inputs.push_back(input);
+            continue;
+        }
+        auto param = std::make_shared<ov::op::v0::Parameter>(input->get_output_element_type(0), shape->second);
+        param->set_friendly_name(input->get_friendly_name());
+        param->output(0).get_tensor().set_names(input->output(0).get_names());
+        param->output(0).get_rt_info() = input->output(0).get_rt_info();
+        param->validate_and_infer_types();
+        inputs.push_back(param);
+    }
+
+    std::vector<std::shared_ptr<const ov::Node>> outputs;
+    for (const auto& output : execNetwork->getOutputs()) {
+        const auto source = output->input_value(0);
+        const auto shape = shapes.find(ngraph::op::util::create_ie_output_name(source));
+        if (shape == shapes.end() || shape->second == output->get_input_partial_shape(0)) {
+            outputs.push_back(output);
+            continue;
+        }
+        auto fakeParam = std::make_shared<ov::op::v0::Parameter>(source.get_element_type(), shape->second);
+        fakeParam->set_friendly_name(source.get_node()->get_friendly_name());
+        fakeParam->output(0).get_tensor().set_names(source.get_names());
+        fakeParam->validate_and_infer_types();
+        auto result = output->copy_with_new_inputs({fakeParam});
+        result->set_friendly_name(output->get_friendly_name());
+        result->output(0).get_tensor().set_names(output->output(0).get_names());
+        result->output(0).get_rt_info() = output->output(0).get_rt_info();
+        outputs.push_back(result);
+    }
+
+    execNetwork->setInputs(inputs);
+    execNetwork->setOutputs(outputs);
+}
+
 InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istream& networkModel,
                                             const std::map<std::string, std::string>& config) {
     OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::intel_cpu_LT, "ImportNetwork");
+    PeakMemoryMeter compileMemoryMeter;
 
     CNNNetworkDeserializer deserializer(networkModel,
         [this](const std::string& model, const Blob::CPtr& weights) {
@@ -1210,10 +1322,12 @@ InferenceEngine::IExecutableNetworkInternal::Ptr Engine::ImportNetwork(std::istr
     }
 
     auto execNetwork = std::make_shared<ExecNetwork>(cnnnetwork, conf, extensionManager, shared_from_this());
+    execNetwork->setCompilePeakMemory(compileMemoryMeter.peakIncrease());
 
     execNetwork->setNetworkInputs(cnnnetwork.getInputsInfo());
     execNetwork->setNetworkOutputs(cnnnetwork.getOutputsInfo());
     SetExeNetworkInfo(execNetwork, cnnnetwork.getFunction());
+    RestoreDeclaredShapes(execNetwork, deserializer.getDeclaredShapes());
 
     return execNetwork;
 }
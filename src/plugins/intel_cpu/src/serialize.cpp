@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 #include "serialize.h"
+#include "utils/rt_info/exported_primitive_attribute.hpp"
+#include "utils/debug_capabilities.h"
 
 #include <openvino/pass/serialize.hpp>
 
@@ -61,9 +63,13 @@ namespace {
     }
 };  // namespace
 
-CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager)
+CNNNetworkSerializer::CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager,
+                                           std::map<std::string, std::string> primitives,
+                                           std::map<std::string, std::string> shapes)
     : _ostream(ostream)
-    , _extensionManager(extensionManager) {
+    , _extensionManager(extensionManager)
+    , _primitives(std::move(primitives))
+    , _shapes(std::move(shapes)) {
 }
 
 void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
@@ -97,6 +103,9 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
                     .set_value(in.second->getPrecision().name());
             in_node.append_attribute("layout")
                     .set_value(to_string(in.second->getLayout()).c_str());
+            auto shape = _shapes.find(in.first);
+            if (shape != _shapes.end())
+                in_node.append_attribute("shape").set_value(shape->second.c_str());
         }
 
         for (const auto & out : network.getOutputsInfo()) {
@@ -107,6 +116,31 @@ void CNNNetworkSerializer::operator << (const CNNNetwork & network) {
                     .set_value(out.second->getPrecision().name());
             out_node.append_attribute("layout")
                     .set_value(to_string(out.second->getLayout()).c_str());
+            auto shape = _shapes.find(out.first);
+            if (shape != _shapes.end())
+                out_node.append_attribute("shape").set_value(shape->second.c_str());
+        }
+
+        // The compiled graph nodes which are not the operations of the model (e.g. reorders) are created on the import anyway
+        // The descriptors are restored by the friendly names, so the names shared by several operations are skipped
+        std::unordered_map<std::string, size_t> namesCount;
+        for (const auto & op : network.getFunction()->get_ops())
+            namesCount[op->get_friendly_name()]++;
+
+        pugi::xml_node primitives = root.append_child("primitives");
+        for (auto primitive = _primitives.begin(); primitive != _primitives.end(); primitive++) {
+            const auto count = namesCount.find(primitive->first);
+            if (count == namesCount.end() || count->second != 1) {
+                DEBUG_LOG("The primitive descriptor of the node ", primitive->first, " isn't exported: ",
+                          count == namesCount.end() ? "there is no operation with this name" : "the name isn't unique");
+                continue;
+            }
+
+            auto primitive_node = primitives.append_child("primitive");
+            primitive_node.append_attribute("name")
+                    .set_value(primitive->first.c_str());
+            primitive_node.append_attribute("desc")
+                    .set_value(primitive->second.c_str());
         }
 
         xml_doc.save(stream);
@@ -166,6 +200,27 @@ void CNNNetworkDeserializer::operator >> (InferenceEngine::CNNNetwork & network)
 
     setInfo(inputs.children("in"), network.getInputsInfo());
     setInfo(outputs.children("out"), network.getOutputsInfo());
+
+    for (const auto& node : {inputs.children("in"), outputs.children("out")}) {
+        for (const auto& info : node) {
+            auto shape = info.attribute("shape");
+            if (shape)
+                _shapes.emplace(info.attribute("name").value(), ov::PartialShape(shape.value()));
+        }
+    }
+
+    // Restore the primitive descriptors selected on the export, the blobs of the older versions don't contain them
+    std::unordered_map<std::string, std::string> primitives;
+    for (const auto & primitive : root.child("primitives").children("primitive")) {
+        primitives.emplace(primitive.attribute("name").value(), primitive.attribute("desc").value());
+    }
+    if (!primitives.empty()) {
+        for (const auto & op : network.getFunction()->get_ops()) {
+            auto primitive = primitives.find(op->get_friendly_name());
+            if (primitive != primitives.end())
+                op->get_rt_info()[ExportedPrimitiveAttr] = primitive->second;
+        }
+    }
 }
 
 }   // namespace intel_cpu
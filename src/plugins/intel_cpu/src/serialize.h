@@ -6,19 +6,29 @@
 
 #include <iostream>
 #include <functional>
+#include <map>
 #include <cpp/ie_cnn_network.h>
+#include <openvino/core/partial_shape.hpp>
 
 namespace ov {
 namespace intel_cpu {
 
 class CNNNetworkSerializer {
 public:
-    CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager);
+    /**
+     * @param primitives the descriptions of the primitive descriptors selected for the compiled graph nodes by the node names
+     * @param shapes the shapes of the inputs and outputs declared by the original model by their names
+     */
+    CNNNetworkSerializer(std::ostream & ostream, ExtensionManager::Ptr extensionManager,
+                         std::map<std::string, std::string> primitives = {},
+                         std::map<std::string, std::string> shapes = {});
     void operator << (const InferenceEngine::CNNNetwork & network);
 
 private:
     std::ostream & _ostream;
     ExtensionManager::Ptr _extensionManager;
+    std::map<std::string, std::string> _primitives;
+    std::map<std::string, std::string> _shapes;
 };
 
 class CNNNetworkDeserializer {
@@ -30,9 +40,18 @@ public:
     CNNNetworkDeserializer(std::istream & istream, cnn_network_builder fn);
     void operator >> (InferenceEngine::CNNNetwork & network);
 
+    /**
+     * @brief The shapes of the inputs and outputs declared by the original model by their names, empty for the blobs
+     * of the older versions
+     */
+    const std::map<std::string, ov::PartialShape>& getDeclaredShapes() const {
+        return _shapes;
+    }
+
 private:
     std::istream & _istream;
     cnn_network_builder _cnn_network_builder;
+    std::map<std::string, ov::PartialShape> _shapes;
 };
 
 // const std::string& model, const Blob::CPtr& weights
@@ -0,0 +1,125 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "memory_usage.h"
+
+#include <algorithm>
+#include <chrono>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+# define NOMINMAX
+#endif
+#include <windows.h>
+#include <psapi.h>
+#elif defined(__linux__)
+#include <fstream>
+#include <sstream>
+#include <string>
+#else
+#include <sys/resource.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+#if defined(__linux__)
+namespace {
+
+// reads the value of the "<key>: <value> kB" line of /proc/self/status
+uint64_t readProcStatus(const std::string& key) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.compare(0, key.size(), key) == 0) {
+            std::istringstream value(line.substr(key.size()));
+            uint64_t kb = 0;
+            value >> kb;
+            return kb * 1024;
+        }
+    }
+    return 0;
+}
+
+}   // namespace
+#endif
+
+uint64_t getPeakResidentSetSize() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return counters.PeakWorkingSetSize;
+#elif defined(__linux__)
+    return readProcStatus("VmHWM:");
+#else
+    // ru_maxrss is reported in bytes on macOS
+    struct rusage usage = {};
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+    return static_cast<uint64_t>(usage.ru_maxrss);
+#endif
+}
+
+uint64_t getResidentSetSize() {
+#if defined(_WIN32)
+    PROCESS_MEMORY_COUNTERS counters;
+    if (!K32GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+        return 0;
+    return counters.WorkingSetSize;
+#elif defined(__linux__)
+    return readProcStatus("VmRSS:");
+#else
+    return 0;
+#endif
+}
+
+PeakMemoryMeter::PeakMemoryMeter() {
+    m_startRss = getResidentSetSize();
+    m_startPeak = getPeakResidentSetSize();
+    m_sampledPeak = m_startRss;
+    // the process high-water mark is not reset, so the peaks below the earlier process peak are caught by sampling
+    if (m_startRss != 0)
+        m_sampler = std::thread(&PeakMemoryMeter::sample, this);
+}
+
+PeakMemoryMeter::~PeakMemoryMeter() {
+    stop();
+}
+
+void PeakMemoryMeter::sample() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stopped) {
+        lock.unlock();
+        const auto rss = getResidentSetSize();
+        lock.lock();
+        m_sampledPeak = std::max(m_sampledPeak, rss);
+        m_stopCondition.wait_for(lock, std::chrono::milliseconds(5), [this] { return m_stopped; });
+    }
+}
+
+void PeakMemoryMeter::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopped = true;
+    }
+    m_stopCondition.notify_all();
+    if (m_sampler.joinable())
+        m_sampler.join();
+}
+
+uint64_t PeakMemoryMeter::peakIncrease() {
+    stop();
+    const auto rss = getResidentSetSize();
+    auto peak = std::max(m_sampledPeak, rss);
+    // the high-water mark exceeding the earlier process peak is reached during the measurement and is exact
+    const auto processPeak = getPeakResidentSetSize();
+    if (processPeak > m_startPeak)
+        peak = std::max(peak, processPeak);
+    const auto base = m_startRss != 0 ? m_startRss : m_startPeak;
+    return peak > base ? peak - base : 0;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,61 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Returns the peak resident set size of the current process in bytes, or 0 if the OS does not provide it.
+ * The value is the high-water mark since the process start.
+ */
+uint64_t getPeakResidentSetSize();
+
+/**
+ * @brief Returns the current resident set size of the current process in bytes, or 0 if the OS does not provide it.
+ */
+uint64_t getResidentSetSize();
+
+/**
+ * @brief Measures how much the resident set size grows at its peak over the object lifetime.
+ * The resident set size is sampled by a background thread, and the process high-water mark is used when it exceeds
+ * the one at the construction, so the short peaks between the samples are not lost in that case. The process state
+ * is never changed. The resident set size is process wide, so the memory allocated concurrently by the other threads
+ * is counted as well.
+ */
+class PeakMemoryMeter {
+public:
+    PeakMemoryMeter();
+    ~PeakMemoryMeter();
+
+    PeakMemoryMeter(const PeakMemoryMeter&) = delete;
+    PeakMemoryMeter& operator=(const PeakMemoryMeter&) = delete;
+
+    /**
+     * @brief Stops the measurement and returns the peak resident set size since the construction minus the resident
+     * set size at the construction.
+     */
+    uint64_t peakIncrease();
+
+private:
+    void sample();
+    void stop();
+
+    uint64_t m_startRss = 0;
+    uint64_t m_startPeak = 0;
+    uint64_t m_sampledPeak = 0;
+    bool m_stopped = false;
+    std::mutex m_mutex;
+    std::condition_variable m_stopCondition;
+    std::thread m_sampler;
+};
+
+}   // namespace intel_cpu
+}   // namespace ov
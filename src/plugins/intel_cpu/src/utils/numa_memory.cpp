@@ -0,0 +1,123 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "numa_memory.h"
+
+#include <algorithm>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace ov {
+namespace intel_cpu {
+
+#if defined(__linux__) && defined(SYS_mbind) && defined(SYS_move_pages)
+namespace {
+// the values from <numaif.h>, the syscalls are used directly to avoid the dependency on libnuma
+constexpr int mpolBind = 2;
+constexpr int mpolInterleave = 3;
+
+bool pageAlignedRange(const void* ptr, size_t size, uintptr_t& begin, uintptr_t& end, size_t& pageSize) {
+    pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    begin = (reinterpret_cast<uintptr_t>(ptr) + pageSize - 1) / pageSize * pageSize;
+    end = (reinterpret_cast<uintptr_t>(ptr) + size) / pageSize * pageSize;
+    return begin < end;
+}
+}   // namespace
+
+void* allocateOnNumaNodes(size_t size, const std::vector<int>& numaNodeIds) {
+    if (numaNodeIds.empty() || size == 0)
+        return nullptr;
+
+    constexpr size_t bitsPerWord = sizeof(unsigned long) * 8;
+    std::vector<unsigned long> nodeMask;
+    for (auto id : numaNodeIds) {
+        if (id < 0)
+            return nullptr;
+        const auto word = static_cast<size_t>(id) / bitsPerWord;
+        if (nodeMask.size() <= word)
+            nodeMask.resize(word + 1, 0);
+        nodeMask[word] |= 1ul << (static_cast<size_t>(id) % bitsPerWord);
+    }
+
+    void* ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (ptr == MAP_FAILED)
+        return nullptr;
+
+    const int mode = numaNodeIds.size() == 1 ? mpolBind : mpolInterleave;
+    // the pages are not touched yet, so the policy applies to all of them on the first touch without migration.
+    // maxnode is the number of the mask bits plus one, as the kernel expects
+    if (syscall(SYS_mbind, ptr, size, mode, nodeMask.data(), nodeMask.size() * bitsPerWord + 1, 0) != 0) {
+        munmap(ptr, size);
+        return nullptr;
+    }
+    return ptr;
+}
+
+void freeNumaMemory(void* ptr, size_t size) {
+    if (ptr)
+        munmap(ptr, size);
+}
+
+bool countNumaResidentMemory(const void* ptr, size_t size, std::map<int, uint64_t>& bytesPerNode) {
+    uintptr_t begin, end;
+    size_t pageSize;
+    if (!pageAlignedRange(ptr, size, begin, end, pageSize))
+        return true;
+
+    // the query is done in chunks to limit the temporary buffers
+    constexpr size_t chunkPages = 4096;
+    std::vector<void*> pages;
+    std::vector<int> status;
+    for (uintptr_t chunk = begin; chunk < end; chunk += chunkPages * pageSize) {
+        const size_t count = std::min(chunkPages, static_cast<size_t>((end - chunk) / pageSize));
+        pages.resize(count);
+        status.resize(count);
+        for (size_t i = 0; i < count; i++) {
+            pages[i] = reinterpret_cast<void*>(chunk + i * pageSize);
+        }
+        // without the target nodes move_pages only reports the node of each page
+        if (syscall(SYS_move_pages, 0, count, pages.data(), nullptr, status.data(), 0) != 0)
+            return false;
+        for (auto node : status) {
+            // the negative status is an error code, e.g. the page has not been touched yet
+            if (node >= 0)
+                bytesPerNode[node] += pageSize;
+        }
+    }
+    return true;
+}
+#else
+void* allocateOnNumaNodes(size_t size, const std::vector<int>& numaNodeIds) {
+    return nullptr;
+}
+
+void freeNumaMemory(void* ptr, size_t size) {}
+
+bool countNumaResidentMemory(const void* ptr, size_t size, std::map<int, uint64_t>& bytesPerNode) {
+    return false;
+}
+#endif
+
+namespace {
+thread_local const std::vector<int>* currentNumaNodeIds = nullptr;
+}   // namespace
+
+NumaAllocationScope::NumaAllocationScope(const std::vector<int>& numaNodeIds) : m_previous(currentNumaNodeIds) {
+    currentNumaNodeIds = numaNodeIds.empty() ? nullptr : &numaNodeIds;
+}
+
+NumaAllocationScope::~NumaAllocationScope() {
+    currentNumaNodeIds = m_previous;
+}
+
+const std::vector<int>* NumaAllocationScope::current() {
+    return currentNumaNodeIds;
+}
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * @brief Allocates the page aligned memory placed on the NUMA nodes: bound to the node if a single node is given or
+ * interleaved over the nodes otherwise. The policy is set before the pages are touched, so nothing is migrated.
+ * @return nullptr if the placement is not supported by the OS or has failed
+ */
+void* allocateOnNumaNodes(size_t size, const std::vector<int>& numaNodeIds);
+
+/**
+ * @brief Releases the memory allocated by allocateOnNumaNodes()
+ */
+void freeNumaMemory(void* ptr, size_t size);
+
+/**
+ * @brief Makes the memory managers created or resized in the current thread allocate on the given NUMA nodes while
+ * the object exists. The scope is not active if the list of the nodes is empty.
+ */
+class NumaAllocationScope {
+public:
+    explicit NumaAllocationScope(const std::vector<int>& numaNodeIds);
+    ~NumaAllocationScope();
+
+    NumaAllocationScope(const NumaAllocationScope&) = delete;
+    NumaAllocationScope& operator=(const NumaAllocationScope&) = delete;
+
+    /**
+     * @brief Returns the NUMA nodes of the innermost active scope of the current thread or nullptr if there is none
+     */
+    static const std::vector<int>* current();
+
+private:
+    const std::vector<int>* m_previous;
+};
+
+/**
+ * @brief Adds the sizes of the resident pages of the memory region to the counters of the NUMA nodes they reside on
+ * @return false if the OS does not report the pages placement
+ */
+bool countNumaResidentMemory(const void* ptr, size_t size, std::map<int, uint64_t>& bytesPerNode);
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -0,0 +1,18 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+namespace ov {
+namespace intel_cpu {
+
+/**
+ * The key of the rt_info string with the description of the primitive descriptor selected for the node when the model was
+ * exported (see Node::describePrimitiveDescriptor). It's set on the import of the compiled blob, so the node selects the same
+ * primitive descriptor without the creation of all the supported ones.
+ */
+constexpr const char *ExportedPrimitiveAttr = "ExportedPrimitive";
+
+}   // namespace intel_cpu
+}   // namespace ov
@@ -5,13 +5,19 @@
 #include "weights_cache.hpp"
 
 #include <ie_system_conf.h>
+#include <algorithm>
 #include <memory>
+#include <set>
+
+#include "utils/numa_memory.h"
 
 namespace ov {
 namespace intel_cpu {
 
 const SimpleDataHash WeightsSharing::simpleCRC;
 
+WeightsSharing::WeightsSharing(std::vector<int> numaNodeIds) : numaNodeIds(std::move(numaNodeIds)) {}
+
 WeightsSharing::SharedMemory::SharedMemory(
         std::unique_lock<std::mutex> && lock,
         const MemoryInfo::Ptr & memory,
@@ -45,7 +51,12 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(
 
         if (found == sharedWeights.end()
             || !((ptr = found->second) && (newPtr = ptr->sharedMemory.lock()))) {
-            newPtr = create();
+            {
+                // the memory is allocated on the NUMA nodes before it is filled, so the pages are not migrated. The
+                // placement is a best effort, the failure just leaves the pages where the first touch puts them
+                NumaAllocationScope numaScope(numaNodeIds);
+                newPtr = create();
+            }
             ptr = std::make_shared<MemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
         }
@@ -71,9 +82,44 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                                 : std::unique_lock<std::mutex>(ptr->guard), ptr, newPtr);
 }
 
-NumaNodesWeights::NumaNodesWeights() {
-    for (auto numa_id : InferenceEngine::getAvailableNUMANodes())
-        _cache_map[numa_id] = std::make_shared<WeightsSharing>();
+void WeightsSharing::collectNumaMemoryUsage(std::map<int, uint64_t>& bytesPerNode) const {
+    std::unique_lock<std::mutex> lock(guard);
+    for (const auto& item : sharedWeights) {
+        auto memory = item.second->sharedMemory.lock();
+        if (!memory || !memory->getDesc().isDefined() || !memory->GetData())
+            continue;
+        if (!countNumaResidentMemory(memory->GetData(), memory->GetSize(), bytesPerNode)) {
+            // the placement is unknown, so the memory is attributed to the nodes it was requested for
+            const auto nodeId = numaNodeIds.size() == 1 ? numaNodeIds.front() : -1;
+            bytesPerNode[nodeId] += memory->GetSize();
+        }
+    }
+}
+
+NumaNodesWeights::NumaNodesWeights(bool interleave) {
+    const auto numaNodes = InferenceEngine::getAvailableNUMANodes();
+    // the node ids are negative if the NUMA topology is not known, nothing to place then
+    const bool knownNodes = numaNodes.size() > 1 &&
+                            std::all_of(numaNodes.begin(), numaNodes.end(), [](int id) { return id >= 0; });
+    if (interleave) {
+        auto weights = std::make_shared<WeightsSharing>(knownNodes ? numaNodes : std::vector<int>{});
+        for (auto numa_id : numaNodes)
+            _cache_map[numa_id] = weights;
+    } else {
+        for (auto numa_id : numaNodes)
+            _cache_map[numa_id] = std::make_shared<WeightsSharing>(knownNodes ? std::vector<int>{numa_id} : std::vector<int>{});
+    }
+}
+
+std::map<int, uint64_t> NumaNodesWeights::getMemoryPerNumaNode() const {
+    std::map<int, uint64_t> bytesPerNode;
+    std::set<const WeightsSharing*> visited;
+    for (const auto& item : _cache_map) {
+        // the interleaved weights are shared by all the nodes
+        if (visited.insert(item.second.get()).second)
+            item.second->collectNumaMemoryUsage(bytesPerNode);
+    }
+    return bytesPerNode;
 }
 
 WeightsSharing::Ptr& NumaNodesWeights::operator[](int numa_id) {
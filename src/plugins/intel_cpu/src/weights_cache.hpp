@@ -13,6 +13,7 @@
 #include <atomic>
 #include <mutex>
 #include <map>
+#include <vector>
 
 // TODO: While CPU plugin has no ease way to clone graph object we use weight
 //       caching in global Engine context to avoid tensor memory duplication.
@@ -70,6 +71,12 @@ class WeightsSharing {
 public:
     typedef std::shared_ptr<WeightsSharing> Ptr;
 
+    /**
+     * @param numaNodeIds the NUMA nodes the created memory is placed to: bound to the node if there is a single one or
+     * interleaved over them otherwise. The memory is not placed explicitly if the list is empty.
+     */
+    explicit WeightsSharing(std::vector<int> numaNodeIds = {});
+
     class SharedMemory {
     public:
         typedef std::shared_ptr<SharedMemory> Ptr;
@@ -94,12 +101,18 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * @brief Adds the sizes of the live cached memory objects to the counters of the NUMA nodes the pages reside on
+     */
+    void collectNumaMemoryUsage(std::map<int, uint64_t>& bytesPerNode) const;
+
     static const SimpleDataHash& GetHashFunc () { return simpleCRC; }
 
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
     static const SimpleDataHash simpleCRC;
+    const std::vector<int> numaNodeIds;
 };
 
 /**
@@ -109,11 +122,20 @@ protected:
  */
 class NumaNodesWeights {
 public:
-    NumaNodesWeights();
+    /**
+     * @param interleave if false, each NUMA node gets its own replica of the weights placed on the node memory,
+     * otherwise a single copy of the weights is interleaved over all the nodes and shared by them
+     */
+    explicit NumaNodesWeights(bool interleave = false);
 
     WeightsSharing::Ptr& operator[](int i);
     const WeightsSharing::Ptr& operator[](int i) const;
 
+    /**
+     * @brief Returns the size of the weights memory resident on each NUMA node
+     */
+    std::map<int, uint64_t> getMemoryPerNumaNode() const;
+
 private:
     std::map<int, WeightsSharing::Ptr> _cache_map;
 };
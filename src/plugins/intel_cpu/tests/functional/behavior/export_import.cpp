@@ -6,6 +6,7 @@
 #include "openvino/runtime/core.hpp"
 #include "openvino/runtime/compiled_model.hpp"
 #include "openvino/runtime/properties.hpp"
+#include "exec_graph_info.hpp"
 #include "common_test_utils/test_common.hpp"
 #include "ngraph_functions/builders.hpp"
 
@@ -62,4 +63,33 @@ TEST(ExportImportTest, ExportOptimalNumStreams) {
         EXPECT_EQ(nstreams_latency_original, nstreams_latency_imported);
     }
 }
+
+TEST(ExportImportTest, ExportSelectedPrimitives) {
+    const ov::Shape input_shape = {1, 16, 20, 20};
+    auto params = ngraph::builder::makeParams(ov::element::f32, {input_shape});
+    auto conv = ngraph::builder::makeConvolution(params[0], ov::element::f32, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                 ov::op::PadType::EXPLICIT, 32);
+    auto relu = std::make_shared<ov::opset9::Relu>(conv);
+    auto pool = std::make_shared<ov::opset9::MaxPool>(relu, ov::Strides{2, 2}, ov::Shape{0, 0}, ov::Shape{0, 0}, ov::Shape{2, 2});
+    auto original_model = std::make_shared<ov::Model>(ngraph::NodeVector{pool}, params, "ConvModel");
+
+    ov::Core core;
+    auto original_network = core.compile_model(original_model, "CPU");
+
+    std::stringstream exported_stream;
+    original_network.export_model(exported_stream);
+    auto imported_network = core.import_model(exported_stream, "CPU");
+
+    // The imported network uses the primitives selected for the exported one
+    auto getPrimitives = [](const std::shared_ptr<const ov::Model>& runtime_model) {
+        std::map<std::string, std::string> primitives;
+        for (const auto& op : runtime_model->get_ops()) {
+            const auto& rt_info = op->get_rt_info();
+            primitives[op->get_friendly_name()] = rt_info.at(ExecGraphInfoSerialization::IMPL_TYPE).as<std::string>() + " " +
+                                                  rt_info.at(ExecGraphInfoSerialization::OUTPUT_LAYOUTS).as<std::string>();
+        }
+        return primitives;
+    };
+    EXPECT_EQ(getPrimitives(original_network.get_runtime_model()), getPrimitives(imported_network.get_runtime_model()));
+}
 }  // namespace
@@ -0,0 +1,87 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/properties.hpp"
+#include "hetero/hetero_plugin_config.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "ngraph_functions/builders.hpp"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+// this test loads plugin by library name: this is not available during static linkage
+#ifndef OPENVINO_STATIC_LIBRARY
+
+/* The blocks are assigned to the different devices, so HETERO splits the model into two subgraphs, which are the stages
+   of the pipeline.
+        Param
+          |
+    Conv -> Relu    CPU0
+          |
+    Conv -> Relu    CPU1
+          |
+        Result
+*/
+std::shared_ptr<ov::Model> MakeTwoSubgraphsModel() {
+    const ov::element::Type precision = ov::element::f32;
+    const size_t channels = 8;
+
+    auto params = ngraph::builder::makeParams(precision, {{1, channels, 16, 16}});
+    ov::Output<ov::Node> out = params[0];
+    for (const auto& device : {"CPU0", "CPU1"}) {
+        auto conv = ngraph::builder::makeConvolution(out, precision, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                     ov::op::PadType::EXPLICIT, channels);
+        auto relu = std::make_shared<ov::op::v0::Relu>(conv);
+        conv->get_rt_info()["affinity"] = std::string(device);
+        relu->get_rt_info()["affinity"] = std::string(device);
+        out = relu;
+    }
+
+    ngraph::NodeVector results{out.get_node_shared_ptr()};
+    return std::make_shared<ov::Model>(results, params, "TwoSubgraphsModel");
+}
+
+TEST(HeteroCpuPipelineTest, ReportSubgraphsUtilization) {
+    ov::Core core;
+    for (const auto& device : {"CPU0", "CPU1"})
+        core.register_plugin(std::string("openvino_intel_cpu_plugin") + IE_BUILD_POSTFIX, device);
+    core.set_property("CPU0", ov::num_streams(2));
+    core.set_property("CPU1", ov::num_streams(3));
+
+    auto model = MakeTwoSubgraphsModel();
+    auto compiled_model = core.compile_model(model, "HETERO:CPU0,CPU1");
+
+    // every subgraph gets its own optimal number of requests
+    uint32_t expectedRequests = 0;
+    for (const auto& device : {"CPU0", "CPU1"})
+        expectedRequests += core.compile_model(model, device).get_property(ov::optimal_number_of_infer_requests);
+    const auto optimalRequests = compiled_model.get_property(ov::optimal_number_of_infer_requests);
+    ASSERT_EQ(optimalRequests, expectedRequests);
+
+    std::vector<ov::InferRequest> requests;
+    for (uint32_t i = 0; i < optimalRequests; i++)
+        requests.push_back(compiled_model.create_infer_request());
+    for (size_t iteration = 0; iteration < 10; iteration++) {
+        for (auto& request : requests)
+            request.start_async();
+        for (auto& request : requests)
+            request.wait();
+    }
+
+    const auto utilization = compiled_model.get_property(METRIC_KEY(HETERO_SUBGRAPHS_UTILIZATION)).as<std::vector<float>>();
+    ASSERT_EQ(utilization.size(), 2);
+    // both subgraphs have run the requests during the async rounds
+    for (const auto& value : utilization) {
+        EXPECT_GT(value, 0.f);
+        EXPECT_LE(value, 1.f);
+    }
+}
+
+#endif // !OPENVINO_STATIC_LIBRARY
+
+}  // namespace
@@ -0,0 +1,68 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "openvino/runtime/core.hpp"
+#include "openvino/runtime/compiled_model.hpp"
+#include "openvino/runtime/properties.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "common_test_utils/test_common.hpp"
+#include "ngraph_functions/builders.hpp"
+
+#include <string>
+
+namespace {
+
+using WeightsNumaPlacementParams = ov::intel_cpu::WeightsNumaPolicy;
+
+class WeightsNumaPlacementTest : public testing::WithParamInterface<WeightsNumaPlacementParams>,
+                                 public CommonTestUtils::TestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<WeightsNumaPlacementParams>& obj) {
+        std::ostringstream result;
+        result << "policy=" << obj.param;
+        return result.str();
+    }
+};
+
+const ov::Shape weightsShape = {4096, 1024};
+
+std::shared_ptr<ov::Model> MakeMatMulModel() {
+    const ov::element::Type precision = ov::element::f32;
+
+    auto params = ngraph::builder::makeParams(precision, {{1, weightsShape[0]}});
+    auto matmul_const = ngraph::builder::makeConstant(precision, weightsShape, std::vector<float>{}, true);
+    auto matmul = ngraph::builder::makeMatMul(params[0], matmul_const);
+
+    ngraph::NodeVector results{matmul};
+    return std::make_shared<ov::Model>(results, params, "MatMulModel");
+}
+
+TEST_P(WeightsNumaPlacementTest, ReportWeightsMemoryPerNumaNode) {
+    ov::Core core;
+    // the weights are shared through the weights cache only by several streams
+    auto compiled_model = core.compile_model(MakeMatMulModel(), "CPU",
+                                             ov::num_streams(2),
+                                             ov::intel_cpu::weights_numa_policy(GetParam()));
+
+    const auto report = compiled_model.get_property(ov::intel_cpu::weights_memory_per_numa_node);
+    ASSERT_FALSE(report.empty());
+
+    uint64_t totalBytes = 0;
+    for (const auto& item : report) {
+        EXPECT_GE(std::stoi(item.first), -1);
+        totalBytes += item.second;
+    }
+
+    // only the whole pages of the memory are reported
+    const uint64_t weightsBytes = ov::shape_size(weightsShape) * sizeof(float);
+    const uint64_t pageTolerance = 64 * 1024;
+    EXPECT_GE(totalBytes + pageTolerance, weightsBytes);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_WeightsNumaPlacement, WeightsNumaPlacementTest,
+                         ::testing::Values(ov::intel_cpu::WeightsNumaPolicy::REPLICATE,
+                                           ov::intel_cpu::WeightsNumaPolicy::INTERLEAVE),
+                         WeightsNumaPlacementTest::getTestCaseName);
+
+}  // namespace
@@ -0,0 +1,74 @@
+// Copyright (C) 2022-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "snippets/reduce.hpp"
+#include "common_test_utils/test_constants.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+
+namespace {
+
+// the rows are longer than a vector and have a tail, so both the vector and the scalar Tiles are executed
+const std::vector<ov::Shape> inputShapes = {
+        {1, 3, 16, 37},
+        {2, 5, 64},
+        {4, 7},
+};
+
+const ov::AnyMap config = {ov::intel_cpu::snippets_reductions(true)};
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Reduce, Reduce,
+        ::testing::Combine(
+                ::testing::ValuesIn(inputShapes),
+                ::testing::Values(false, true),
+                ::testing::Values(2), // Sinh + Subgraph, the [..., 1] reduction result is the Subgraph output
+                ::testing::Values(1),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                ::testing::Values(config)),
+        Reduce::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Reduce, ReduceMaxSubtract,
+        ::testing::Combine(
+                ::testing::ValuesIn(inputShapes),
+                ::testing::Values(2), // Sinh + Subgraph
+                ::testing::Values(1),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                ::testing::Values(config)),
+        ReduceMaxSubtract::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Reduce, Softmax,
+        ::testing::Combine(
+                ::testing::ValuesIn(inputShapes),
+                ::testing::Values(2), // Sinh + Subgraph
+                ::testing::Values(1),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                ::testing::Values(config)),
+        Softmax::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Reduce, MVN,
+        ::testing::Combine(
+                ::testing::ValuesIn(inputShapes),
+                ::testing::Values(2), // Sinh + Subgraph
+                ::testing::Values(1),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                ::testing::Values(config)),
+        MVN::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_Snippets_Reduce_Disabled, Softmax,
+        ::testing::Combine(
+                ::testing::ValuesIn(inputShapes),
+                ::testing::Values(2), // Sinh + Softmax, the reductions aren't tokenized by default
+                ::testing::Values(0),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU),
+                ::testing::Values(ov::AnyMap{})),
+        Softmax::getTestCaseName);
+
+}  // namespace
+} // namespace snippets
+} // namespace test
+} // namespace ov
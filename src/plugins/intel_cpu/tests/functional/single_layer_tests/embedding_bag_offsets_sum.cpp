@@ -164,5 +164,43 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingBagOffsetsSumLayerCPUTest,
                 ::testing::ValuesIn(indPrecisions),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
+
+const std::vector<InputShape> long_bags_input_shapes = {
+        // the rows are split into the unrolled vector blocks, the single vector blocks and the scalar tails
+        {{ov::Dimension::dynamic(), ov::Dimension::dynamic()}, {{40, 67}, {48, 200}}},
+        {{40, 5, 13}, {{40, 5, 13}}},
+};
+
+const std::vector<ElementType> long_bags_net_precisions = {
+        ElementType::f32,
+        ElementType::i8,
+        ElementType::u8
+};
+
+// the rows are gathered in the scattered order, as the prefetching of the JIT kernel expects
+std::vector<size_t> makeLongBagsIndices(size_t count) {
+    std::vector<size_t> indices(count);
+    for (size_t i = 0; i < count; i++)
+        indices[i] = (i * 7) % 40;
+    return indices;
+}
+
+// the bags are empty, shorter and longer than the prefetch distance of the JIT kernel
+const auto embBagOffsetSumLongBagsArgSet = ::testing::Combine(
+        ::testing::ValuesIn(long_bags_input_shapes),
+        ::testing::Values(makeLongBagsIndices(50)),
+        ::testing::Values(std::vector<size_t>{0, 0, 1, 4, 8, 13}),
+        ::testing::Values(5),
+        ::testing::ValuesIn(with_weights),
+        ::testing::ValuesIn(with_default_index)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_LongBags, EmbeddingBagOffsetsSumLayerCPUTest,
+        ::testing::Combine(
+                embBagOffsetSumLongBagsArgSet,
+                ::testing::ValuesIn(long_bags_net_precisions),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        EmbeddingBagOffsetsSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
\ No newline at end of file
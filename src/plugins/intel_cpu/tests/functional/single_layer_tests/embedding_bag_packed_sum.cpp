@@ -148,5 +148,48 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingBagPackedSumLayerCPUTest,
                 ::testing::ValuesIn(indPrecisions),
                 ::testing::Values(CommonTestUtils::DEVICE_CPU)),
         EmbeddingBagPackedSumLayerCPUTest::getTestCaseName);
+
+const std::vector<InputShape> long_bags_input_shapes = {
+        // the rows are split into the unrolled vector blocks, the single vector blocks and the scalar tails
+        {{ov::Dimension::dynamic(), ov::Dimension::dynamic()}, {{40, 67}, {48, 200}}},
+        {{40, 5, 13}, {{40, 5, 13}}},
+};
+
+const std::vector<ElementType> long_bags_net_precisions = {
+        ElementType::f32,
+        ElementType::i8,
+        ElementType::u8
+};
+
+// the rows are gathered in the scattered order, as the prefetching of the JIT kernel expects
+std::vector<size_t> makeLongBagsIndices(size_t count) {
+    std::vector<size_t> indices(count);
+    for (size_t i = 0; i < count; i++)
+        indices[i] = (i * 7) % 40;
+    return indices;
+}
+
+std::vector<std::vector<size_t>> makeLongBagsPackedIndices(size_t batch, size_t bagSize) {
+    const auto indices = makeLongBagsIndices(batch * bagSize);
+    std::vector<std::vector<size_t>> packedIndices;
+    for (size_t i = 0; i < batch; i++)
+        packedIndices.emplace_back(indices.begin() + i * bagSize, indices.begin() + (i + 1) * bagSize);
+    return packedIndices;
+}
+
+// the bags are shorter and longer than the prefetch distance of the JIT kernel
+const auto embBagPackedSumLongBagsArgSet = ::testing::Combine(
+        ::testing::ValuesIn(long_bags_input_shapes),
+        ::testing::Values(makeLongBagsPackedIndices(4, 3), makeLongBagsPackedIndices(3, 5), makeLongBagsPackedIndices(2, 37)),
+        ::testing::ValuesIn(with_weights)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_LongBags, EmbeddingBagPackedSumLayerCPUTest,
+        ::testing::Combine(
+                embBagPackedSumLongBagsArgSet,
+                ::testing::ValuesIn(long_bags_net_precisions),
+                ::testing::Values(ElementType::i32),
+                ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+        EmbeddingBagPackedSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
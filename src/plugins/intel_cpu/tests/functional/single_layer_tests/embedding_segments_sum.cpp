@@ -169,5 +169,52 @@ INSTANTIATE_TEST_SUITE_P(smoke, EmbeddingSegmentsSumLayerCPUTest,
          ::testing::ValuesIn(indPrecisions),
          ::testing::Values(CommonTestUtils::DEVICE_CPU)),
          EmbeddingSegmentsSumLayerCPUTest::getTestCaseName);
+
+const std::vector<InputShape> long_bags_input_shapes = {
+    // the rows are split into the unrolled vector blocks, the single vector blocks and the scalar tails
+    {{ov::Dimension::dynamic(), ov::Dimension::dynamic()}, {{40, 67}, {48, 200}}},
+    {{40, 5, 13}, {{40, 5, 13}}},
+};
+
+const std::vector<ElementType> long_bags_net_precisions = {
+    ElementType::f32,
+    ElementType::i8,
+    ElementType::u8
+};
+
+// the rows are gathered in the scattered order, as the prefetching of the JIT kernel expects
+std::vector<size_t> makeLongBagsIndices(size_t count) {
+    std::vector<size_t> indices(count);
+    for (size_t i = 0; i < count; i++)
+    indices[i] = (i * 7) % 40;
+    return indices;
+}
+
+// the segments 0, 5 and 7 are empty, the others are shorter and longer than the prefetch distance of the JIT kernel
+std::vector<size_t> makeLongBagsSegmentIds() {
+    std::vector<size_t> segmentIds;
+    const std::vector<std::pair<size_t, size_t>> segments = {{1, 1}, {2, 3}, {3, 4}, {4, 5}, {6, 37}};
+    for (const auto& segment : segments)
+        segmentIds.insert(segmentIds.end(), segment.second, segment.first);
+    return segmentIds;
+}
+
+const auto embSegmentsSumLongBagsArgSet = ::testing::Combine(
+    ::testing::ValuesIn(long_bags_input_shapes),
+    ::testing::Values(makeLongBagsIndices(50)),
+    ::testing::Values(makeLongBagsSegmentIds()),
+    ::testing::Values(8),
+    ::testing::Values(5),
+    ::testing::ValuesIn(with_weights),
+    ::testing::ValuesIn(with_default_index)
+);
+
+INSTANTIATE_TEST_SUITE_P(smoke_LongBags, EmbeddingSegmentsSumLayerCPUTest,
+     ::testing::Combine(
+         embSegmentsSumLongBagsArgSet,
+         ::testing::ValuesIn(long_bags_net_precisions),
+         ::testing::Values(ElementType::i32),
+         ::testing::Values(CommonTestUtils::DEVICE_CPU)),
+         EmbeddingSegmentsSumLayerCPUTest::getTestCaseName);
 }  // namespace
 }  // namespace CPULayerTestsDefinitions
@@ -195,6 +195,15 @@ std::vector<InputShape> inShapesDynamic = {
                 {4, 16, 9, 10, 8},
                 {8, 32, 5, 14, 6}
             }
+        },
+        {
+            // dynamic shape
+            {-1, -1},
+            { // target static shapes, the long rows with the tails after the whole vectors
+                {3, 1037},
+                {1, 2049},
+                {7, 67}
+            }
         }
 };
 std::vector<ngraph::Shape> inShapesStatic = {
@@ -202,7 +211,8 @@ std::vector<ngraph::Shape> inShapesStatic = {
         { 4, 100 },
         { 4, 2, 100 },
         { 4, 4, 2, 100 },
-        { 4, 4, 4, 2, 100 }
+        { 4, 4, 4, 2, 100 },
+        { 2, 2, 2, 2, 3, 70 }
 };
 
 const auto paramsStatic = ::testing::Combine(
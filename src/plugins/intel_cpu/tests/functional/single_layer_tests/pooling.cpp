@@ -204,6 +204,18 @@ protected:
     }
 };
 
+class MaxPoolingV8WithIndicesLayerCPUTest : public MaxPoolingV8LayerCPUTest {
+protected:
+    void SetUp() override {
+        MaxPoolingV8LayerCPUTest::SetUp();
+
+        auto pooling = function->get_results()[0]->get_input_node_shared_ptr(0);
+        ngraph::ResultVector results{std::make_shared<ngraph::opset3::Result>(pooling->output(0)),
+                                     std::make_shared<ngraph::opset3::Result>(pooling->output(1))};
+        function = std::make_shared<ngraph::Function>(results, function->get_parameters(), "MaxPoolingWithIndices");
+    }
+};
+
 TEST_P(PoolingLayerCPUTest, CompareWithRefs) {
     SKIP_IF_CURRENT_TEST_IS_DISABLED()
 
@@ -218,6 +230,13 @@ TEST_P(MaxPoolingV8LayerCPUTest, CompareWithRefs) {
     CheckPluginRelatedResults(compiledModel, "Pooling");
 }
 
+TEST_P(MaxPoolingV8WithIndicesLayerCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckPluginRelatedResults(compiledModel, "Pooling");
+}
+
 namespace {
 
 const auto avx512 = CPUSpecificParams{{}, {}, {"jit_avx512"}, "jit_avx512"};
@@ -451,6 +470,49 @@ INSTANTIATE_TEST_SUITE_P(smoke_MaxPoolV8_CPU_4D_ref, MaxPoolingV8LayerCPUTest,
                                  ::testing::Values(ref)),
                          MaxPoolingV8LayerCPUTest::getTestCaseName);
 
+const std::vector<LayerTestsDefinitions::maxPoolV8SpecificParams> paramsMaxV84D_indices = {
+        LayerTestsDefinitions::maxPoolV8SpecificParams{ {2, 2}, {2, 2}, {1, 1}, {0, 0}, {0, 0},
+                                                        ngraph::element::Type_t::i32, 0,
+                                                        ngraph::op::RoundingType::CEIL, ngraph::op::PadType::SAME_LOWER },
+        LayerTestsDefinitions::maxPoolV8SpecificParams{ {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1},
+                                                        ngraph::element::Type_t::i32, 2,
+                                                        ngraph::op::RoundingType::FLOOR, ngraph::op::PadType::EXPLICIT },
+        LayerTestsDefinitions::maxPoolV8SpecificParams{ {4, 2}, {2, 1}, {2, 2}, {0, 0}, {0, 0},
+                                                        ngraph::element::Type_t::i32, 1,
+                                                        ngraph::op::RoundingType::CEIL, ngraph::op::PadType::EXPLICIT },
+};
+
+const std::vector<CPUSpecificParams> vecCpuConfigsNative4D = {
+        CPUSpecificParams{{nchw}, {nchw}, {"ref_any"}, "ref_any"},
+        CPUSpecificParams{{nhwc}, {nhwc}, {"ref_any"}, "ref_any"},
+        CPUSpecificParams{{nChw16c}, {nChw16c}, {"ref_any"}, "ref_any"},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MaxPoolV8_CPU_4D_indices, MaxPoolingV8WithIndicesLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(paramsMaxV84D_indices),
+                                 ::testing::ValuesIn(inputShapes4D),
+                                 ::testing::ValuesIn(inpOutPrecision),
+                                 ::testing::ValuesIn(vecCpuConfigsNative4D)),
+                         MaxPoolingV8WithIndicesLayerCPUTest::getTestCaseName);
+
+// the plugin max pooling keeps the int8 data as is
+INSTANTIATE_TEST_SUITE_P(smoke_MaxPoolV8_CPU_4D_dilated_I8, MaxPoolingV8LayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(paramsMaxV84D_ref),
+                                 ::testing::ValuesIn(inputShapes4D),
+                                 ::testing::Values(ElementType::i8, ElementType::u8),
+                                 ::testing::ValuesIn(vecCpuConfigsNative4D)),
+                         MaxPoolingV8LayerCPUTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_MaxPoolV8_CPU_4D_indices_I8, MaxPoolingV8WithIndicesLayerCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(paramsMaxV84D_indices),
+                                 ::testing::ValuesIn(inputShapes4D),
+                                 ::testing::Values(ElementType::i8, ElementType::u8),
+                                 ::testing::ValuesIn(vecCpuConfigsNative4D)),
+                         MaxPoolingV8WithIndicesLayerCPUTest::getTestCaseName);
+
 INSTANTIATE_TEST_SUITE_P(smoke_AvgPool_CPU_4D, PoolingLayerCPUTest,
                         ::testing::Combine(
                             ::testing::ValuesIn(paramsAvg4D),
@@ -153,6 +153,15 @@ const std::vector<ScatterNDUpdateLayerParams> scatterParams = {
         },
         IndicesValues{ 0, 1, 1, 2, 2, 2 }
     },
+    // the duplicated tuples are applied in their order, i.e. the last update wins
+    ScatterNDUpdateLayerParams{
+        ScatterNDUpdateShapes{
+            {{-1, -1, -1, -1}, {{ 10, 9, 9, 11 }, { 7, 5, 3, 12 }, { 3, 4, 9, 8 }}},
+            {{5, 2}, {{5, 2}, {5, 2}, {5, 2}}},
+            {{5, -1, -1}, {{5, 9, 11}, {5, 3, 12}, {5, 9, 8}}}
+        },
+        IndicesValues{ 1, 2, 0, 0, 1, 2, 2, 3, 1, 2 }
+    },
 };
 
 const std::vector<ElementType> inputPrecisions = {
@@ -171,4 +180,42 @@ INSTANTIATE_TEST_SUITE_P(smoke_CompareWithRefs, ScatterNDUpdateLayerCPUTest,
         ::testing::ValuesIn(inputPrecisions),
         ::testing::ValuesIn(constantPrecisions)),
     ScatterNDUpdateLayerCPUTest::getTestCaseName);
+
+class ScatterNDUpdateOutOfRangeLayerCPUTest : public ScatterNDUpdateLayerCPUTest {};
+
+TEST_P(ScatterNDUpdateOutOfRangeLayerCPUTest, ThrowsOnOutOfRangeIndices) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    compile_model();
+    for (const auto& targetStaticShapeVec : targetStaticShapes) {
+        generate_inputs(targetStaticShapeVec);
+        ASSERT_THROW(infer(), ov::Exception);
+    }
+}
+
+const std::vector<ScatterNDUpdateLayerParams> outOfRangeScatterParams = {
+    // the second tuple points beyond the second dimension
+    ScatterNDUpdateLayerParams{
+        ScatterNDUpdateShapes{
+            {{-1, -1, -1, -1}, {{ 10, 9, 9, 11 }}},
+            {{2, 3}, {{2, 3}}},
+            {{2, -1}, {{2, 11}}}
+        },
+        IndicesValues{ 0, 1, 1, 2, 9, 2 }
+    },
+    ScatterNDUpdateLayerParams{
+        ScatterNDUpdateShapes{
+            {{10, 9, 9, 11}, {{ 10, 9, 9, 11 }}},
+            {{2, 1}, {{2, 1}}},
+            {{2, 9, 9, 11}, {{2, 9, 9, 11}}}
+        },
+        IndicesValues{ 10, 0 }
+    },
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_OutOfRangeIndices, ScatterNDUpdateOutOfRangeLayerCPUTest,
+    ::testing::Combine(
+        ::testing::ValuesIn(outOfRangeScatterParams),
+        ::testing::Values(ElementType::f32),
+        ::testing::ValuesIn(constantPrecisions)),
+    ScatterNDUpdateLayerCPUTest::getTestCaseName);
 } // namespace CPULayerTestsDefinitions
@@ -126,6 +126,23 @@ const std::vector<ScatterUpdateLayerParams> scatterParams = {
         IndicesDescription{{ 4, 2 }, { 0, 2, 4, 6, 1, 3, 5, 7 }},
         Axis{0}
     },
+    // the duplicated indices are applied in their order, i.e. the last update wins
+    ScatterUpdateLayerParams{
+        ScatterUpdateShapes{
+            {{-1, -1, -1, -1}, {{4, 12, 3, 11}, {7, 11, 2, 3}, {3, 9, 4, 10}}},
+            {{-1, -1, -1, -1}, {{4, 8, 3, 11}, {7, 8, 2, 3}, {3, 8, 4, 10}}}
+        },
+        IndicesDescription{{8}, {5, 2, 5, 0, 2, 5, 7, 0}},
+        Axis{1}
+    },
+    ScatterUpdateLayerParams{
+        ScatterUpdateShapes{
+            {{-1}, {{16}, {7}}},
+            {{-1}, {{6}, {6}}}
+        },
+        IndicesDescription{{6}, {3, 1, 3, 3, 0, 1}},
+        Axis{0}
+    },
 };
 
 const std::vector<ElementType> inputPrecisions = {
@@ -153,5 +153,29 @@ INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorSimple, TensorIteratorCPUTest,
                                  ::testing::ValuesIn(inputPrecisions)),
                          TensorIteratorCPUTest::getTestCaseName);
 
+// The iterations are independent, the slices are either dense parts of the tensors or strided ones
+std::vector<std::vector<InputShape>> inputsStatic = {
+    {
+        {{1, 12, 10}, {{1, 12, 10}}},
+        {{1, 12, 10}, {{1, 12, 10}}}
+    },
+    {
+        {{4, 12, 10}, {{4, 12, 10}}},
+        {{4, 12, 10}, {{4, 12, 10}}}
+    },
+    // the body is heavy enough to execute the iterations concurrently
+    {
+        {{16, 12, 256}, {{16, 12, 256}}},
+        {{16, 12, 256}, {{16, 12, 256}}}
+    }
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_TensorIteratorStatic, TensorIteratorCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(inputsStatic),
+                                 ::testing::ValuesIn(direction),
+                                 ::testing::Values(ElementType::f32)),
+                         TensorIteratorCPUTest::getTestCaseName);
+
 }  // namespace
 } // namespace CPULayerTestsDefinitions
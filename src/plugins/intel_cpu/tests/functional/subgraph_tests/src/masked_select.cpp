@@ -0,0 +1,120 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include <common_test_utils/ov_tensor_utils.hpp>
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The slices selected by the comparison result are replaced by the MaskedSelect node.
+    Param   Param
+      |       |
+      |    Greater(0.5)
+      |       |
+      |    [Convert]
+      |       |
+      |    NonZero
+      |       |
+      |    Transpose({1, 0})
+       \     /
+       GatherND
+          |
+        Result
+*/
+
+using MaskedSelectParams = std::tuple<
+        std::vector<InputShape>,  // data and mask shapes
+        ov::element::Type>;       // mask precision
+
+class MaskedSelectCPUTest : public testing::WithParamInterface<MaskedSelectParams>,
+                            virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<MaskedSelectParams>& obj) {
+        std::vector<InputShape> inputShapes;
+        ov::element::Type maskType;
+        std::tie(inputShapes, maskType) = obj.param;
+
+        std::ostringstream result;
+        for (const auto& shape : inputShapes) {
+            result << "IS=" << CommonTestUtils::partialShape2str({shape.first}) << "_TS=";
+            for (const auto& item : shape.second)
+                result << CommonTestUtils::vec2str(item) << "_";
+        }
+        result << "maskPrc=" << maskType;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        std::vector<InputShape> inputShapes;
+        ov::element::Type maskType;
+        std::tie(inputShapes, maskType) = GetParam();
+        init_input_shapes(inputShapes);
+
+        auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+        auto threshold = ngraph::builder::makeConstant<float>(ngPrc, {}, {0.5f});
+        ov::Output<ov::Node> mask = std::make_shared<ngraph::opset1::Greater>(inputParams[1], threshold);
+        if (maskType != ngraph::element::boolean)
+            mask = std::make_shared<ngraph::opset1::Convert>(mask, maskType);
+        auto nonZero = std::make_shared<ngraph::opset3::NonZero>(mask, ngraph::element::i32);
+        auto order = ngraph::builder::makeConstant<int64_t>(ngraph::element::i64, {2}, {1, 0});
+        auto transpose = std::make_shared<ngraph::opset1::Transpose>(nonZero, order);
+        auto gatherND = std::make_shared<ngraph::opset8::GatherND>(inputParams[0], transpose);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(gatherND)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "MaskedSelect");
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        inputs.clear();
+        const auto& funcInputs = function->inputs();
+        for (size_t i = 0; i < funcInputs.size(); ++i) {
+            const auto& funcInput = funcInputs[i];
+            ov::Tensor tensor;
+            if (i == 0) {
+                tensor = ov::test::utils::create_and_fill_tensor(funcInput.get_element_type(), targetInputStaticShapes[i]);
+            } else {
+                // the mask input is in [0, 1), so about a half of the slices is selected
+                tensor = ov::test::utils::create_and_fill_tensor(funcInput.get_element_type(), targetInputStaticShapes[i], 1, 0, 1000);
+            }
+            inputs.insert({funcInput.get_node_shared_ptr(), tensor});
+        }
+    }
+};
+
+TEST_P(MaskedSelectCPUTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    CheckNumberOfNodesWithType(compiledModel, "MaskedSelect", 1);
+}
+
+namespace {
+
+const std::vector<std::vector<InputShape>> inputShapes = {
+    {{{}, {{4, 16, 8}}}, {{}, {{4, 16}}}},
+    {{{-1, 16, 8}, {{2, 16, 8}, {5, 16, 8}, {1, 16, 8}}}, {{-1, 16}, {{2, 16}, {5, 16}, {1, 16}}}},
+    // the mask covers a part of the data
+    {{{-1, -1}, {{8, 7}, {3, 10}}}, {{-1, -1}, {{4, 7}, {3, 2}}}},
+    // the long mask rows with the tails after the whole vectors
+    {{{-1, 3}, {{1037, 3}, {70, 3}}}, {{-1}, {{1037}, {70}}}},
+    {{{-1, -1}, {{3, 300}, {4, 1100}}}, {{-1, -1}, {{2, 130}, {4, 1037}}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_MaskedSelect, MaskedSelectCPUTest,
+                         ::testing::Combine(
+                                 ::testing::ValuesIn(inputShapes),
+                                 ::testing::Values(ngraph::element::boolean, ngraph::element::u8, ngraph::element::f32)),
+                         MaskedSelectCPUTest::getTestCaseName);
+
+} // namespace
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,90 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+using namespace ngraph;
+using ngraph::helpers::EltwiseTypes;
+
+namespace SubgraphTestsDefinitions {
+
+/* Inception-like block with independent branches executed concurrently.
+         Param
+      /    |     \
+   Conv   Conv  MaxPool
+    |      |      |
+   Relu   Conv   Conv
+      \    |     /
+        Concat
+*/
+
+class ParallelBranchesTest : public LayerTestsUtils::LayerTestsCommon {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({ov::intel_cpu::parallel_branches.name(), InferenceEngine::PluginConfigParams::YES});
+
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, 16, 14, 14}});
+        auto paramOuts = helpers::convert2OutputVector(helpers::castOps2Nodes<op::Parameter>(inputParams));
+
+        auto conv1 = builder::makeConvolution(paramOuts[0], ngPrc, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1}, op::PadType::EXPLICIT, 8);
+        auto relu1 = std::make_shared<op::v0::Relu>(conv1);
+
+        auto conv2 = builder::makeConvolution(paramOuts[0], ngPrc, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1}, op::PadType::EXPLICIT, 8);
+        auto conv3 = builder::makeConvolution(conv2, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, op::PadType::EXPLICIT, 8);
+
+        auto pool = builder::makePooling(paramOuts[0], {1, 1}, {1, 1}, {1, 1}, {3, 3}, op::RoundingType::FLOOR,
+                                         op::PadType::EXPLICIT, false, helpers::PoolingTypes::MAX);
+        auto conv4 = builder::makeConvolution(pool, ngPrc, {1, 1}, {1, 1}, {0, 0}, {0, 0}, {1, 1}, op::PadType::EXPLICIT, 8);
+
+        auto concat = std::make_shared<op::v0::Concat>(NodeVector{relu1, conv3, conv4}, 1);
+
+        NodeVector results{concat};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "ParallelBranches");
+    }
+};
+
+TEST_F(ParallelBranchesTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+// The intermediate tensors of the branches which can't overlap in time still share memory, so the results must be
+// exactly the same as the ones of the sequential execution, inference after inference
+TEST_F(ParallelBranchesTest, smoke_CompareWithSequential) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto model = std::make_shared<ov::Model>(function->get_results(), function->get_parameters());
+    auto parallelRequest = core->compile_model(model, targetDevice, ov::intel_cpu::parallel_branches(true)).create_infer_request();
+    auto sequentialRequest = core->compile_model(model, targetDevice, ov::intel_cpu::parallel_branches(false)).create_infer_request();
+
+    const auto& inputShape = model->input().get_shape();
+    for (size_t iteration = 0; iteration < 3; iteration++) {
+        ov::Tensor input(ov::element::f32, inputShape);
+        auto* data = input.data<float>();
+        for (size_t i = 0; i < input.get_size(); i++)
+            data[i] = static_cast<float>((i * 13 + iteration * 7) % 29) / 10.0f - 1.4f;
+
+        parallelRequest.set_input_tensor(input);
+        sequentialRequest.set_input_tensor(input);
+        parallelRequest.infer();
+        sequentialRequest.infer();
+
+        const auto parallelOutput = parallelRequest.get_output_tensor();
+        const auto sequentialOutput = sequentialRequest.get_output_tensor();
+        ASSERT_EQ(parallelOutput.get_shape(), sequentialOutput.get_shape());
+        const auto* parallelData = parallelOutput.data<float>();
+        const auto* sequentialData = sequentialOutput.data<float>();
+        for (size_t i = 0; i < parallelOutput.get_size(); i++)
+            ASSERT_EQ(parallelData[i], sequentialData[i]) << "iteration " << iteration << ", element " << i;
+    }
+}
+
+} // namespace SubgraphTestsDefinitions
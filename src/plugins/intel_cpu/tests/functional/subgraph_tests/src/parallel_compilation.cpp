@@ -0,0 +1,66 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "ngraph_functions/builders.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace ngraph;
+
+namespace SubgraphTestsDefinitions {
+
+/* The chain of convolution blocks, whose descriptors and primitives are created concurrently.
+   The blocks are identical, so they look up the same records of the runtime cache concurrently.
+        Param
+          |
+    Conv -> Relu    x blocksNum
+          |
+        Result
+*/
+
+using ParallelCompilationParams = std::string;  // the CPU_PARALLEL_COMPILATION value
+
+class ParallelCompilationTest : public testing::WithParamInterface<ParallelCompilationParams>,
+                                public LayerTestsUtils::LayerTestsCommon {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<ParallelCompilationParams>& obj) {
+        return "parallelCompilation=" + obj.param;
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({ov::intel_cpu::parallel_compilation.name(), GetParam()});
+
+        const size_t blocksNum = 16;
+        const size_t channels = 8;
+        auto ngPrc = element::f32;
+        auto inputParams = builder::makeParams(ngPrc, {{1, channels, 10, 10}});
+
+        std::vector<float> weights(channels * channels * 3 * 3);
+        for (size_t i = 0; i < weights.size(); i++)
+            weights[i] = static_cast<float>(i % 7) / 10.0f - 0.3f;
+
+        Output<Node> out = inputParams[0];
+        for (size_t i = 0; i < blocksNum; i++) {
+            auto conv = builder::makeConvolution(out, ngPrc, {3, 3}, {1, 1}, {1, 1}, {1, 1}, {1, 1}, op::PadType::EXPLICIT,
+                                                 channels, false, weights);
+            out = std::make_shared<op::v0::Relu>(conv);
+        }
+
+        function = std::make_shared<ngraph::Function>(NodeVector{out.get_node_shared_ptr()}, inputParams, "ParallelCompilation");
+    }
+};
+
+TEST_P(ParallelCompilationTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    Run();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ParallelCompilation, ParallelCompilationTest,
+                         ::testing::Values(InferenceEngine::PluginConfigParams::YES, InferenceEngine::PluginConfigParams::NO),
+                         ParallelCompilationTest::getTestCaseName);
+
+} // namespace SubgraphTestsDefinitions
@@ -0,0 +1,55 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* Sequence length buckets met repeatedly: the repeated shapes skip the shapes update and the ones met before are
+   served from the per-node shape inference memo.
+      Param
+        |
+      Relu
+        |
+     Add(const)
+        |
+     Softmax
+*/
+
+class ShapeInferMemoTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+
+        InputShape inputShape{{1, -1, 64}, {{1, 16, 64}, {1, 16, 64}, {1, 32, 64}, {1, 16, 64}, {1, 32, 64}}};
+        init_input_shapes({inputShape});
+
+        auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+        auto relu = std::make_shared<ngraph::opset1::Relu>(inputParams.front());
+        auto bias = ngraph::builder::makeConstant<float>(ngPrc, {1, 1, 64}, {}, true);
+        auto add = std::make_shared<ngraph::opset1::Add>(relu, bias);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(add, 2);
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(softmax)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "ShapeInferMemo");
+    }
+};
+
+TEST_F(ShapeInferMemoTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+
+    const auto stats = compiledModel.get_property(ov::intel_cpu::shape_inference_statistics);
+    EXPECT_GT(stats.at("fast_path_hits"), 0);
+    EXPECT_GT(stats.at("memo_hits"), 0);
+}
+
+} // namespace SubgraphTestsDefinitions
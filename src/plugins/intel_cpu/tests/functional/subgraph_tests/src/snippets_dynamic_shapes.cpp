@@ -0,0 +1,128 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "test_utils/cpu_test_utils.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+
+using namespace CPUTestUtils;
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The eltwise chain with dynamic shapes is tokenized into the Subgraph only if CPU_SNIPPETS_DYNAMIC_SHAPES is set.
+   The shapes are changed between the inferences, including the broadcasting of the second input over the innermost
+   and the outer dimensions and the shapes seen before, so the kernels are both generated and taken from the cache.
+    Param   Param
+      |       |
+     Sinh    Sinh
+        \   /
+         Add
+          |
+         Relu
+          |
+        Result
+*/
+
+namespace {
+std::shared_ptr<ov::Model> makeSnippetsDynamicShapesModel(const std::vector<ov::PartialShape>& inputDynamicShapes) {
+    auto ngPrc = ngraph::element::f32;
+    auto inputParams = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+    auto sinh0 = std::make_shared<ngraph::opset1::Sinh>(inputParams[0]);
+    auto sinh1 = std::make_shared<ngraph::opset1::Sinh>(inputParams[1]);
+    auto add = std::make_shared<ngraph::opset1::Add>(sinh0, sinh1);
+    auto relu = std::make_shared<ngraph::opset1::Relu>(add);
+
+    ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(relu)};
+    return std::make_shared<ngraph::Function>(results, inputParams, "SnippetsDynamicShapes");
+}
+}  // namespace
+
+using SnippetsDynamicShapesParams = std::string;  // the CPU_SNIPPETS_DYNAMIC_SHAPES value
+
+class SnippetsDynamicShapesTest : public testing::WithParamInterface<SnippetsDynamicShapesParams>,
+                                  virtual public SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<SnippetsDynamicShapesParams>& obj) {
+        return "snippetsDynamicShapes=" + obj.param;
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({ov::intel_cpu::snippets_dynamic_shapes.name(), GetParam()});
+
+        std::vector<InputShape> inputShapes = {
+            {{-1, -1, -1}, {{1, 16, 37}, {2, 3, 64}, {1, 16, 37}, {4, 5, 7}, {2, 3, 64}}},
+            {{-1, -1, -1}, {{1, 16, 37}, {2, 1, 64}, {1, 16, 1},  {4, 5, 7}, {1, 3, 1}}}
+        };
+        init_input_shapes(inputShapes);
+        function = makeSnippetsDynamicShapesModel(inputDynamicShapes);
+    }
+};
+
+TEST_P(SnippetsDynamicShapesTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+    const bool isTokenized = GetParam() == InferenceEngine::PluginConfigParams::YES &&
+                             InferenceEngine::with_cpu_x86_avx2();
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", isTokenized ? 1 : 0);
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_SnippetsDynamicShapes, SnippetsDynamicShapesTest,
+                         ::testing::Values(InferenceEngine::PluginConfigParams::YES, InferenceEngine::PluginConfigParams::NO),
+                         SnippetsDynamicShapesTest::getTestCaseName);
+
+/* The inputs have the same shape, so none of them is broadcasted and the dimensions are always collapsed rather than
+   tiled. The broadcasting pattern and the schedule ranks are the same for all the shapes, so the shape-agnostic kernel
+   is generated for the first shape only and is taken from the runtime cache for the others.
+*/
+class SnippetsDynamicShapesKernelReuseTest : virtual public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert({ov::intel_cpu::snippets_dynamic_shapes.name(), InferenceEngine::PluginConfigParams::YES});
+        // the runtime caches are per stream
+        configuration.insert(ov::num_streams(1));
+
+        const std::vector<ov::Shape> shapes = {{1, 16, 37}, {2, 3, 64}, {4, 5, 7}, {3, 8, 19}, {1, 1, 300}};
+        std::vector<InputShape> inputShapes(2, {{-1, -1, -1}, shapes});
+        init_input_shapes(inputShapes);
+        function = makeSnippetsDynamicShapesModel(inputDynamicShapes);
+    }
+
+    uint64_t getRuntimeCacheCounter(const std::string& name) const {
+        return compiledModel.get_property(ov::intel_cpu::runtime_cache_statistics).at(name);
+    }
+};
+
+TEST_F(SnippetsDynamicShapesKernelReuseTest, KernelIsGeneratedOnce) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+    if (!InferenceEngine::with_cpu_x86_avx2())
+        GTEST_SKIP() << "Snippets are not supported on this platform";
+
+    compile_model();
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 1);
+
+    uint64_t misses = 0;
+    uint64_t hits = 0;
+    for (size_t i = 0; i < targetStaticShapes.size(); i++) {
+        init_ref_function(functionRefs, targetStaticShapes[i]);
+        generate_inputs(targetStaticShapes[i]);
+        validate();
+        if (i == 0) {
+            misses = getRuntimeCacheCounter("misses");
+            hits = getRuntimeCacheCounter("hits");
+            ASSERT_GT(misses, 0);
+        }
+    }
+
+    EXPECT_EQ(getRuntimeCacheCounter("misses"), misses);
+    EXPECT_GE(getRuntimeCacheCounter("hits"), hits + targetStaticShapes.size() - 1);
+}
+
+} // namespace SubgraphTestsDefinitions
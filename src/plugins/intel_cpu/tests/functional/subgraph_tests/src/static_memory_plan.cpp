@@ -0,0 +1,88 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <shared_test_classes/base/ov_subgraph.hpp>
+#include <ngraph_functions/builders.hpp>
+#include "functional_test_utils/skip_tests_config.hpp"
+#include "openvino/runtime/intel_cpu/properties.hpp"
+#include "functional_test_utils/ov_plugin_cache.hpp"
+
+#include <algorithm>
+#include <sstream>
+
+using namespace ov::test;
+
+namespace SubgraphTestsDefinitions {
+
+/* The dynamic sequence length is bounded by the declared upper bound, so the intermediate tensors are placed into the
+   statically planned workspace and the results must not depend on the inference order of the shapes.
+      Param
+        |
+     MatMul(const)
+        |
+     Softmax
+        |
+      Add(Param)
+*/
+
+class StaticMemoryPlanTest : public SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = CommonTestUtils::DEVICE_CPU;
+        configuration.insert(ov::intel_cpu::shape_upper_bounds("[2,64,32]"));
+
+        InputShape inputShape{{-1, -1, 32}, {{1, 16, 32}, {2, 64, 32}, {1, 8, 32}, {2, 1, 32}}};
+        init_input_shapes({inputShape});
+
+        auto ngPrc = ngraph::element::f32;
+        auto inputParams = ngraph::builder::makeDynamicParams(ngPrc, inputDynamicShapes);
+        auto weights = ngraph::builder::makeConstant<float>(ngPrc, {32, 32}, {}, true);
+        auto matMul = std::make_shared<ngraph::opset1::MatMul>(inputParams.front(), weights);
+        auto softmax = std::make_shared<ngraph::opset1::Softmax>(matMul, 2);
+        auto add = std::make_shared<ngraph::opset1::Add>(softmax, inputParams.front());
+
+        ngraph::ResultVector results{std::make_shared<ngraph::opset1::Result>(add)};
+        function = std::make_shared<ngraph::Function>(results, inputParams, "StaticMemoryPlan");
+    }
+};
+
+TEST_F(StaticMemoryPlanTest, smoke_CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    run();
+}
+
+// The output of the bounded shape is placed into the buffer sized for the upper bound, so it is neither reallocated
+// while the shapes grow up to the bound nor the declared model shapes are narrowed by the bound
+TEST_F(StaticMemoryPlanTest, smoke_NoReallocation) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED()
+
+    auto core = ov::test::utils::PluginCache::get().core();
+    auto compiledModel = core->compile_model(function, targetDevice, configuration);
+    ASSERT_EQ(compiledModel.input().get_partial_shape(), function->input().get_partial_shape());
+    ASSERT_EQ(compiledModel.output().get_partial_shape(), function->output().get_partial_shape());
+
+    auto request = compiledModel.create_infer_request();
+    const void* outputData = nullptr;
+    for (const auto& shape : std::vector<ov::Shape>{{1, 1, 32}, {1, 16, 32}, {2, 32, 32}, {1, 8, 32}, {2, 64, 32}}) {
+        ov::Tensor input(ov::element::f32, shape);
+        std::fill_n(input.data<float>(), input.get_size(), 0.5f);
+        request.set_input_tensor(input);
+        request.infer();
+
+        const auto output = request.get_output_tensor();
+        ASSERT_EQ(output.get_shape(), shape);
+        if (outputData == nullptr)
+            outputData = output.data();
+        ASSERT_EQ(output.data(), outputData) << "the output is reallocated for the shape " << shape;
+    }
+
+    std::stringstream blob;
+    compiledModel.export_model(blob);
+    auto importedModel = core->import_model(blob, targetDevice, configuration);
+    ASSERT_EQ(importedModel.input().get_partial_shape(), function->input().get_partial_shape());
+    ASSERT_EQ(importedModel.output().get_partial_shape(), function->output().get_partial_shape());
+}
+
+} // namespace SubgraphTestsDefinitions
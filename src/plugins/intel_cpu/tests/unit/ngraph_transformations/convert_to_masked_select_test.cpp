@@ -0,0 +1,104 @@
+// Copyright (C) 2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <memory>
+
+#include <openvino/opsets/opset1.hpp>
+#include <openvino/opsets/opset3.hpp>
+#include <openvino/opsets/opset8.hpp>
+#include <ngraph_transformations/op/masked_select.hpp>
+#include <ngraph_transformations/convert_to_masked_select.hpp>
+#include <transformations/init_node_info.hpp>
+#include <openvino/pass/manager.hpp>
+
+#include "common_test_utils/ngraph_test_utils.hpp"
+
+using namespace testing;
+using namespace ov::intel_cpu;
+using namespace ov;
+
+static std::shared_ptr<ov::Model> makeNonZeroGatherND(const ov::PartialShape& dataShape, const ov::PartialShape& maskShape,
+                                                      const std::vector<int64_t>& order = {1, 0}, size_t batchDims = 0,
+                                                      const element::Type& maskType = element::u8) {
+    auto data = std::make_shared<opset1::Parameter>(element::f32, dataShape);
+    auto mask = std::make_shared<opset1::Parameter>(maskType, maskShape);
+    auto nonZero = std::make_shared<opset3::NonZero>(mask, element::i32);
+    auto transpose = std::make_shared<opset1::Transpose>(nonZero, opset1::Constant::create(element::i64, Shape{2}, order));
+    auto gatherND = std::make_shared<opset8::GatherND>(data, transpose, batchDims);
+    return std::make_shared<ov::Model>(NodeVector{gatherND}, ParameterVector{data, mask});
+}
+
+static void runConvertToMaskedSelect(const std::shared_ptr<ov::Model>& f) {
+    ov::pass::Manager m;
+    m.register_pass<ov::pass::InitNodeInfo>();
+    m.register_pass<ConvertToMaskedSelect>();
+    m.run_passes(f);
+}
+
+TEST(TransformationTests, ConvertToMaskedSelectTest1) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        f = makeNonZeroGatherND(PartialShape{-1, 16, 8}, PartialShape{-1, 16});
+        runConvertToMaskedSelect(f);
+    }
+
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, PartialShape{-1, 16, 8});
+        auto mask = std::make_shared<opset1::Parameter>(element::u8, PartialShape{-1, 16});
+        auto maskedSelect = std::make_shared<MaskedSelectNode>(data, mask);
+        f_ref = std::make_shared<ov::Model>(NodeVector{maskedSelect}, ParameterVector{data, mask});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+    ASSERT_EQ(f->get_results()[0]->get_output_partial_shape(0), (PartialShape{-1, 8}));
+}
+
+TEST(TransformationTests, ConvertToMaskedSelectTest2) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        // GatherND with batch dimensions doesn't select the slices of the whole data
+        f = makeNonZeroGatherND(PartialShape{4, 16, 8}, PartialShape{4, 16}, {1, 0}, 1);
+        f_ref = makeNonZeroGatherND(PartialShape{4, 16, 8}, PartialShape{4, 16}, {1, 0}, 1);
+        runConvertToMaskedSelect(f);
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ConvertToMaskedSelectTest3) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        // Indices aren't transposed, so the coordinates aren't the rows of the indices
+        f = makeNonZeroGatherND(PartialShape{2, 2}, PartialShape{2, 2}, {0, 1});
+        f_ref = makeNonZeroGatherND(PartialShape{2, 2}, PartialShape{2, 2}, {0, 1});
+        runConvertToMaskedSelect(f);
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
+
+TEST(TransformationTests, ConvertToMaskedSelectTest4) {
+    std::shared_ptr<ov::Model> f(nullptr), f_ref(nullptr);
+    {
+        // The mask is usually produced by a comparison, so it's boolean before the precisions conversion
+        f = makeNonZeroGatherND(PartialShape{8, 4}, PartialShape{8}, {1, 0}, 0, element::boolean);
+        runConvertToMaskedSelect(f);
+    }
+
+    {
+        auto data = std::make_shared<opset1::Parameter>(element::f32, PartialShape{8, 4});
+        auto mask = std::make_shared<opset1::Parameter>(element::boolean, PartialShape{8});
+        auto maskedSelect = std::make_shared<MaskedSelectNode>(data, mask);
+        f_ref = std::make_shared<ov::Model>(NodeVector{maskedSelect}, ParameterVector{data, mask});
+    }
+
+    auto res = compare_functions(f, f_ref);
+    ASSERT_TRUE(res.first) << res.second;
+}
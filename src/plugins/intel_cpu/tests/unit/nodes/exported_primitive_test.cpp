@@ -0,0 +1,148 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <gtest/gtest.h>
+#include <ie_common.h>
+#include <edge.h>
+#include <node.h>
+#include <nodes/input.h>
+#include <nodes/pooling.h>
+#include <memory_desc/cpu_blocked_memory_desc.h>
+#include <serialize.h>
+#include <utils/rt_info/exported_primitive_attribute.hpp>
+
+#include <openvino/opsets/opset1.hpp>
+#include <dnnl.hpp>
+
+#include <functional>
+#include <sstream>
+
+using namespace InferenceEngine;
+using namespace ov::intel_cpu;
+
+namespace ExportedPrimitiveCPUTest {
+
+std::shared_ptr<ov::Model> makeMaxPoolModel(const std::string& exportedPrimitive = {}) {
+    auto param = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 16, 20, 20});
+    auto pool = std::make_shared<ov::opset1::MaxPool>(param, ov::Strides{2, 2}, ov::Shape{0, 0}, ov::Shape{0, 0}, ov::Shape{2, 2});
+    pool->set_friendly_name("MaxPool");
+    if (!exportedPrimitive.empty())
+        pool->get_rt_info()[ExportedPrimitiveAttr] = exportedPrimitive;
+    return std::make_shared<ov::Model>(ov::NodeVector{pool}, ov::ParameterVector{param}, "MaxPoolModel");
+}
+
+// The friendly names of the operations aren't required to be unique
+std::shared_ptr<ov::Model> makeSameNamedMaxPoolsModel() {
+    auto param = std::make_shared<ov::opset1::Parameter>(ov::element::f32, ov::Shape{1, 16, 20, 20});
+    ov::Output<ov::Node> out = param;
+    for (size_t i = 0; i < 2; i++) {
+        auto pool = std::make_shared<ov::opset1::MaxPool>(out, ov::Strides{2, 2}, ov::Shape{0, 0}, ov::Shape{0, 0}, ov::Shape{2, 2});
+        pool->set_friendly_name("MaxPool");
+        out = pool;
+    }
+    return std::make_shared<ov::Model>(ov::OutputVector{out}, ov::ParameterVector{param}, "SameNamedMaxPoolsModel");
+}
+
+CNNNetwork exportAndImport(const std::function<std::shared_ptr<ov::Model>()>& makeModel,
+                           const std::map<std::string, std::string>& primitives) {
+    std::stringstream stream;
+    {
+        CNNNetworkSerializer serializer(stream, std::make_shared<ExtensionManager>(), primitives);
+        serializer << CNNNetwork(makeModel());
+    }
+
+    // The reading of the IR is out of the scope, so the builder returns the same model
+    CNNNetworkDeserializer deserializer(stream, [&](const std::string&, const Blob::CPtr&) {
+        return CNNNetwork(makeModel());
+    });
+    CNNNetwork network;
+    deserializer >> network;
+    return network;
+}
+
+/*
+ * Input -> Pooling -> Output, the Pooling node enumerates and filters its primitive descriptors as the graph does
+ */
+class PoolingTestGraph {
+public:
+    explicit PoolingTestGraph(const std::shared_ptr<ov::Model>& model) {
+        const auto pool = model->get_results()[0]->get_input_node_shared_ptr(0);
+        inputNode = std::make_shared<node::Input>(std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape(pool->get_input_shape(0))),
+                                                  "Pooling_Input", "Parameter", cpuEngine, weightsCache);
+        poolingNode = std::make_shared<node::Pooling>(pool, cpuEngine, weightsCache);
+        outputNode = std::make_shared<node::Input>(std::make_shared<CpuBlockedMemoryDesc>(Precision::FP32, Shape(pool->get_output_shape(0))),
+                                                   "Pooling_Output", "Result", cpuEngine, weightsCache);
+
+        parentEdge = std::make_shared<Edge>(inputNode, poolingNode, 0, 0);
+        childEdge = std::make_shared<Edge>(poolingNode, outputNode, 0, 0);
+        poolingNode->addEdge(parentEdge);
+        poolingNode->addEdge(childEdge);
+
+        poolingNode->init();
+        poolingNode->getSupportedDescriptors();
+        poolingNode->initSupportedPrimitiveDescriptors();
+        poolingNode->filterSupportedPrimitiveDescriptors();
+    }
+
+    std::vector<std::string> getSupportedPrimitives() const {
+        std::vector<std::string> primitives;
+        for (const auto& desc : poolingNode->getSupportedPrimitiveDescriptors())
+            primitives.push_back(Node::describePrimitiveDescriptor(desc));
+        return primitives;
+    }
+
+private:
+    const dnnl::engine cpuEngine = {dnnl::engine::kind::cpu, 0};
+    WeightsSharing::Ptr weightsCache;
+    std::shared_ptr<node::Input> inputNode;
+    std::shared_ptr<node::Pooling> poolingNode;
+    std::shared_ptr<node::Input> outputNode;
+    std::shared_ptr<Edge> parentEdge;
+    std::shared_ptr<Edge> childEdge;
+};
+
+}  // namespace ExportedPrimitiveCPUTest
+
+using namespace ExportedPrimitiveCPUTest;
+
+TEST(ExportedPrimitiveCPUTest, KeepOnlyExportedPrimitive) {
+    const auto primitives = PoolingTestGraph(makeMaxPoolModel()).getSupportedPrimitives();
+    ASSERT_GT(primitives.size(), 1);
+
+    // not the first one, which would be selected anyway
+    const auto& exported = primitives.back();
+    const auto importedPrimitives = PoolingTestGraph(makeMaxPoolModel(exported)).getSupportedPrimitives();
+    ASSERT_EQ(importedPrimitives, std::vector<std::string>{exported});
+}
+
+TEST(ExportedPrimitiveCPUTest, KeepAllIfExportedPrimitiveIsNotSupported) {
+    const auto primitives = PoolingTestGraph(makeMaxPoolModel()).getSupportedPrimitives();
+    // e.g. the model was exported on the machine with another ISA
+    const auto importedPrimitives = PoolingTestGraph(makeMaxPoolModel("jit_unknown FP32:abcd -> FP32:abcd")).getSupportedPrimitives();
+    ASSERT_EQ(importedPrimitives, primitives);
+}
+
+TEST(ExportedPrimitiveCPUTest, ImportedOpsCarryExportedPrimitive) {
+    const std::string exported = "jit_avx512 FP32:aBcd16b -> FP32:aBcd16b";
+    const auto network = exportAndImport([] { return makeMaxPoolModel(); }, {{"MaxPool", exported}});
+
+    for (const auto& op : network.getFunction()->get_ops()) {
+        const auto& rtInfo = op->get_rt_info();
+        const auto it = rtInfo.find(ExportedPrimitiveAttr);
+        if (op->get_friendly_name() == "MaxPool") {
+            ASSERT_NE(it, rtInfo.end());
+            ASSERT_EQ(it->second.as<std::string>(), exported);
+        } else {
+            ASSERT_EQ(it, rtInfo.end()) << op->get_friendly_name();
+        }
+    }
+}
+
+TEST(ExportedPrimitiveCPUTest, AmbiguousNamesAreNotExported) {
+    const auto network = exportAndImport(makeSameNamedMaxPoolsModel, {{"MaxPool", "jit_avx512 FP32:aBcd16b -> FP32:aBcd16b"}});
+
+    for (const auto& op : network.getFunction()->get_ops()) {
+        const auto& rtInfo = op->get_rt_info();
+        ASSERT_EQ(rtInfo.find(ExportedPrimitiveAttr), rtInfo.end()) << op->get_friendly_name();
+    }
+}
@@ -8,6 +8,7 @@
 #include <gmock/gmock.h>
 
 #include "cache/lru_cache.h"
+#include "cache/concurrent_lru_cache.h"
 #include "cache/multi_cache.h"
 
 using namespace ov::intel_cpu;
@@ -379,3 +380,105 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(LruCacheTests, EvictionsCount) {
+    constexpr size_t capacity = 10;
+    LruCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+    ASSERT_EQ(cache.getEvictionsCount(), capacity);
+}
+
+TEST(ConcurrentLruCacheTests, PutGet) {
+    constexpr size_t capacity = 64;
+    ConcurrentLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i <= capacity; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i <= capacity; ++i) {
+        ASSERT_EQ(cache.get({i}), i);
+    }
+    ASSERT_EQ(cache.getEvictionsCount(), 0);
+}
+
+TEST(ConcurrentLruCacheTests, Empty) {
+    constexpr size_t capacity = 0;
+    constexpr size_t attempts = 10;
+    ConcurrentLruCache<IntKey, int> cache(capacity);
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_NO_THROW(cache.put({i}, i));
+    }
+
+    for (int i = 1; i < attempts; ++i) {
+        ASSERT_EQ(cache.get({i}), int());
+    }
+}
+
+TEST(ConcurrentLruCacheTests, BuilderException) {
+    constexpr size_t capacity = 10;
+    ConcurrentLruCache<IntKey, int> cache(capacity);
+    ASSERT_THROW(cache.getOrCreate({1}, [](const IntKey&) -> int { throw std::runtime_error("failed"); }), std::runtime_error);
+
+    // the failed build must not block the next attempts
+    auto result = cache.getOrCreate({1}, [](const IntKey& key) { return key.data; });
+    ASSERT_EQ(result.first, 1);
+    ASSERT_TRUE(result.second);
+}
+
+TEST(MultiCacheTests, Statistics) {
+    constexpr size_t capacity = 10;
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity);
+    for (int i = 0; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+    for (int i = capacity; i < 2 * capacity; ++i) {
+        cache.getOrCreate(IntKey{i}, intBuilder);
+    }
+
+    auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.misses, 2 * capacity);
+    ASSERT_EQ(stats.hits, capacity);
+    ASSERT_EQ(stats.evictions, capacity);
+}
+
+TEST(MultiCacheTests, ConcurrentBuildOnce) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr size_t capacity = 100;
+    constexpr size_t numThreads = 16;
+    constexpr int numKeys = 20;
+
+    std::atomic<size_t> buildsCount{0};
+    auto intBuilder = [&](const IntKey& key) {
+        ++buildsCount;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        return std::make_shared<int>(key.data);
+    };
+
+    MultiCache cache(capacity, MultiCache::Mode::Concurrent);
+
+    auto testRoutine = [&]() {
+        for (int i = 0; i < numKeys; ++i) {
+            auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, i);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    ASSERT_EQ(buildsCount.load(), numKeys);
+    auto stats = cache.getStatistics();
+    ASSERT_EQ(stats.misses, numKeys);
+    ASSERT_EQ(stats.hits, numThreads * numKeys - numKeys);
+}
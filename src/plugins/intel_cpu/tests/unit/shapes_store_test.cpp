@@ -0,0 +1,65 @@
+// Copyright (C) 2018-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <cstdio>
+
+#include <gtest/gtest.h>
+
+#include "cache/shapes_store.h"
+#include "ie_common.h"
+
+using namespace ov::intel_cpu;
+
+TEST(InputShapesStoreTests, Parse) {
+    auto sets = InputShapesStore::parse("input_ids[1,128] mask[1,128];input_ids[1,256] mask[1,256]");
+    ASSERT_EQ(sets.size(), 2);
+    ASSERT_EQ(sets[0].at("input_ids"), (VectorDims{1, 128}));
+    ASSERT_EQ(sets[0].at("mask"), (VectorDims{1, 128}));
+    ASSERT_EQ(sets[1].at("input_ids"), (VectorDims{1, 256}));
+    ASSERT_EQ(sets[1].at("mask"), (VectorDims{1, 256}));
+
+    auto unnamed = InputShapesStore::parse("[1,3,224,224]");
+    ASSERT_EQ(unnamed.size(), 1);
+    ASSERT_EQ(unnamed[0].at(""), (VectorDims{1, 3, 224, 224}));
+
+    ASSERT_TRUE(InputShapesStore::parse("").empty());
+}
+
+TEST(InputShapesStoreTests, ParseInvalid) {
+    ASSERT_THROW(InputShapesStore::parse("input[1,?]"), InferenceEngine::Exception);
+    ASSERT_THROW(InputShapesStore::parse("input[1,128"), InferenceEngine::Exception);
+}
+
+TEST(InputShapesStoreTests, ToStringRoundTrip) {
+    InputShapesStore::ShapesSet shapes{{"a", {1, 2, 3}}, {"b", {4}}};
+    auto parsed = InputShapesStore::parse(InputShapesStore::toString(shapes));
+    ASSERT_EQ(parsed.size(), 1);
+    ASSERT_EQ(parsed[0], shapes);
+}
+
+TEST(InputShapesStoreTests, RecordAndLoad) {
+    const std::string filePath = "cpu_input_shapes_store_test.txt";
+    std::remove(filePath.c_str());
+
+    InputShapesStore::ShapesSet first{{"in", {1, 16}}};
+    InputShapesStore::ShapesSet second{{"in", {1, 32}}};
+    InputShapesStore::ShapesSet third{{"in", {1, 64}}};
+    {
+        InputShapesStore store(filePath, 2);
+        ASSERT_TRUE(store.load().empty());
+        store.record(first);
+        store.record(first);
+        store.record(second);
+        // the capacity is reached
+        store.record(third);
+    }
+
+    InputShapesStore store(filePath, 2);
+    auto loaded = store.load();
+    ASSERT_EQ(loaded.size(), 2);
+    ASSERT_EQ(loaded[0], first);
+    ASSERT_EQ(loaded[1], second);
+
+    std::remove(filePath.c_str());
+}
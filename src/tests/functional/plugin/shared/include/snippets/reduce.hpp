@@ -0,0 +1,60 @@
+// Copyright (C) 2022-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "shared_test_classes/base/snippets_test_utils.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+typedef std::tuple<
+        ov::Shape,                   // Input 0 Shape
+        bool,                        // ReduceMax, otherwise ReduceSum
+        size_t,                      // Expected num nodes
+        size_t,                      // Expected num subgraphs
+        std::string,                 // Target Device
+        ov::AnyMap                   // Config
+> ReduceParams;
+
+typedef std::tuple<
+        ov::Shape,                   // Input 0 Shape
+        size_t,                      // Expected num nodes
+        size_t,                      // Expected num subgraphs
+        std::string,                 // Target Device
+        ov::AnyMap                   // Config
+> ReductionParams;
+
+class Reduce : public testing::WithParamInterface<ov::test::snippets::ReduceParams>,
+               virtual public ov::test::SnippetsTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ov::test::snippets::ReduceParams> obj);
+
+protected:
+    void SetUp() override;
+};
+
+class Softmax : public testing::WithParamInterface<ov::test::snippets::ReductionParams>,
+                virtual public ov::test::SnippetsTestsCommon {
+public:
+    static std::string getTestCaseName(testing::TestParamInfo<ov::test::snippets::ReductionParams> obj);
+
+protected:
+    void SetUp() override;
+};
+
+class MVN : public Softmax {
+protected:
+    void SetUp() override;
+};
+
+class ReduceMaxSubtract : public Softmax {
+protected:
+    void SetUp() override;
+};
+
+} // namespace snippets
+} // namespace test
+} // namespace ov
@@ -0,0 +1,112 @@
+// Copyright (C) 2022-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/common_utils.hpp"
+#include "snippets/reduce.hpp"
+#include "subgraph_reduce.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+std::string Reduce::getTestCaseName(testing::TestParamInfo<ov::test::snippets::ReduceParams> obj) {
+    ov::Shape inputShapes;
+    bool reduceMax;
+    std::string targetDevice;
+    size_t num_nodes, num_subgraphs;
+    ov::AnyMap config;
+    std::tie(inputShapes, reduceMax, num_nodes, num_subgraphs, targetDevice, config) = obj.param;
+
+    std::ostringstream result;
+    result << "IS[0]=" << CommonTestUtils::vec2str(inputShapes) << "_";
+    result << "Op=" << (reduceMax ? "ReduceMax" : "ReduceSum") << "_";
+    result << "#N=" << num_nodes << "_";
+    result << "#S=" << num_subgraphs << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+void Reduce::SetUp() {
+    ov::Shape inputShape;
+    bool reduceMax;
+    ov::AnyMap config;
+    std::tie(inputShape, reduceMax, ref_num_nodes, ref_num_subgraphs, targetDevice, config) = this->GetParam();
+    init_input_shapes({{{}, {inputShape, }}});
+    configuration.insert(config.begin(), config.end());
+
+    auto f = ov::test::snippets::ReduceSinhFunction({inputShape}, reduceMax);
+    function = f.getOriginal();
+}
+
+std::string Softmax::getTestCaseName(testing::TestParamInfo<ov::test::snippets::ReductionParams> obj) {
+    ov::Shape inputShapes;
+    std::string targetDevice;
+    size_t num_nodes, num_subgraphs;
+    ov::AnyMap config;
+    std::tie(inputShapes, num_nodes, num_subgraphs, targetDevice, config) = obj.param;
+
+    std::ostringstream result;
+    result << "IS[0]=" << CommonTestUtils::vec2str(inputShapes) << "_";
+    result << "#N=" << num_nodes << "_";
+    result << "#S=" << num_subgraphs << "_";
+    result << "targetDevice=" << targetDevice;
+    return result.str();
+}
+
+void Softmax::SetUp() {
+    ov::Shape inputShape;
+    ov::AnyMap config;
+    std::tie(inputShape, ref_num_nodes, ref_num_subgraphs, targetDevice, config) = this->GetParam();
+    init_input_shapes({{{}, {inputShape, }}});
+    configuration.insert(config.begin(), config.end());
+
+    auto f = ov::test::snippets::SoftmaxSinhFunction({inputShape});
+    function = f.getOriginal();
+}
+
+void MVN::SetUp() {
+    ov::Shape inputShape;
+    ov::AnyMap config;
+    std::tie(inputShape, ref_num_nodes, ref_num_subgraphs, targetDevice, config) = this->GetParam();
+    init_input_shapes({{{}, {inputShape, }}});
+    configuration.insert(config.begin(), config.end());
+
+    auto f = ov::test::snippets::MVNSinhFunction({inputShape});
+    function = f.getOriginal();
+}
+
+void ReduceMaxSubtract::SetUp() {
+    ov::Shape inputShape;
+    ov::AnyMap config;
+    std::tie(inputShape, ref_num_nodes, ref_num_subgraphs, targetDevice, config) = this->GetParam();
+    init_input_shapes({{{}, {inputShape, }}});
+    configuration.insert(config.begin(), config.end());
+
+    auto f = ov::test::snippets::ReduceMaxSubtractSinhFunction({inputShape});
+    function = f.getOriginal();
+}
+
+TEST_P(Reduce, CompareWithRefImpl) {
+    run();
+    validateNumSubgraphs();
+}
+
+TEST_P(Softmax, CompareWithRefImpl) {
+    run();
+    validateNumSubgraphs();
+}
+
+TEST_P(MVN, CompareWithRefImpl) {
+    run();
+    validateNumSubgraphs();
+}
+
+TEST_P(ReduceMaxSubtract, CompareWithRefImpl) {
+    run();
+    validateNumSubgraphs();
+}
+
+} // namespace snippets
+} // namespace test
+} // namespace ov
@@ -0,0 +1,81 @@
+// Copyright (C) 2022-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include "ngraph/ngraph.hpp"
+#include "./snippets_helpers.hpp"
+
+/* This file contains definitions of the functions (models) with the reductions over the innermost axis that will be
+ * used to test snippets-specific behavior. The reductions are preceded by Sinh to WA CPU-specific disabling after inputs.
+ */
+
+namespace ov {
+namespace test {
+namespace snippets {
+/// ReduceSum or ReduceMax with keep_dims, which [..., 1] result is the Subgraph output.
+/// Tokenized simply by starting subgraph.
+//    in1
+//    Sinh
+//   Reduce
+//   Result
+class ReduceSinhFunction : public SnippetsFunctionBase {
+public:
+    explicit ReduceSinhFunction(const std::vector<Shape>& inputShapes, bool reduceMax = false)
+    : SnippetsFunctionBase(inputShapes), reduceMax(reduceMax) {
+        NGRAPH_CHECK(input_shapes.size() == 1, "Got invalid number of input shapes");
+    }
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+
+    bool reduceMax;
+};
+/// ReduceMax which result is broadcasted back to the row.
+/// Tokenized by starting subgraph and attaching Subtract.
+//    in1
+//    Sinh
+//     |   \
+//     |  ReduceMax
+//   Subtract
+//    Result
+class ReduceMaxSubtractSinhFunction : public SnippetsFunctionBase {
+public:
+    explicit ReduceMaxSubtractSinhFunction(const std::vector<Shape>& inputShapes) : SnippetsFunctionBase(inputShapes) {
+        NGRAPH_CHECK(input_shapes.size() == 1, "Got invalid number of input shapes");
+    }
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+};
+/// Softmax over the innermost axis.
+/// Tokenized simply by starting subgraph.
+//    in1
+//    Sinh
+//   Softmax
+//   Result
+class SoftmaxSinhFunction : public SnippetsFunctionBase {
+public:
+    explicit SoftmaxSinhFunction(const std::vector<Shape>& inputShapes) : SnippetsFunctionBase(inputShapes) {
+        NGRAPH_CHECK(input_shapes.size() == 1, "Got invalid number of input shapes");
+    }
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+};
+/// MVN over the innermost axis with the variance normalization.
+/// Tokenized simply by starting subgraph.
+//    in1
+//    Sinh
+//    MVN
+//   Result
+class MVNSinhFunction : public SnippetsFunctionBase {
+public:
+    explicit MVNSinhFunction(const std::vector<Shape>& inputShapes) : SnippetsFunctionBase(inputShapes) {
+        NGRAPH_CHECK(input_shapes.size() == 1, "Got invalid number of input shapes");
+    }
+protected:
+    std::shared_ptr<ov::Model> initOriginal() const override;
+};
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,49 @@
+// Copyright (C) 2022-2023 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "subgraph_reduce.hpp"
+
+namespace ov {
+namespace test {
+namespace snippets {
+
+namespace {
+std::shared_ptr<op::v0::Constant> makeInnermostAxis() {
+    return std::make_shared<op::v0::Constant>(ov::element::i64, Shape{1}, std::vector<int64_t>{-1});
+}
+} // namespace
+
+std::shared_ptr<ov::Model> ReduceSinhFunction::initOriginal() const {
+    auto data0 = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto sinh = std::make_shared<op::v0::Sinh>(data0);
+    std::shared_ptr<Node> reduce;
+    if (reduceMax)
+        reduce = std::make_shared<op::v1::ReduceMax>(sinh, makeInnermostAxis(), true);
+    else
+        reduce = std::make_shared<op::v1::ReduceSum>(sinh, makeInnermostAxis(), true);
+    return std::make_shared<ov::Model>(NodeVector{reduce}, ParameterVector{data0});
+}
+std::shared_ptr<ov::Model> ReduceMaxSubtractSinhFunction::initOriginal() const {
+    auto data0 = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto sinh = std::make_shared<op::v0::Sinh>(data0);
+    auto reduce = std::make_shared<op::v1::ReduceMax>(sinh, makeInnermostAxis(), true);
+    auto subtract = std::make_shared<op::v1::Subtract>(sinh, reduce);
+    return std::make_shared<ov::Model>(NodeVector{subtract}, ParameterVector{data0});
+}
+std::shared_ptr<ov::Model> SoftmaxSinhFunction::initOriginal() const {
+    auto data0 = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto sinh = std::make_shared<op::v0::Sinh>(data0);
+    auto softmax = std::make_shared<op::v8::Softmax>(sinh, -1);
+    return std::make_shared<ov::Model>(NodeVector{softmax}, ParameterVector{data0});
+}
+std::shared_ptr<ov::Model> MVNSinhFunction::initOriginal() const {
+    auto data0 = std::make_shared<op::v0::Parameter>(precision, input_shapes[0]);
+    auto sinh = std::make_shared<op::v0::Sinh>(data0);
+    auto mvn = std::make_shared<op::v6::MVN>(sinh, makeInnermostAxis(), true, 1e-9f, op::MVNEpsMode::INSIDE_SQRT);
+    return std::make_shared<ov::Model>(NodeVector{mvn}, ParameterVector{data0});
+}
+
+}  // namespace snippets
+}  // namespace test
+}  // namespace ov